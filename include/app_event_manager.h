@@ -55,6 +55,15 @@ enum app_event_type_flags {
 	 */
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+	/** places events of this type in the high priority lane.
+	 *  High priority events are processed before any pending normal priority event.
+	 *  Flag set by user.
+	 */
+	APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY,
+	/** enables coalescing of events of this type.
+	 *  Flag set by @ref APP_EVENT_TYPE_DEFINE_COALESCED.
+	 */
+	APP_EVENT_TYPE_FLAGS_COALESCE,
 	/** shows number of predefined flags.*/
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
@@ -178,6 +187,51 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
 
 
+/** @brief Define an event type with coalescing enabled.
+ *
+ * This macro works like @ref APP_EVENT_TYPE_DEFINE, but events of the defined type are
+ * coalesced. If an event of this type is submitted while another event of the same type
+ * and with the same key is still waiting to be processed, the content of the waiting event
+ * is replaced with the content of the submitted event and the submitted event is freed.
+ * Only the last submitted value is delivered to the listeners.
+ *
+ * Event types with dynamic data cannot be coalesced.
+ *
+ * @note
+ * For this macro to be available the @kconfig{CONFIG_APP_EVENT_MANAGER_COALESCE} option
+ * needs to be enabled.
+ *
+ * @param ename                Name of the event.
+ * @param log_fn               Function to stringify an event of this type.
+ * @param ev_info_struct       Data structure describing the event type.
+ * @param app_event_type_flags Event type flags.
+ *                             You should use APP_EVENT_FLAGS_CREATE to define them.
+ * @param key_fn               Function returning the coalescing key of an event
+ *                             or NULL to coalesce all events of the given type.
+ *                             The function should have a form
+ *                             `uint32_t key_fn(const struct app_event_header *aeh)`.
+ */
+#define APP_EVENT_TYPE_DEFINE_COALESCED(ename, log_fn, ev_info_struct, app_event_type_flags,	\
+					key_fn)							\
+	_APP_EVENT_TYPE_DEFINE_COALESCED(ename, log_fn, ev_info_struct, app_event_type_flags,	\
+					 key_fn)
+
+/** @brief Get number of coalesced events of the given type.
+ *
+ * The counter is incremented every time an event submitted by the application is merged
+ * into a pending event of the same type instead of being added to the queue.
+ *
+ * @note
+ * For this function to be available the @kconfig{CONFIG_APP_EVENT_MANAGER_COALESCE} option
+ * needs to be enabled.
+ *
+ * @param et Pointer to the event type.
+ *
+ * @return Number of coalesced events.
+ */
+uint32_t app_event_manager_coalesced_cnt_get(const struct event_type *et);
+
+
 /** @brief Verify if an event ID is valid.
  *
  * The pointer to an event type structure is used as its ID. This macro
@@ -252,6 +306,7 @@ static inline size_t app_event_manager_event_size(const struct app_event_header
  * The registered hook may be called from many contexts.
  * To ensure that order of events in the queue matches the order of the registered callbacks calls,
  * the callbacks are called under the same spinlock as adding events to the queue.
+ * This guarantee is not provided if @kconfig{CONFIG_APP_EVENT_MANAGER_QUEUE_MPSC} is enabled.
  *
  * @param hook_fn Hook function.
  */
@@ -269,6 +324,7 @@ static inline size_t app_event_manager_event_size(const struct app_event_header
  * The registered hook may be called from many contexts.
  * To ensure that order of events in the queue matches the order of the registered callbacks calls,
  * the callbacks are called under the same spinlock as adding events to the queue.
+ * This guarantee is not provided if @kconfig{CONFIG_APP_EVENT_MANAGER_QUEUE_MPSC} is enabled.
  *
  * @param hook_fn Hook function.
  */
@@ -287,6 +343,7 @@ static inline size_t app_event_manager_event_size(const struct app_event_header
  * The registered hook may be called from many contexts.
  * To ensure that order of events in the queue matches the order of the registered callbacks calls,
  * the callbacks are called under the same spinlock as adding events to the queue.
+ * This guarantee is not provided if @kconfig{CONFIG_APP_EVENT_MANAGER_QUEUE_MPSC} is enabled.
  *
  * @param hook_fn Hook function.
  */
@@ -217,6 +217,10 @@ struct audio_module_functions {
 	 *
 	 * @note This is a mandatory function for an audio module.
 	 *
+	 * @note An input/output module that does not change the audio data can pass the input
+	 *       on to the connected modules without a copy, by setting the data pointer of the
+	 *       output audio data to the data pointer of the input audio data.
+	 *
 	 * @param handle         [in/out]  The handle to the module instance.
 	 * @param audio_data_rx  [in]      Pointer to the input audio data or NULL for an input
 	 *                                 module.
@@ -228,6 +232,19 @@ struct audio_module_functions {
 	int (*data_process)(struct audio_module_handle_private *handle,
 			    struct audio_data const *const audio_data_rx,
 			    struct audio_data *audio_data_tx);
+
+	/**
+	 * @brief Release an output audio data buffer of an audio module. This is called when the
+	 *        last connected module has consumed the buffer, just before it is returned to
+	 *        the data slab.
+	 *
+	 * @note This is an optional function for an audio module.
+	 *
+	 * @param handle      [in/out]  The handle to the module instance.
+	 * @param audio_data  [in]      Pointer to the audio data being released.
+	 */
+	void (*data_release)(struct audio_module_handle_private *handle,
+			     struct audio_data const *const audio_data);
 };
 
 /**
@@ -272,6 +289,29 @@ struct audio_module_thread_configuration {
 	size_t data_size;
 };
 
+/**
+ * @brief Module's processing statistics.
+ *
+ * @note All times are in cycles, use k_cyc_to_us_floor32() or similar to convert them.
+ */
+struct audio_module_stats {
+	/* Number of audio data items processed. */
+	uint32_t data_count;
+
+	/* Number of audio data items forwarded to the connected modules without a copy. */
+	uint32_t forward_count;
+
+	/* Time spent in the data_process function. */
+	uint32_t process_cycles_last;
+	uint32_t process_cycles_max;
+	uint64_t process_cycles_total;
+
+	/* Time from the audio data being queued to the module until it has been processed. */
+	uint32_t latency_cycles_last;
+	uint32_t latency_cycles_max;
+	uint64_t latency_cycles_total;
+};
+
 /**
  * @brief Module's generic set-up structure.
  */
@@ -314,15 +354,22 @@ struct audio_module_handle {
 	/* Number of destination modules. */
 	uint8_t dest_count;
 
-	/* Semaphore to count messages between modules and on a module's TX FIFO. */
-	struct k_sem sem;
-
 	/* Mutex to make the above destinations list thread safe. */
 	struct k_mutex dest_mutex;
 
 	/* Module's thread configuration. */
 	struct audio_module_thread_configuration thread;
 
+	/* Number of consumers still holding each of the module's output audio data buffers,
+	 * indexed by the position of the buffer in the data slab.
+	 */
+	atomic_t data_ref_count[CONFIG_AUDIO_MODULE_DATA_BUFFERS_MAX];
+
+#if CONFIG_AUDIO_MODULE_STATS
+	/* Module's processing statistics. */
+	struct audio_module_stats stats;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
 	/* Private context for the module. */
 	struct audio_module_context *context;
 };
@@ -339,6 +386,11 @@ struct audio_module_message {
 
 	/* Callback for when the audio data has been consumed. */
 	audio_module_response_cb response_cb;
+
+#if CONFIG_AUDIO_MODULE_STATS
+	/* Cycle count when the audio data was queued. */
+	uint32_t timestamp;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
 };
 
 /**
@@ -526,6 +578,30 @@ int audio_module_names_get(struct audio_module_handle const *const handle, char
 int audio_module_state_get(struct audio_module_handle const *const handle,
 			   enum audio_module_state *state);
 
+/**
+ * @brief Get the processing statistics of an audio module.
+ *
+ * @note Requires CONFIG_AUDIO_MODULE_STATS.
+ *
+ * @param handle  [in]   The handle to the module instance.
+ * @param stats   [out]  Pointer to the module's statistics.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_stats_get(struct audio_module_handle const *const handle,
+			   struct audio_module_stats *stats);
+
+/**
+ * @brief Reset the processing statistics of an audio module.
+ *
+ * @note Requires CONFIG_AUDIO_MODULE_STATS.
+ *
+ * @param handle  [in/out]  The handle to the module instance.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_stats_reset(struct audio_module_handle *handle);
+
 /**
  * @brief Helper to calculate the number of channels from the channel map for the given
  *        audio data.
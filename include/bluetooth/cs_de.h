@@ -89,8 +89,41 @@ typedef struct {
 
 	/** Number of RTT measurements taken */
 	uint8_t rtt_count;
+
+	/** Number of tones accumulated per channel. Internal, used for averaging. */
+	uint16_t n_iqs[CONFIG_BT_RAS_MAX_ANTENNA_PATHS][75];
 } cs_de_report_t;
 
+/**
+ * @brief Prepare the report for incremental population.
+ *
+ * Use this together with @ref cs_de_report_step_add and @ref cs_de_report_finalize to
+ * accumulate the step data as it arrives, for example per subevent, instead of parsing
+ * the whole procedure at once with @ref cs_de_populate_report.
+ * @param[out] p_report Report to prepare.
+ * @param[in] role CS role of the local controller.
+ * @param[in] n_ap Number of antenna paths present in the data.
+ */
+void cs_de_report_init(cs_de_report_t *p_report, enum bt_conn_le_cs_role role, uint8_t n_ap);
+
+/**
+ * @brief Accumulate a pair of local and peer steps into the report.
+ * @param[in,out] p_report Report prepared with @ref cs_de_report_init.
+ * @param[in] local_step Step data from the local controller.
+ * @param[in] peer_step Matching step data from the peer.
+ */
+void cs_de_report_step_add(cs_de_report_t *p_report, const struct bt_le_cs_subevent_step *local_step,
+			   const struct bt_le_cs_subevent_step *peer_step);
+
+/**
+ * @brief Complete an incrementally populated report.
+ * This averages the accumulated tones and sets the tone quality. Call it once all steps of the
+ * procedure are added, before @ref cs_de_calc.
+ * @param[in,out] p_report Report populated with @ref cs_de_report_step_add.
+ * @param[in] channel_map Channel map from the CS config of the local controller.
+ */
+void cs_de_report_finalize(cs_de_report_t *p_report, const uint8_t channel_map[10]);
+
 /**
  * @brief Partially populate the report.
  * This populates the report but does not set the distance estimates and the quality.
@@ -102,7 +135,9 @@ typedef struct {
 void cs_de_populate_report(struct net_buf_simple *local_steps, struct net_buf_simple *peer_steps,
 			   struct bt_conn_le_cs_config *config, cs_de_report_t *p_report);
 
-/* Takes partially populated report and calculates distance estimates and quality. */
+/* Takes partially populated report and calculates distance estimates and quality.
+ * Uses a shared scratch buffer, so it must not be called concurrently for several peers.
+ */
 cs_de_quality_t cs_de_calc(cs_de_report_t *p_report);
 
 /**
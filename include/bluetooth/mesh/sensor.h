@@ -625,6 +625,12 @@ struct bt_mesh_sensor {
 
 		/** Flag indicating whether the sensor cadence state has been configured. */
 		uint8_t configured : 1;
+
+		/** Flag indicating whether the sensor value is waiting in the
+		 *  server's sample batch. Kept out of the bit-fields above, as it
+		 *  is only changed under the server's batch lock.
+		 */
+		bool batched;
 	} state;
 };
 
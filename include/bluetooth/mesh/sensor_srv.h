@@ -106,6 +106,19 @@ struct bt_mesh_sensor_srv {
 		BT_MESH_MODEL_BUF_LEN(
 			BT_MESH_SENSOR_OP_CADENCE_STATUS,
 			BT_MESH_SENSOR_MSG_MAXLEN_CADENCE_STATUS))];
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_SAMPLE_BATCH)
+	/* Sample batch publication delay */
+	struct k_work_delayable batch_work;
+	/* Sample batch lock, taken by the sampling thread and the work queue */
+	struct k_mutex batch_lock;
+	/* Sample batch buffer */
+	struct net_buf_simple batch_buf;
+	/* Sample batch data */
+	uint8_t batch_data[BT_MESH_MODEL_BUF_LEN(
+		BT_MESH_SENSOR_OP_STATUS,
+		(CONFIG_BT_MESH_SENSOR_SRV_SENSORS_MAX *
+		 BT_MESH_SENSOR_STATUS_MAXLEN))];
+#endif
 	/** Composition data model pointer. */
 	const struct bt_mesh_model *model;
 };
@@ -141,10 +154,18 @@ int bt_mesh_sensor_srv_pub(struct bt_mesh_sensor_srv *srv,
  *  previous publication and the sensor's threshold parameters. Only single
  *  channel sensor values will be considered.
  *
+ *  If @kconfig{CONFIG_BT_MESH_SENSOR_SRV_SAMPLE_BATCH} is enabled, the value
+ *  is added to a batch of sampled sensor values, which is published in a
+ *  single message after
+ *  @kconfig{CONFIG_BT_MESH_SENSOR_SRV_SAMPLE_BATCH_DELAY} milliseconds, or
+ *  when the sensor is sampled again. The batch is protected by a mutex, so the
+ *  function must then be called from a thread, not from an interrupt.
+ *
  *  @param[in] srv    Sensor server instance.
  *  @param[in] sensor Sensor instance to sample.
  *
- *  @retval 0              The sensor value was published.
+ *  @retval 0              The sensor value was published, or added to the
+ *                         sample batch.
  *  @retval -EBUSY         Failed sampling the sensor value.
  *  @retval -EALREADY      The sensor value has not changed sufficiently to
  *                         require a publication.
@@ -140,6 +140,23 @@ int dfu_target_offset_get(size_t *offset);
  **/
 int dfu_target_write(const void *const buf, size_t len);
 
+/**
+ * @brief Get a buffer to place the next part of the firmware image in.
+ *
+ * Data placed at the start of the buffer is taken without a copy when
+ * @ref dfu_target_write is called with the same pointer, before any other
+ * call to the DFU target. Only the targets that write through the stream
+ * flash buffer support this.
+ *
+ * @param[out] buf Returns the buffer.
+ * @param[out] len Returns the length of the buffer.
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if no DFU target is initialized.
+ * @retval -ENOTSUP if the DFU target does not lend its buffer.
+ **/
+int dfu_target_buf_get(void **buf, size_t *len);
+
 /**
  * @brief Release the resources that were needed for the current DFU
  *	  target.
@@ -91,6 +91,22 @@ int dfu_target_stream_offset_get(size_t *offset);
  */
 int dfu_target_stream_bytes_buffered_get(size_t *out);
 
+/**
+ * @brief Get the free part of the flash write buffer, to receive data into.
+ *
+ * Data placed at the start of the returned buffer is taken without a copy when
+ * @ref dfu_target_stream_write is called with the same pointer. Data that is not
+ * written this way is ignored.
+ *
+ * @param[out] buf Returns the free part of the buffer.
+ * @param[out] len Returns the length of the free part of the buffer.
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if the stream is not initialized.
+ * @retval -EINVAL if a parameter is NULL.
+ */
+int dfu_target_stream_buf_get(void **buf, size_t *len);
+
 /**
  * @brief Write a chunk of firmware data.
  *
@@ -173,9 +173,14 @@ int emds_clear(void);
  * added. After this has been called emergency data storage should be ready to
  * store.
  *
+ * If the CONFIG_EMDS_INCREMENTAL option is enabled, this function also writes
+ * the current data of all entries to the prepared snapshot, and @ref emds_store
+ * only writes the entries that have changed since.
+ *
  * @retval 0 Success
  * @retval -ECANCELED errno code if it was called before @ref emds_init and @ref emds_load
  * @retval -ENOENT errno code if no valid snapshot was found in any partition
+ * @retval -ERRNO errno code if the entries could not be written to the snapshot
  */
 int emds_prepare(void);
 
@@ -184,7 +189,9 @@ int emds_prepare(void);
  *
  * Estimate how much time it takes to store all dynamic and static data
  * registered in the entries. This value is dependent on the chip used, and
- * should be checked against the chip datasheet.
+ * should be checked against the chip datasheet. If the CONFIG_EMDS_INCREMENTAL
+ * option is enabled, the estimate covers the worst case where all entries have
+ * changed since @ref emds_prepare was called.
  *
  * @param store_time_us Pointer to a variable where the estimated time (in microseconds)
  *                      will be stored.
@@ -298,6 +298,12 @@ struct esb_payload {
 		       *  ack is enabled.
 		       */
 	uint8_t pid;    /**< PID assigned during communication. */
+#if defined(CONFIG_ESB_RX_TIMESTAMP) || defined(__DOXYGEN__)
+	/** Value of k_cycle_get_32() when the packet was added to the RX FIFO.
+	 *  Only set for received packets.
+	 */
+	uint32_t timestamp;
+#endif
 	uint8_t data[CONFIG_ESB_MAX_PAYLOAD_LENGTH]; /**< The payload data. */
 };
 
@@ -404,6 +410,20 @@ bool esb_is_idle(void);
  */
 int esb_write_payload(const struct esb_payload *payload);
 
+/** @brief Write several payloads for transmission or acknowledgement.
+ *
+ *  This function adds the payloads to the queue in order, as @ref esb_write_payload
+ *  does, but starts the transmission only once. It stops at the first payload
+ *  that cannot be added, for example because the queue is full.
+ *
+ *  @param[in]   payloads    The payloads.
+ *  @param[in]   count       Number of payloads.
+ *
+ * @return Number of payloads added to the queue, if at least one was added.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int esb_write_payloads(const struct esb_payload *payloads, size_t count);
+
 /** @brief Read a payload.
  *
  *  @param[in,out] payload	The payload to be received.
@@ -413,6 +433,20 @@ int esb_write_payload(const struct esb_payload *payload);
  */
 int esb_read_rx_payload(struct esb_payload *payload);
 
+/** @brief Read several payloads.
+ *
+ *  This function reads up to @p count payloads from the RX FIFO in one call,
+ *  and releases their space in the RX FIFO at once.
+ *
+ *  @param[out]  payloads    Array of at least @p count payloads to be received.
+ *  @param[in]   count       Maximum number of payloads to read.
+ *
+ * @return Number of payloads read, if successful.
+ * @retval -ENODATA If the RX FIFO is empty.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int esb_read_rx_payloads(struct esb_payload *payloads, size_t count);
+
 /** @brief Start transmitting data.
  *
  * @retval 0 If successful.
@@ -449,9 +483,13 @@ int esb_stop_rx(void);
 int esb_flush_tx(void);
 
 /** @brief Pop the first item from the TX buffer.
+ *
+ * Only available in PTX mode. ACK payloads queued in PRX mode can be removed
+ * with @ref esb_flush_tx.
  *
  * @retval 0 If successful.
  * @retval -EACCES If ESB is not initialized.
+ * @retval -EPERM  If ESB is not in PTX mode.
  * @retval -EBUSY  If radio is transmitting.
  * @retval -ENODATA If TX FIFO is empty.
  */
@@ -36,6 +36,20 @@ enum at_parser_cmd_type {
 	AT_PARSER_CMD_TYPE_TEST
 };
 
+/**
+ * @brief Value of an AT command line, as stored by an indexed AT parser.
+ *
+ * The content of this structure is internal to the AT parser.
+ */
+struct at_parser_token {
+	/* Pointer to the value in the AT command string. */
+	const char *start;
+	/* Length of the value. */
+	size_t len;
+	/* Type of the value. */
+	uint8_t type;
+};
+
 /**
  * @brief AT parser
  *
@@ -51,6 +65,12 @@ struct at_parser {
 	size_t count;
 	/* Indicates that the next subparameter is empty. */
 	bool is_next_empty;
+	/* Values of the current AT command line, for an indexed AT parser. */
+	struct at_parser_token *tokens;
+	/* Capacity of the tokens array. */
+	size_t tokens_size;
+	/* Number of values of the current AT command line stored in the tokens array. */
+	size_t tokens_count;
 	/* Sentinel value for determining initialization state. */
 	uint32_t init_sentinel;
 };
@@ -99,6 +119,30 @@ struct at_parser {
  */
 int at_parser_init(struct at_parser *parser, const char *at);
 
+/**
+ * @brief Initialize an indexed AT parser for a given AT command string.
+ *
+ * The indexed AT parser tokenizes the current AT command line once, when it is initialized and
+ * every time it moves to the next command line, and stores the values in @p tokens.
+ * The values stored in @p tokens are retrieved in constant time, instead of tokenizing the
+ * AT command line up to the requested index.
+ * The values that do not fit in @p tokens are retrieved the same way as with an AT parser
+ * initialized with @ref at_parser_init.
+ *
+ * @p tokens must remain valid for as long as @p parser is used.
+ *
+ * @param[in] parser      A pointer to the AT parser.
+ * @param[in] at          A pointer to the AT command string to parse.
+ * @param[in] tokens      Array where to store the values of the current AT command line.
+ * @param[in] tokens_size Number of elements in @p tokens.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ */
+int at_parser_indexed_init(struct at_parser *parser, const char *at,
+			   struct at_parser_token *tokens, size_t tokens_size);
+
 /**
  * @brief Move the cursor of an AT parser to the next command line of its configured AT command
  *        string.
@@ -133,6 +133,33 @@ int nrf_modem_lib_trace_peek_at(size_t offset, uint8_t *buf, size_t len);
 uint32_t nrf_modem_lib_trace_backend_bitrate_get(void);
 #endif /* defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE) || defined(__DOXYGEN__) */
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_STATS) || defined(__DOXYGEN__)
+/** @brief Flash trace backend statistics, counted since boot. */
+struct nrf_modem_lib_trace_flash_stats {
+	/** Trace bytes written to flash. */
+	uint32_t bytes_stored;
+	/** Bytes written to flash, including the storage headers. */
+	uint32_t flash_bytes_written;
+	/** Flash sectors erased. */
+	uint32_t sectors_erased;
+	/** Unread trace bytes erased to make space for new traces. */
+	uint32_t bytes_dropped;
+	/** Number of times the trace thread waited for the flash to be written. */
+	uint32_t write_waits;
+};
+
+/** @brief Get the statistics of the flash trace backend.
+ *
+ * The write amplification is @c flash_bytes_written divided by @c bytes_stored.
+ *
+ * @param stats Statistics output.
+ *
+ * @return 0 on success, negative errno on failure.
+ * @retval -EINVAL if @p stats is NULL.
+ */
+int nrf_modem_lib_trace_flash_stats_get(struct nrf_modem_lib_trace_flash_stats *stats);
+#endif /* defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_STATS) || defined(__DOXYGEN__) */
+
 /** @} */
 
 #ifdef __cplusplus
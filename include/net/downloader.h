@@ -139,6 +139,20 @@ struct downloader_cfg {
 	char *buf;
 	/** Downloader buffer size. */
 	size_t buf_size;
+	/**
+	 * Optional function that lends a buffer to receive the next fragment into.
+	 *
+	 * Once the response header is parsed, the HTTP transport receives the payload
+	 * straight into the lent buffer, and the fragment event points into it.
+	 * Return a negative value to have the fragment received into @c buf instead.
+	 * Other transports do not use this.
+	 *
+	 * @param[out] buf Buffer to receive into.
+	 * @param[out] len Length of the buffer.
+	 *
+	 * @return Zero to receive into @p buf, negative otherwise.
+	 */
+	int (*buf_get)(void **buf, size_t *len);
 };
 
 /**
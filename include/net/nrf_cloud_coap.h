@@ -454,6 +454,69 @@ int nrf_cloud_coap_bytes_send(uint8_t *buf, size_t buf_len, bool confirmable);
  */
 int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable);
 
+/** @brief Statistics of the sensor message batching. */
+struct nrf_cloud_coap_batch_stats {
+	/** Number of messages sent in batches. */
+	uint32_t messages;
+	/** Number of batches sent. */
+	uint32_t batches;
+	/** Number of messages dropped, either to make room for newer ones while the batch
+	 *  could not be sent, or because the cloud rejected the batch.
+	 */
+	uint32_t dropped;
+	/** Number of payload bytes sent in batches. */
+	uint32_t bytes_sent;
+	/** Estimated number of bytes on air saved by sending the messages in batches instead
+	 *  of one request per message. See @kconfig{CONFIG_NRF_CLOUD_COAP_BATCH_REQUEST_OVERHEAD}.
+	 */
+	uint32_t bytes_saved;
+};
+
+/**
+ * @brief Add a sensor value to the batch of messages sent to nRF Cloud.
+ *
+ * The value is encoded the same way as by @ref nrf_cloud_coap_sensor_send and kept until the
+ * batch is sent as a CBOR array to the d2c/bulk topic, in a single confirmable CoAP message.
+ * The batch is sent when the next value does not fit in it, when it holds
+ * @kconfig{CONFIG_NRF_CLOUD_COAP_BATCH_MAX_MESSAGES} messages, when its oldest value has waited
+ * for @kconfig{CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE} seconds, or when
+ * @ref nrf_cloud_coap_batch_flush is called.
+ * If the full batch cannot be sent, the oldest values are dropped to make room for the new one.
+ *
+ * @param[in]     app_id The app ID identifying the type of data. See the values
+ *                       that begin with NRF_CLOUD_JSON_APPID_ in nrf_cloud_defs.h. You may
+ *                       also use custom names.
+ * @param[in]     value  Sensor reading.
+ * @param[in]     ts_ms  Timestamp the data was measured, or NRF_CLOUD_NO_TIMESTAMP to use the
+ *                       current time.
+ *
+ * @retval 0 The value was added to the batch.
+ * @retval -EINVAL Invalid app ID.
+ * @retval -E2BIG The encoded value does not fit in the batch buffer.
+ */
+int nrf_cloud_coap_batch_sensor_add(const char *app_id, double value, int64_t ts_ms);
+
+/**
+ * @brief Send the batch of messages to nRF Cloud.
+ *
+ * On a device-side error, the messages are kept and sent with the next batch.
+ * If the cloud rejects the batch, its messages are dropped.
+ *
+ * @retval 0 The batch was sent or was empty.
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @return Negative values are device-side errors defined in errno.h.
+ *         Positive values are cloud-side errors (CoAP result codes)
+ *         defined in zephyr/net/coap.h.
+ */
+int nrf_cloud_coap_batch_flush(void);
+
+/**
+ * @brief Get the statistics of the sensor message batching.
+ *
+ * @param[out]    stats Statistics since boot.
+ */
+void nrf_cloud_coap_batch_stats_get(struct nrf_cloud_coap_batch_stats *stats);
+
 /** @} */
 
 #ifdef __cplusplus
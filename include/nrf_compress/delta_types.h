@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ * @brief Delta API types for compression/decompression subsystem
+ *
+ * A delta patch describes the target image as operations on a source image, which is
+ * the image that is already on the device:
+ *
+ * - Header: magic "NDLT", source image size and target image size, both 32-bit little-endian.
+ * - Operations, each an opcode byte followed by a LEB128 encoded argument:
+ *   - COPY n: copy n bytes from the source position.
+ *   - ADD n: n bytes follow, each added to the byte at the source position.
+ *   - INSERT n: n bytes follow, which are output as is.
+ *   - SEEK d: move the source position by d, zigzag encoded.
+ *
+ * COPY and ADD advance the source position by n.
+ * Patches are created with the scripts/nrf_compress/delta.py script.
+ */
+
+#ifndef NRF_COMPRESS_DELTA_TYPES_H_
+#define NRF_COMPRESS_DELTA_TYPES_H_
+
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Size of the delta patch header. */
+#define DELTA_HEADER_SIZE 12
+
+/** Delta patch operations. */
+enum delta_op {
+	DELTA_OP_COPY,
+	DELTA_OP_ADD,
+	DELTA_OP_INSERT,
+	DELTA_OP_SEEK,
+};
+
+/**
+ * @typedef		delta_source_read_func_t
+ * @brief		Read source image interface.
+ *
+ * @param[in]		pos Position of the source image to start reading from.
+ * @param[in]		data Data buffer to read into.
+ * @param[in]		len Length of @a data buffer, number of bytes to read.
+ *
+ * @retval		Number of bytes read from the source image (length).
+ */
+typedef size_t (*delta_source_read_func_t)(size_t pos, uint8_t *data, size_t len);
+
+/**
+ * @brief This is an initialization context struct type. Instantionize and pass it to
+ * interface functions like for e.g. nrf_compress_init_func_t, nrf_compress_decompress_func_t.
+ */
+typedef struct delta_codec_t {
+	/** Function that reads the source image, for example from the primary slot. */
+	const delta_source_read_func_t read;
+	/** Size of the source image, the patch is rejected if it was made for another size. */
+	const size_t source_size;
+} delta_codec;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_COMPRESS_DELTA_TYPES_H_ */
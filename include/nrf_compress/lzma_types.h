@@ -59,6 +59,9 @@ typedef size_t (*lzma_dictionary_write_func_t)(size_t pos, const uint8_t *data,
  * @typedef		lzma_dictionary_read_func_t
  * @brief		Read dictionary interface.
  *
+ * With CONFIG_NRF_COMPRESS_DICTIONARY_BACKGROUND_WRITE, it can be called while a write
+ * is in progress in another thread, for a different part of the dictionary.
+ *
  * @param[in]		pos Position of the dictionary to start reading from.
  * @param[in]		data Data buffer to read into.
  * @param[in]		len Length of @a data buffer, number of bytes to read.
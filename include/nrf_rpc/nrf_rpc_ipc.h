@@ -61,6 +61,17 @@ struct nrf_rpc_ipc {
 
 	/** Current transport state. */
 	uint8_t state;
+
+#if defined(CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY) || defined(__DOXYGEN__)
+	/** The IPC Service backend supports the no-copy API. */
+	bool zero_copy;
+
+	/** Shared memory TX buffers that have been allocated, but not sent yet. */
+	const void *tx_bufs[CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY_BUFS];
+
+	/** Lock protecting the @p tx_bufs array. */
+	struct k_spinlock tx_bufs_lock;
+#endif
 };
 
 /** @brief Extern nRF RPC IPC Service transport declaration.
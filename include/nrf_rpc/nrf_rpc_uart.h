@@ -44,6 +44,62 @@ extern "C" {
  */
 extern void nrf_rpc_uart_initialized_hook(const struct device *uart_dev);
 
+/**
+ * @brief nRF RPC UART transport statistics.
+ *
+ * Byte counters include the frame payload only, without the HDLC framing, escaping and CRC.
+ * Latencies are given in microseconds.
+ */
+struct nrf_rpc_uart_stats {
+	/** Number of nRF RPC packets sent. */
+	uint32_t tx_packets;
+	/** Number of frames written to the UART, including retransmissions. */
+	uint32_t tx_frames;
+	/** Number of frame payload bytes written to the UART. */
+	uint32_t tx_bytes;
+	/** Number of frames retransmitted due to an ack timeout. */
+	uint32_t tx_retransmissions;
+	/** Number of frames given up on after all transmission attempts. */
+	uint32_t tx_drops;
+	/** Number of nRF RPC packets received. */
+	uint32_t rx_packets;
+	/** Number of valid frames received. */
+	uint32_t rx_frames;
+	/** Number of payload bytes of valid frames received. */
+	uint32_t rx_bytes;
+	/** Number of frames rejected due to an invalid CRC, format or sequence number. */
+	uint32_t rx_errors;
+	/** Number of duplicate frames rejected. */
+	uint32_t rx_duplicates;
+	/** Time between the last acknowledged frame transmission and its ack. */
+	uint32_t ack_latency_last_us;
+	/** Maximum time between a frame transmission and its ack. */
+	uint32_t ack_latency_max_us;
+	/** Time the last packet spent queued before being put into a frame. */
+	uint32_t queue_latency_last_us;
+	/** Maximum time a packet spent queued before being put into a frame. */
+	uint32_t queue_latency_max_us;
+};
+
+/**
+ * @brief Get the statistics of an nRF RPC UART transport.
+ *
+ * Available when the @kconfig{CONFIG_NRF_RPC_UART_STATS} Kconfig option is enabled.
+ *
+ * @param transport The nRF RPC UART transport, see @ref NRF_RPC_UART_TRANSPORT.
+ * @param[out] stats Statistics snapshot.
+ */
+void nrf_rpc_uart_stats_get(const struct nrf_rpc_tr *transport, struct nrf_rpc_uart_stats *stats);
+
+/**
+ * @brief Reset the statistics of an nRF RPC UART transport.
+ *
+ * Available when the @kconfig{CONFIG_NRF_RPC_UART_STATS} Kconfig option is enabled.
+ *
+ * @param transport The nRF RPC UART transport, see @ref NRF_RPC_UART_TRANSPORT.
+ */
+void nrf_rpc_uart_stats_reset(const struct nrf_rpc_tr *transport);
+
 /**
  * @}
  */
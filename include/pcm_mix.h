@@ -35,7 +35,7 @@ enum pcm_mix_mode {
  * @note Uses simple addition with hard clip protection.
  * Input can be mono or stereo as long as the inputs match.
  * By selecting the mix mode, mono can also be mixed into a stereo buffer.
- * Hard coded for the signed 16-bit PCM.
+ * Hard coded for the signed 16-bit PCM. Use @ref pcm_mix_ext for other bit depths.
  *
  * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
  * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
@@ -44,7 +44,8 @@ enum pcm_mix_mode {
  * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
  *
  * @retval 0            Success. Result stored in pcm_a.
- * @retval -EINVAL      pcm_a is NULL or size_a = 0.
+ * @retval -EINVAL      pcm_a is NULL, size_a = 0 or a buffer size is odd, that is, not a
+ *			multiple of the 2-byte sample size.
  * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
  *			or size_a/2 < size_b (for mono to stereo mix).
  * @retval -ESRCH       Invalid mixing mode.
@@ -52,6 +53,31 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of PCM data with the given bit depth.
+ *
+ * @note Uses saturating addition. On cores with the DSP extension, the
+ * SIMD and saturation instructions are used.
+ * Samples with 24-bit depth are packed into 3 bytes, little-endian.
+ * Buffer sizes must be a multiple of the sample size.
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
+ * @param pcm_bit_depth [in]     Bit depth of PCM samples (16, 24, or 32).
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL, size_a = 0, invalid bit depth or buffer size
+ *			is not a multiple of the sample size.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_ext(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth);
+
 /**
  * @}
  */
@@ -22,6 +22,7 @@
 #ifdef CONFIG_SAMPLE_RATE_CONVERTER
 #include <zephyr/sys/ring_buffer.h>
 #include <dsp/filtering_functions.h>
+#include <zephyr/sys/util.h>
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER */
 
 /**
@@ -33,11 +34,24 @@
  *	Decimation:
  *		(number of filter taps / conversion ratio) + block size - 1
  *
- * The equation for interpolation is used as size as this gives the largest number.
+ *	Polyphase:
+ *		number of filter taps per phase + block size - 1
+ *
+ * The largest of the equations is used as size.
  */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+#define SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE                                                    \
+	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX +                                             \
+	 MAX(CONFIG_SAMPLE_RATE_CONVERTER_MAX_FILTER_SIZE,                                         \
+	     CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS_PER_PHASE) -                              \
+	 1)
+#else
 #define SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE                                                    \
 	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX +                                             \
 	 CONFIG_SAMPLE_RATE_CONVERTER_MAX_FILTER_SIZE - 1)
+#endif
+
+struct sample_rate_converter_polyphase_filter;
 
 /** Filter types supported by the sample rate converter */
 enum sample_rate_converter_filter {
@@ -94,6 +108,17 @@ struct sample_rate_converter_ctx {
 	 */
 	int conversion_ratio;
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	/* Polyphase filter used for the current conversion, NULL if the conversion ratio is an
+	 * integer. The conversion ratio is 0 when the polyphase filter is used.
+	 */
+	const struct sample_rate_converter_polyphase_filter *polyphase_filter;
+
+	/* Filter phase and input sample index of the next output sample. */
+	uint16_t polyphase_phase;
+	uint16_t polyphase_index;
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 	/* Filter type to be used for the conversion. */
 	enum sample_rate_converter_filter filter_type;
 
@@ -116,7 +141,8 @@ struct sample_rate_converter_ctx {
 	};
 
 	/* State buffers used by the CMSIS DSP filters to keep history of the stream between process
-	 * calls.
+	 * calls. The polyphase filter uses the same buffer for the input history followed by the
+	 * current block.
 	 */
 #ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
 	q15_t state_buf_15[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
@@ -151,6 +177,11 @@ int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx);
  *		based on the conversion ratio, the module will buffer both input and output bytes
  *		when needed to meet this criteria.
  *
+ *		With CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE, conversions between 44.1 kHz or
+ *		32 kHz and 48 kHz are also supported. For these, the number of output samples
+ *		can vary by one between calls, and the output buffer must be able to hold
+ *		the input size multiplied by the conversion ratio, rounded up.
+ *
  * @param[in,out]	ctx			Pointer to the sample rate conversion context.
  * @param[in]		filter			Filter type to be used for the conversion.
  * @param[in]		input			Pointer to samples to process.
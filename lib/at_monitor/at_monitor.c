@@ -13,10 +13,18 @@
 #include <zephyr/toolchain.h>
 #include <zephyr/logging/log.h>
 
+#if CONFIG_AT_MONITOR_MATCHER
+#include "at_monitor_matcher.h"
+#endif
+
 LOG_MODULE_REGISTER(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
 
 struct at_notif_fifo {
 	void *fifo_reserved;
+#if CONFIG_AT_MONITOR_MATCHER
+	bool matched; /* Whether the monitors were matched in the ISR */
+	struct at_monitor_match match; /* Monitors matched in the ISR */
+#endif
 	char data[]; /* Null-terminated AT notification string */
 };
 
@@ -41,6 +49,25 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
 	return (mon->filter == ANY || strstr(notif, mon->filter));
 }
 
+/* Dispatch to a matching monitor if it is direct.
+ * Returns whether the notification must be copied for the monitor.
+ */
+static bool dispatch_direct(const struct at_monitor_entry *mon, const char *notif)
+{
+	if (is_paused(mon)) {
+		return false;
+	}
+
+	if (is_direct(mon)) {
+		LOG_DBG("Dispatching to %p (ISR)", mon->handler);
+		mon->handler(notif);
+		return false;
+	}
+
+	/* Copy and schedule work-queue task */
+	return true;
+}
+
 /* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
  * Keep this function public so that it can be called by tests.
  * This function is called from an ISR.
@@ -48,20 +75,33 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
 void at_monitor_dispatch(const char *notif)
 {
 	bool monitored;
+	bool matched = false;
 	struct at_notif_fifo *at_notif;
 	size_t sz_needed;
 
 	__ASSERT_NO_MSG(notif != NULL);
 
 	monitored = false;
-	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-		if (!is_paused(e) && has_match(e, notif)) {
-			if (is_direct(e)) {
-				LOG_DBG("Dispatching to %p (ISR)", e->handler);
-				e->handler(notif);
-			} else {
-				/* Copy and schedule work-queue task */
-				monitored = true;
+
+#if CONFIG_AT_MONITOR_MATCHER
+	struct at_monitor_match match;
+
+	matched = at_monitor_matcher_match(notif, &match);
+	if (matched) {
+		for (int i = at_monitor_match_next(&match, -1); i >= 0;
+		     i = at_monitor_match_next(&match, i)) {
+			struct at_monitor_entry *e;
+
+			STRUCT_SECTION_GET(at_monitor_entry, i, &e);
+			monitored |= dispatch_direct(e, notif);
+		}
+	}
+#endif
+
+	if (!matched) {
+		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+			if (has_match(e, notif)) {
+				monitored |= dispatch_direct(e, notif);
 			}
 		}
 	}
@@ -81,24 +121,56 @@ void at_monitor_dispatch(const char *notif)
 	}
 
 	strcpy(at_notif->data, notif);
+#if CONFIG_AT_MONITOR_MATCHER
+	at_notif->matched = matched;
+	if (matched) {
+		at_notif->match = match;
+	}
+#endif
 
 	k_fifo_put(&at_monitor_fifo, at_notif);
 	k_work_submit(&at_monitor_work);
 }
 
+static void dispatch(const struct at_monitor_entry *mon, const char *notif)
+{
+	if (!is_paused(mon) && !is_direct(mon)) {
+		LOG_DBG("Dispatching to %p", mon->handler);
+		mon->handler(notif);
+	}
+}
+
 static void at_monitor_task(struct k_work *work)
 {
 	struct at_notif_fifo *at_notif;
+	bool matched = false;
 
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
-		/* Match notification with all monitors */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
-		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
-				LOG_DBG("Dispatching to %p", e->handler);
-				e->handler(at_notif->data);
+
+#if CONFIG_AT_MONITOR_MATCHER
+		/* Reuse the monitors matched in the ISR */
+		matched = at_notif->matched;
+		if (matched) {
+			for (int i = at_monitor_match_next(&at_notif->match, -1); i >= 0;
+			     i = at_monitor_match_next(&at_notif->match, i)) {
+				struct at_monitor_entry *e;
+
+				STRUCT_SECTION_GET(at_monitor_entry, i, &e);
+				dispatch(e, at_notif->data);
+			}
+		}
+#endif
+
+		if (!matched) {
+			/* Match notification with all monitors */
+			STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+				if (has_match(e, at_notif->data)) {
+					dispatch(e, at_notif->data);
+				}
 			}
 		}
+
 		k_heap_free(&at_monitor_heap, at_notif);
 	}
 }
@@ -107,6 +179,13 @@ static int at_monitor_sys_init(void)
 {
 	int err;
 
+#if CONFIG_AT_MONITOR_MATCHER
+	err = at_monitor_matcher_init();
+	if (err) {
+		LOG_WRN("Matching every monitor in turn, err %d", err);
+	}
+#endif
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Aho-Corasick automaton over the filters of all monitors.
+ *
+ * The filters are stored in a trie. Every node has a failure link to the node of the longest
+ * proper suffix of its string that is also in the trie, and an output link to the nearest node
+ * on the failure chain that ends a filter. A notification is matched against all filters in a
+ * single pass, in time proportional to its length and the number of matched monitors.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <modem/at_monitor.h>
+#include <zephyr/logging/log.h>
+
+#include "at_monitor_matcher.h"
+
+LOG_MODULE_DECLARE(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
+
+#define ROOT 0
+#define NONE UINT16_MAX
+
+BUILD_ASSERT(CONFIG_AT_MONITOR_MATCHER_NODES < NONE);
+
+struct node {
+	/* Character on the edge from the parent */
+	char c;
+	/* Length of the string of the node */
+	uint8_t depth;
+	/* First child */
+	uint16_t child;
+	/* Next child of the parent */
+	uint16_t sibling;
+	/* Failure link */
+	uint16_t fail;
+	/* Nearest node on the failure chain that ends a filter */
+	uint16_t output;
+	/* First monitor whose filter ends in this node */
+	uint16_t monitor;
+};
+
+static struct node nodes[CONFIG_AT_MONITOR_MATCHER_NODES];
+static uint16_t node_cnt;
+/* Next monitor with the same filter */
+static uint16_t monitor_next[CONFIG_AT_MONITOR_MATCHER_MONITORS];
+static size_t monitor_cnt;
+/* Monitors that receive every notification */
+static struct at_monitor_match match_any;
+static bool ready;
+
+static void match_set(struct at_monitor_match *match, uint16_t monitor)
+{
+	match->bits[monitor / 32] |= BIT(monitor % 32);
+}
+
+static uint16_t child_find(uint16_t n, char c)
+{
+	for (uint16_t k = nodes[n].child; k != NONE; k = nodes[k].sibling) {
+		if (nodes[k].c == c) {
+			return k;
+		}
+	}
+
+	return NONE;
+}
+
+static uint16_t node_add(uint16_t parent, char c)
+{
+	uint16_t n;
+
+	if (node_cnt == ARRAY_SIZE(nodes) || nodes[parent].depth == UINT8_MAX) {
+		return NONE;
+	}
+
+	n = node_cnt++;
+	nodes[n] = (struct node){
+		.c = c,
+		.depth = nodes[parent].depth + 1,
+		.child = NONE,
+		.sibling = nodes[parent].child,
+		.fail = ROOT,
+		.output = NONE,
+		.monitor = NONE,
+	};
+	nodes[parent].child = n;
+
+	return n;
+}
+
+static int filter_add(const char *filter, uint16_t monitor)
+{
+	uint16_t n = ROOT;
+
+	for (; *filter != '\0'; filter++) {
+		uint16_t next = child_find(n, *filter);
+
+		if (next == NONE) {
+			next = node_add(n, *filter);
+			if (next == NONE) {
+				return -ENOMEM;
+			}
+		}
+		n = next;
+	}
+
+	monitor_next[monitor] = nodes[n].monitor;
+	nodes[n].monitor = monitor;
+
+	return 0;
+}
+
+static void links_set(uint8_t depth_max)
+{
+	/* The links of a node point to shallower nodes, so set them level by level.
+	 * The children of the root keep the root as failure link.
+	 */
+	for (uint8_t depth = 1; depth < depth_max; depth++) {
+		for (uint16_t n = 1; n < node_cnt; n++) {
+			if (nodes[n].depth != depth) {
+				continue;
+			}
+
+			for (uint16_t k = nodes[n].child; k != NONE; k = nodes[k].sibling) {
+				uint16_t f = nodes[n].fail;
+				uint16_t g;
+
+				while ((g = child_find(f, nodes[k].c)) == NONE && f != ROOT) {
+					f = nodes[f].fail;
+				}
+
+				nodes[k].fail = (g == NONE) ? ROOT : g;
+				nodes[k].output = (nodes[nodes[k].fail].monitor != NONE)
+							  ? nodes[k].fail
+							  : nodes[nodes[k].fail].output;
+			}
+		}
+	}
+}
+
+int at_monitor_matcher_init(void)
+{
+	uint8_t depth_max = 0;
+	int err;
+
+	ready = false;
+	memset(&match_any, 0, sizeof(match_any));
+	nodes[ROOT] = (struct node){
+		.child = NONE,
+		.sibling = NONE,
+		.fail = ROOT,
+		.output = NONE,
+		.monitor = NONE,
+	};
+	node_cnt = 1;
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &monitor_cnt);
+	if (monitor_cnt > CONFIG_AT_MONITOR_MATCHER_MONITORS) {
+		LOG_WRN("%zu monitors, matcher supports %d", monitor_cnt,
+			CONFIG_AT_MONITOR_MATCHER_MONITORS);
+		return -E2BIG;
+	}
+
+	for (size_t i = 0; i < monitor_cnt; i++) {
+		struct at_monitor_entry *e;
+
+		STRUCT_SECTION_GET(at_monitor_entry, i, &e);
+
+		if (e->filter == ANY || e->filter[0] == '\0') {
+			match_set(&match_any, (uint16_t)i);
+			continue;
+		}
+
+		err = filter_add(e->filter, (uint16_t)i);
+		if (err) {
+			LOG_WRN("Filters do not fit in %d matcher nodes",
+				CONFIG_AT_MONITOR_MATCHER_NODES);
+			return err;
+		}
+	}
+
+	for (uint16_t n = 1; n < node_cnt; n++) {
+		depth_max = MAX(depth_max, nodes[n].depth);
+	}
+
+	links_set(depth_max);
+
+	LOG_DBG("%zu monitors compiled into %u nodes", monitor_cnt, node_cnt);
+
+	ready = true;
+
+	return 0;
+}
+
+bool at_monitor_matcher_match(const char *notif, struct at_monitor_match *match)
+{
+	uint16_t n = ROOT;
+
+	if (!ready) {
+		return false;
+	}
+
+	*match = match_any;
+
+	for (; *notif != '\0'; notif++) {
+		uint16_t next;
+
+		while ((next = child_find(n, *notif)) == NONE && n != ROOT) {
+			n = nodes[n].fail;
+		}
+
+		n = (next == NONE) ? ROOT : next;
+
+		for (uint16_t o = (nodes[n].monitor != NONE) ? n : nodes[n].output; o != NONE;
+		     o = nodes[o].output) {
+			for (uint16_t m = nodes[o].monitor; m != NONE; m = monitor_next[m]) {
+				match_set(match, m);
+			}
+		}
+	}
+
+	return true;
+}
+
+int at_monitor_match_next(const struct at_monitor_match *match, int prev)
+{
+	size_t i = prev + 1;
+
+	while (i < monitor_cnt) {
+		uint32_t word = match->bits[i / 32] >> (i % 32);
+
+		if (word) {
+			i += u32_count_trailing_zeros(word);
+			return (i < monitor_cnt) ? (int)i : -1;
+		}
+
+		i = ROUND_UP(i + 1, 32);
+	}
+
+	return -1;
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef AT_MONITOR_MATCHER_H_
+#define AT_MONITOR_MATCHER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+/* Set of monitors, indexed by their position in the at_monitor_entry section */
+struct at_monitor_match {
+	uint32_t bits[DIV_ROUND_UP(CONFIG_AT_MONITOR_MATCHER_MONITORS, 32)];
+};
+
+/**
+ * @brief Compile the filters of all monitors into the matcher.
+ *
+ * @retval 0 On success.
+ * @retval -E2BIG There are more monitors than the matcher supports.
+ * @retval -ENOMEM The filters need more nodes than the matcher has.
+ */
+int at_monitor_matcher_init(void);
+
+/**
+ * @brief Find the monitors whose filter matches a notification.
+ *
+ * Paused monitors are included, the caller checks the monitor state.
+ *
+ * @param notif The AT notification.
+ * @param match Monitors whose filter matches.
+ *
+ * @return true if @p match is valid, false if the matcher is not initialized.
+ */
+bool at_monitor_matcher_match(const char *notif, struct at_monitor_match *match);
+
+/**
+ * @brief Get the next monitor in a match set.
+ *
+ * @param match The match set.
+ * @param prev Index of the previous monitor, or -1 to get the first one.
+ *
+ * @return Index of the next monitor, or -1 if there are no more.
+ */
+int at_monitor_match_next(const struct at_monitor_match *match, int prev);
+
+#endif /* AT_MONITOR_MATCHER_H_ */
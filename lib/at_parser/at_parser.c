@@ -240,6 +240,7 @@ static int at_parser_seek(struct at_parser *parser, size_t index, struct at_toke
 		/* Rewind parser. */
 		parser->cursor = parser->at;
 		parser->count = 0;
+		parser->is_next_empty = false;
 	}
 
 	do {
@@ -249,6 +250,47 @@ static int at_parser_seek(struct at_parser *parser, size_t index, struct at_toke
 	return err;
 }
 
+/* Tokenize the current AT command line into the token array of the AT parser. */
+static void at_parser_index(struct at_parser *parser)
+{
+	struct at_token token;
+
+	parser->cursor = parser->at;
+	parser->count = 0;
+	parser->is_next_empty = false;
+
+	/* Stop at the end of the line, at a malformed value, or when the array is full.
+	 * In all cases, the parser state is left after the last stored value so that
+	 * `at_parser_seek` resumes from there for the values that are not stored.
+	 */
+	while (parser->count < parser->tokens_size && !at_parser_tok(parser, &token)) {
+		parser->tokens[parser->count - 1] = (struct at_parser_token){
+			.start = token.start,
+			.len = token.len,
+			.type = token.type,
+		};
+	}
+
+	parser->tokens_count = parser->count;
+}
+
+/* Get the token at the given index, from the token array if it is stored there. */
+static int at_parser_token_get(struct at_parser *parser, size_t index, struct at_token *token)
+{
+	if (index < parser->tokens_count) {
+		const struct at_parser_token *stored = &parser->tokens[index];
+
+		token->start = stored->start;
+		token->len = stored->len;
+		token->type = stored->type;
+		token->var = AT_TOKEN_VAR_NO_COMMA;
+
+		return 0;
+	}
+
+	return at_parser_seek(parser, index, token);
+}
+
 int at_parser_init(struct at_parser *parser, const char *at)
 {
 	if (!parser || !at) {
@@ -264,6 +306,28 @@ int at_parser_init(struct at_parser *parser, const char *at)
 	return 0;
 }
 
+int at_parser_indexed_init(struct at_parser *parser, const char *at,
+			   struct at_parser_token *tokens, size_t tokens_size)
+{
+	int err;
+
+	if (!tokens || tokens_size == 0) {
+		return -EINVAL;
+	}
+
+	err = at_parser_init(parser, at);
+	if (err) {
+		return err;
+	}
+
+	parser->tokens = tokens;
+	parser->tokens_size = tokens_size;
+
+	at_parser_index(parser);
+
+	return 0;
+}
+
 int at_parser_cmd_next(struct at_parser *parser)
 {
 	int err;
@@ -291,6 +355,10 @@ int at_parser_cmd_next(struct at_parser *parser)
 	 */
 	parser->at = parser->cursor;
 
+	if (parser->tokens) {
+		at_parser_index(parser);
+	}
+
 	return 0;
 }
 
@@ -365,7 +433,7 @@ static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *
 		return err;
 	}
 
-	err = at_parser_seek(parser, index, &token);
+	err = at_parser_token_get(parser, index, &token);
 	if (err) {
 		return err;
 	}
@@ -484,7 +552,7 @@ static int at_parser_string_common_get_impl(struct at_parser *parser, size_t ind
 		return err;
 	}
 
-	err = at_parser_seek(parser, index, &token);
+	err = at_parser_token_get(parser, index, &token);
 	if (err) {
 		return err;
 	}
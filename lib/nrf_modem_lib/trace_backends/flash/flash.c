@@ -15,6 +15,7 @@
 #include <zephyr/logging/log.h>
 
 #include <modem/trace_backend.h>
+#include <modem/nrf_modem_lib_trace.h>
 
 LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
@@ -27,6 +28,12 @@ LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 #endif
 
 #define BUF_SIZE		CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD)
+/* Traces are collected in one half while the other half is written to flash */
+#define RAM_BUF_SIZE		(2 * BUF_SIZE)
+#else
+#define RAM_BUF_SIZE		BUF_SIZE
+#endif
 #define TRACE_MAGIC_INITIALIZED 0x152ac523
 #define PEEK_AT_OFFSET_MAGIC	0x153ac522
 
@@ -52,7 +59,7 @@ struct flash_backend_state {
 	struct flash_sector *sector;
 	size_t trace_bytes_unread;
 	size_t flash_buf_written;
-	uint8_t flash_buf[BUF_SIZE];
+	uint8_t flash_buf[RAM_BUF_SIZE];
 };
 
 struct peek_at_cache {
@@ -69,6 +76,37 @@ static bool is_initialized;
 static struct k_sem fcb_sem;
 static struct peek_at_cache peek_at_cache;
 
+/* Protects the RAM buffer and the unread byte count, which the trace thread updates while the
+ * FCB is in use. Take fcb_sem first when both are needed.
+ */
+static K_MUTEX_DEFINE(buf_lock);
+
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_STATS)
+static struct nrf_modem_lib_trace_flash_stats stats;
+static struct k_spinlock stats_lock;
+
+#define STATS_ADD(field, n)                                                                        \
+	do {                                                                                       \
+		k_spinlock_key_t key = k_spin_lock(&stats_lock);                                   \
+		stats.field += (n);                                                                \
+		k_spin_unlock(&stats_lock, key);                                                   \
+	} while (0)
+#else
+#define STATS_ADD(...)
+#endif
+
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD)
+#define WRITE_THREAD_PRIORITY                                                                      \
+	COND_CODE_1(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD_PRIO_OVERRIDE,           \
+		    (CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD_PRIO),                  \
+		    (K_LOWEST_APPLICATION_THREAD_PRIO))
+
+static K_SEM_DEFINE(flush_sem, 0, 1);
+static K_SEM_DEFINE(space_sem, 0, 1);
+/* Result of the last flush in the write thread */
+static int flush_err;
+#endif
+
 static inline void peek_at_cache_set(size_t offset, struct fcb_entry *entry, size_t in_entry_offset)
 {
 	peek_at_cache.magic = PEEK_AT_OFFSET_MAGIC;
@@ -91,10 +129,30 @@ static inline bool peek_at_cache_is_valid(void)
 	return magic_valid && entry_valid;
 }
 
+static inline void trace_bytes_unread_sub(size_t len)
+{
+	k_mutex_lock(&buf_lock, K_FOREVER);
+	backend_state.trace_bytes_unread -= len;
+	k_mutex_unlock(&buf_lock);
+}
+
+static inline size_t trace_bytes_unread_get(void)
+{
+	size_t unread;
+
+	k_mutex_lock(&buf_lock, K_FOREVER);
+	unread = backend_state.trace_bytes_unread;
+	k_mutex_unlock(&buf_lock);
+
+	return unread;
+}
+
 static size_t buffer_append(const void *data, size_t len)
 {
 	size_t append_len;
 
+	k_mutex_lock(&buf_lock, K_FOREVER);
+
 	append_len = MIN(len, sizeof(backend_state.flash_buf) - backend_state.flash_buf_written);
 
 	memcpy(&backend_state.flash_buf[backend_state.flash_buf_written], data, append_len);
@@ -102,17 +160,76 @@ static size_t buffer_append(const void *data, size_t len)
 	backend_state.flash_buf_written += append_len;
 	backend_state.trace_bytes_unread += append_len;
 
+	k_mutex_unlock(&buf_lock);
+
 	return append_len;
 }
 
+static size_t buffer_level_get(void)
+{
+	size_t level;
+
+	k_mutex_lock(&buf_lock, K_FOREVER);
+	level = backend_state.flash_buf_written;
+	k_mutex_unlock(&buf_lock);
+
+	return level;
+}
+
+/* Remove bytes written to flash from the start of the RAM buffer */
+static void buffer_consume(size_t len)
+{
+	k_mutex_lock(&buf_lock, K_FOREVER);
+
+	backend_state.flash_buf_written -= len;
+	memmove(backend_state.flash_buf, &backend_state.flash_buf[len],
+		backend_state.flash_buf_written);
+
+	k_mutex_unlock(&buf_lock);
+}
+
+/* Space taken in flash by an FCB entry, the length field is at most two bytes */
+static size_t fcb_entry_size(size_t len)
+{
+	size_t align = MAX(trace_fcb.f_align, 1);
+
+	return ROUND_UP(2, align) + ROUND_UP(len, align) + ROUND_UP(1, align);
+}
+
+/* Number of buffered bytes to write in the next FCB entry.
+ * An entry that does not fit in the rest of the active sector would leave that space unused
+ * until the sector is erased. Fill the rest of the sector instead, so that more traces are
+ * stored for each sector erase. The remaining bytes go in the next entry.
+ */
+static size_t flush_len_get(size_t level)
+{
+	size_t len = MIN(level, BUF_SIZE);
+	size_t align = MAX(trace_fcb.f_align, 1);
+	size_t sector_left;
+
+	if (trace_fcb.f_active.fe_sector == NULL) {
+		return len;
+	}
+
+	sector_left = trace_fcb.f_active.fe_sector->fs_size - trace_fcb.f_active.fe_elem_off;
+
+	if (fcb_entry_size(len) > sector_left && sector_left > fcb_entry_size(align)) {
+		len = ROUND_DOWN(sector_left - fcb_entry_size(0), align);
+	}
+
+	return len;
+}
+
 static int fcb_walk_callback(struct fcb_entry_ctx *loc_ctx, void *arg)
 {
+	size_t *unread = arg;
+
 	if ((loc_ctx->loc.fe_sector == backend_state.sector) &&
 	    (loc_ctx->loc.fe_elem_off < backend_state.loc.fe_elem_off)) {
 		return 0;
 	}
 
-	backend_state.trace_bytes_unread -= loc_ctx->loc.fe_data_len;
+	*unread += loc_ctx->loc.fe_data_len;
 
 	return 0;
 }
@@ -120,19 +237,27 @@ static int fcb_walk_callback(struct fcb_entry_ctx *loc_ctx, void *arg)
 static int buffer_flush_to_flash(void)
 {
 	int err;
+	size_t len;
+	size_t level;
+	size_t unread = 0;
 	struct fcb_entry loc_flush;
 
 	if (!is_initialized) {
 		return -EPERM;
 	}
 
-	if (!backend_state.flash_buf_written) {
-		return -ENODATA;
+	k_sem_take(&fcb_sem, K_FOREVER);
+
+	/* Checked with the FCB taken, a read or clear can have emptied the buffer */
+	level = buffer_level_get();
+	if (!level) {
+		err = -ENODATA;
+		goto out;
 	}
 
-	k_sem_take(&fcb_sem, K_FOREVER);
+	len = flush_len_get(level);
 
-	err = fcb_append(&trace_fcb, backend_state.flash_buf_written, &loc_flush);
+	err = fcb_append(&trace_fcb, len, &loc_flush);
 	if (err) {
 		if (IS_ENABLED(CONFIG_NRF_MODEM_TRACE_FLASH_NOSPACE_ERASE_OLDEST)) {
 			/* Find the number of trace bytes in oldest sector (that is not read). */
@@ -143,7 +268,7 @@ static int buffer_flush_to_flash(void)
 			err = fcb_getnext(&trace_fcb, &loc_flush);
 
 			/* Walk sector to remove unread trace data from count. */
-			err = fcb_walk(&trace_fcb, loc_flush.fe_sector, fcb_walk_callback, NULL);
+			err = fcb_walk(&trace_fcb, loc_flush.fe_sector, fcb_walk_callback, &unread);
 			if (err) {
 				LOG_ERR("fcb_walk failed, err %d", err);
 				goto out;
@@ -156,7 +281,11 @@ static int buffer_flush_to_flash(void)
 				goto out;
 			}
 
-			err = fcb_append(&trace_fcb, backend_state.flash_buf_written, &loc_flush);
+			trace_bytes_unread_sub(unread);
+			STATS_ADD(sectors_erased, 1);
+			STATS_ADD(bytes_dropped, unread);
+
+			err = fcb_append(&trace_fcb, len, &loc_flush);
 
 			peek_at_cache_invalidate();
 		}
@@ -170,9 +299,11 @@ static int buffer_flush_to_flash(void)
 		}
 	}
 
+	/* The trace thread only appends after the bytes being written, so the RAM buffer is not
+	 * locked while the flash is busy.
+	 */
 	err = flash_area_write(
-		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), backend_state.flash_buf,
-		backend_state.flash_buf_written);
+		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), backend_state.flash_buf, len);
 	if (err) {
 		LOG_ERR("flash_area_write failed, err %d", err);
 
@@ -186,7 +317,10 @@ static int buffer_flush_to_flash(void)
 		goto out;
 	}
 
-	backend_state.flash_buf_written = 0;
+	buffer_consume(len);
+
+	STATS_ADD(bytes_stored, len);
+	STATS_ADD(flash_bytes_written, fcb_entry_size(len));
 
 out:
 	k_sem_give(&fcb_sem);
@@ -194,6 +328,74 @@ out:
 	return err;
 }
 
+/* Write the full entries in the RAM buffer */
+static int buffer_flush_full(void)
+{
+	int err = 0;
+
+	while (!err && buffer_level_get() >= BUF_SIZE) {
+		err = buffer_flush_to_flash();
+	}
+
+	/* The buffer can have been read or cleared in the meantime */
+	return (err == -ENODATA) ? 0 : err;
+}
+
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD)
+static void flash_write_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&flush_sem, K_FOREVER);
+
+		flush_err = buffer_flush_full();
+
+		k_sem_give(&space_sem);
+	}
+}
+
+K_THREAD_DEFINE(trace_flash_write_thread,
+		CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD_STACK_SIZE,
+		flash_write_thread, NULL, NULL, NULL, WRITE_THREAD_PRIORITY, 0, 0);
+#endif
+
+/* Write buffered traces to flash when a full entry is buffered.
+ * With the write thread, only wait for it when all of the RAM buffer is in use.
+ */
+static int buffer_flush(void)
+{
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD)
+	size_t level = buffer_level_get();
+
+	if (level < BUF_SIZE) {
+		return 0;
+	}
+
+	if (level < sizeof(backend_state.flash_buf)) {
+		k_sem_give(&flush_sem);
+
+		return 0;
+	}
+
+	STATS_ADD(write_waits, 1);
+
+	k_sem_reset(&space_sem);
+	k_sem_give(&flush_sem);
+	k_sem_take(&space_sem, K_FOREVER);
+
+	return flush_err;
+#else
+	if (buffer_level_get() < sizeof(backend_state.flash_buf)) {
+		return 0;
+	}
+
+	return buffer_flush_to_flash();
+#endif
+}
+
 static int trace_flash_erase(void)
 {
 	int err;
@@ -292,8 +494,9 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 
 size_t trace_backend_data_size(void)
 {
-	/* Ensure we never report more data than the partition can hold */
-	return MIN(backend_state.trace_bytes_unread, modem_trace_area->fa_size);
+	/* Ensure we never report more data than the partition and the RAM buffer can hold */
+	return MIN(trace_bytes_unread_get(),
+		   modem_trace_area->fa_size + sizeof(backend_state.flash_buf));
 }
 
 /* Read from offset
@@ -314,7 +517,7 @@ static int read_from_offset(void *buf, size_t len)
 		return err;
 	}
 
-	backend_state.trace_bytes_unread -= to_read;
+	trace_bytes_unread_sub(to_read);
 
 	backend_state.read_offset += to_read;
 	if (backend_state.read_offset >= backend_state.loc.fe_data_len) {
@@ -338,6 +541,11 @@ int trace_backend_read(void *buf, size_t len)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD)) {
+		/* Read the same as without the write thread, where full entries are in flash */
+		(void)buffer_flush_full();
+	}
+
 	k_sem_take(&fcb_sem, K_FOREVER);
 
 	if (backend_state.read_offset != 0 && backend_state.loc.fe_sector) {
@@ -347,7 +555,7 @@ int trace_backend_read(void *buf, size_t len)
 	}
 
 	err = fcb_getnext(&trace_fcb, &backend_state.loc);
-	if (err == -ENOTSUP && !backend_state.flash_buf_written) {
+	if (err == -ENOTSUP && !buffer_level_get()) {
 		/* Nothing to read */
 		backend_state.loc.fe_sector = 0;
 		backend_state.loc.fe_elem_off = 0;
@@ -357,7 +565,9 @@ int trace_backend_read(void *buf, size_t len)
 		err = -ENODATA;
 
 		goto out;
-	} else if (err == -ENOTSUP && backend_state.flash_buf_written) {
+	} else if (err == -ENOTSUP) {
+		k_mutex_lock(&buf_lock, K_FOREVER);
+
 		to_read = MIN(backend_state.flash_buf_written, len);
 
 		memcpy(buf, backend_state.flash_buf, to_read);
@@ -371,6 +581,8 @@ int trace_backend_read(void *buf, size_t len)
 		backend_state.flash_buf_written -= to_read;
 		backend_state.trace_bytes_unread -= to_read;
 
+		k_mutex_unlock(&buf_lock);
+
 		err = to_read;
 
 		goto out;
@@ -394,6 +606,7 @@ out:
 			return ret;
 		}
 
+		STATS_ADD(sectors_erased, 1);
 		peek_at_cache_invalidate();
 		k_sem_give(&trace_clear_sem);
 	}
@@ -425,10 +638,14 @@ int trace_backend_peek_at(size_t offset, void *buf, size_t len)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD)) {
+		(void)buffer_flush_full();
+	}
+
 	(void)k_sem_take(&fcb_sem, K_FOREVER);
 
 	/* Fail early if requested offset is beyond available. */
-	if (read_offset >= backend_state.trace_bytes_unread) {
+	if (read_offset >= trace_bytes_unread_get()) {
 		k_sem_give(&fcb_sem);
 
 		return -EFAULT;
@@ -503,6 +720,8 @@ int trace_backend_peek_at(size_t offset, void *buf, size_t len)
 	}
 
 	/* After exhausting FCB, continue into RAM buffer if present. */
+	k_mutex_lock(&buf_lock, K_FOREVER);
+
 	if (backend_state.flash_buf_written > 0 && (backend_state.flash_buf_written > skip)) {
 		size_t size_available = backend_state.flash_buf_written - skip;
 		size_t size_to_read = MIN(size_available, len - copied);
@@ -512,6 +731,8 @@ int trace_backend_peek_at(size_t offset, void *buf, size_t len)
 		copied += size_to_read;
 	}
 
+	k_mutex_unlock(&buf_lock);
+
 	k_sem_give(&fcb_sem);
 
 	if (copied == 0) {
@@ -547,8 +768,8 @@ static int stream_write(const void *buf, size_t len)
 		written = buffer_append(&bytes[len - bytes_left], bytes_left);
 		written_total += written;
 
-		if (backend_state.flash_buf_written >= sizeof(backend_state.flash_buf)) {
-			ret = buffer_flush_to_flash();
+		if (buffer_level_get() >= BUF_SIZE) {
+			ret = buffer_flush();
 			if (ret) {
 				LOG_ERR("buffer_flush_to_flash error %d", ret);
 
@@ -606,11 +827,15 @@ int trace_backend_clear(void)
 	LOG_DBG("Clearing trace storage");
 
 	err = fcb_clear(&trace_fcb);
+	STATS_ADD(sectors_erased, trace_fcb.f_sector_cnt);
 
+	k_mutex_lock(&buf_lock, K_FOREVER);
 	backend_state.flash_buf_written = 0;
+	backend_state.trace_bytes_unread = 0;
+	k_mutex_unlock(&buf_lock);
+
 	backend_state.loc.fe_sector = 0;
 	backend_state.loc.fe_elem_off = 0;
-	backend_state.trace_bytes_unread = 0;
 	backend_state.read_offset = 0;
 	backend_state.sector = NULL;
 
@@ -624,7 +849,13 @@ int trace_backend_clear(void)
 
 int trace_backend_deinit(void)
 {
-	buffer_flush_to_flash();
+	int err;
+
+	/* Filling the rest of a sector can take more than one entry */
+	do {
+		err = buffer_flush_to_flash();
+	} while (!err);
+
 	peek_at_cache_invalidate();
 
 	is_initialized = false;
@@ -632,6 +863,23 @@ int trace_backend_deinit(void)
 	return 0;
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_STATS)
+int nrf_modem_lib_trace_flash_stats_get(struct nrf_modem_lib_trace_flash_stats *out)
+{
+	k_spinlock_key_t key;
+
+	if (out == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&stats_lock);
+	*out = stats;
+	k_spin_unlock(&stats_lock, key);
+
+	return 0;
+}
+#endif
+
 struct nrf_modem_lib_trace_backend trace_backend = {
 	.init = trace_backend_init,
 	.deinit = trace_backend_deinit,
@@ -6,130 +6,239 @@
 
 #include <pcm_mix.h>
 
+#include <string.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include <cmsis_core.h>
+#define PCM_MIX_USE_DSP 1
+#else
+#define PCM_MIX_USE_DSP 0
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
-/* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+#define INT24_MAX ((int32_t)BIT_MASK(23))
+#define INT24_MIN (-INT24_MAX - 1)
+
+/* Layout of buffer A samples touched by a single sample of buffer B */
+struct mix_layout {
+	/* Number of buffer A samples per buffer B sample */
+	uint8_t a_step;
+	/* Index of the first buffer A sample to mix into */
+	uint8_t a_offset;
+	/* Number of buffer A samples mixed with a buffer B sample */
+	uint8_t a_cnt;
+};
+
+static const struct mix_layout mix_layouts[] = {
+	[B_STEREO_INTO_A_STEREO] = { .a_step = 1, .a_offset = 0, .a_cnt = 1 },
+	[B_MONO_INTO_A_MONO] = { .a_step = 1, .a_offset = 0, .a_cnt = 1 },
+	[B_MONO_INTO_A_STEREO_LR] = { .a_step = 2, .a_offset = 0, .a_cnt = 2 },
+	[B_MONO_INTO_A_STEREO_L] = { .a_step = 2, .a_offset = 0, .a_cnt = 1 },
+	[B_MONO_INTO_A_STEREO_R] = { .a_step = 2, .a_offset = 1, .a_cnt = 1 },
+};
+
+static inline uint32_t load32(const void *p)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
-	}
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+static inline void store32(void *p, uint32_t v)
+{
+	memcpy(p, &v, sizeof(v));
+}
+
+static inline int16_t add_sat16(int16_t a, int16_t b)
+{
+#if PCM_MIX_USE_DSP
+	return (int16_t)__QADD16((uint16_t)a, (uint16_t)b);
+#else
+	return (int16_t)CLAMP((int32_t)a + b, INT16_MIN, INT16_MAX);
+#endif
+}
+
+static inline int32_t add_sat24(int32_t a, int32_t b)
 {
-	int32_t res;
+#if PCM_MIX_USE_DSP
+	return __SSAT(a + b, 24);
+#else
+	return CLAMP(a + b, INT24_MIN, INT24_MAX);
+#endif
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+static inline int32_t add_sat32(int32_t a, int32_t b)
+{
+#if PCM_MIX_USE_DSP
+	return __QADD(a, b);
+#else
+	return (int32_t)CLAMP((int64_t)a + b, INT32_MIN, INT32_MAX);
+#endif
+}
 
-		hard_limiter(&res);
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_identical_16(int16_t *pcm_a, const int16_t *pcm_b, size_t samples)
+{
+	size_t i = 0;
+
+#if PCM_MIX_USE_DSP
+	/* Two samples per instruction using the packed saturating addition */
+	for (; i + 1 < samples; i += 2) {
+		store32(&pcm_a[i], __QADD16(load32(&pcm_a[i]), load32(&pcm_b[i])));
+	}
+#endif
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+	for (; i < samples; i++) {
+		pcm_a[i] = add_sat16(pcm_a[i], pcm_b[i]);
 	}
 }
 
 /* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+static void pcm_mix_b_mono_into_a_stereo_lr_16(int16_t *pcm_a, const int16_t *pcm_b,
+					       size_t samples)
 {
-	int32_t res;
+	for (size_t i = 0; i < samples; i++) {
+#if PCM_MIX_USE_DSP
+		uint32_t b = (uint16_t)pcm_b[i];
+
+		/* Duplicate the mono sample into both halfwords and mix the frame at once */
+		store32(&pcm_a[i * 2], __QADD16(load32(&pcm_a[i * 2]), __PKHBT(b, b, 16)));
+#else
+		pcm_a[i * 2] = add_sat16(pcm_a[i * 2], pcm_b[i]);
+		pcm_a[i * 2 + 1] = add_sat16(pcm_a[i * 2 + 1], pcm_b[i]);
+#endif
+	}
+}
 
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
-	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+/* Mix mono into one channel of a stereo buffer */
+static void pcm_mix_b_mono_into_a_stereo_ch_16(int16_t *pcm_a, const int16_t *pcm_b,
+					       size_t samples, uint8_t channel)
+{
+	for (size_t i = 0; i < samples; i++) {
+		pcm_a[i * 2 + channel] = add_sat16(pcm_a[i * 2 + channel], pcm_b[i]);
+	}
+}
 
-		hard_limiter(&res);
+static void pcm_mix_16(void *const pcm_a, void const *const pcm_b, size_t size_b,
+		       enum pcm_mix_mode mix_mode)
+{
+	size_t samples = size_b / sizeof(int16_t);
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+	switch (mix_mode) {
+	case B_STEREO_INTO_A_STEREO:
+	case B_MONO_INTO_A_MONO:
+		pcm_mix_identical_16(pcm_a, pcm_b, samples);
+		break;
+	case B_MONO_INTO_A_STEREO_LR:
+		pcm_mix_b_mono_into_a_stereo_lr_16(pcm_a, pcm_b, samples);
+		break;
+	default:
+		pcm_mix_b_mono_into_a_stereo_ch_16(pcm_a, pcm_b, samples,
+						   mix_layouts[mix_mode].a_offset);
+		break;
 	}
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+static inline int32_t load24(const uint8_t *p)
 {
-	int32_t res;
+	uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16);
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
+	/* Sign extend */
+	return (int32_t)(v << 8) >> 8;
+}
 
-		hard_limiter(&res);
+static inline void store24(uint8_t *p, int32_t v)
+{
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+	p[2] = (uint8_t)(v >> 16);
+}
+
+static void pcm_mix_24(uint8_t *pcm_a, const uint8_t *pcm_b, size_t size_b,
+		       enum pcm_mix_mode mix_mode)
+{
+	const struct mix_layout *layout = &mix_layouts[mix_mode];
+	size_t samples = size_b / 3;
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+	for (size_t i = 0; i < samples; i++) {
+		int32_t b = load24(&pcm_b[i * 3]);
+		uint8_t *a = &pcm_a[(i * layout->a_step + layout->a_offset) * 3];
+
+		for (uint8_t j = 0; j < layout->a_cnt; j++, a += 3) {
+			store24(a, add_sat24(load24(a), b));
+		}
 	}
 }
 
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+static void pcm_mix_32(uint8_t *pcm_a, const uint8_t *pcm_b, size_t size_b,
+		       enum pcm_mix_mode mix_mode)
 {
-	int32_t res;
-
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
+	const struct mix_layout *layout = &mix_layouts[mix_mode];
+	size_t samples = size_b / sizeof(int32_t);
 
-		hard_limiter(&res);
+	for (size_t i = 0; i < samples; i++) {
+		int32_t b = (int32_t)load32(&pcm_b[i * sizeof(int32_t)]);
+		uint8_t *a = &pcm_a[(i * layout->a_step + layout->a_offset) * sizeof(int32_t)];
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+		for (uint8_t j = 0; j < layout->a_cnt; j++, a += sizeof(int32_t)) {
+			store32(a, (uint32_t)add_sat32((int32_t)load32(a), b));
+		}
 	}
 }
 
-int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
-	    enum pcm_mix_mode mix_mode)
+int pcm_mix_ext(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth)
 {
 	if (pcm_a == NULL || size_a == 0) {
 		return -EINVAL;
 	}
 
+	if (pcm_bit_depth != 16 && pcm_bit_depth != 24 && pcm_bit_depth != 32) {
+		LOG_ERR("Invalid bit depth: %d", pcm_bit_depth);
+		return -EINVAL;
+	}
+
 	if (pcm_b == NULL || size_b == 0) {
 		/* Nothing to mix, returning */
 		return 0;
 	}
 
-	switch (mix_mode) {
-	case B_STEREO_INTO_A_STEREO:
-		/* Fall through */
-	case B_MONO_INTO_A_MONO:
-		if (size_b > size_a) {
-			return -EPERM;
-		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
-		break;
-	case B_MONO_INTO_A_STEREO_LR:
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
-		break;
-	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
-			return -EPERM;
-		}
+	if ((size_a % (pcm_bit_depth / 8)) || (size_b % (pcm_bit_depth / 8))) {
+		LOG_ERR("Size is not a multiple of the sample size");
+		return -EINVAL;
+	}
+
+	if (mix_mode >= ARRAY_SIZE(mix_layouts)) {
+		return -ESRCH;
+	}
+
+	if (size_b > (size_a / mix_layouts[mix_mode].a_step)) {
+		LOG_ERR("size a %zu size b %zu", size_a, size_b);
+		return -EPERM;
+	}
+
+	switch (pcm_bit_depth) {
+	case 16:
+		pcm_mix_16(pcm_a, pcm_b, size_b, mix_mode);
 		break;
-	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
+	case 24:
+		pcm_mix_24(pcm_a, pcm_b, size_b, mix_mode);
 		break;
 	default:
-		return -ESRCH;
-	};
+		pcm_mix_32(pcm_a, pcm_b, size_b, mix_mode);
+		break;
+	}
 
 	return 0;
 }
+
+int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	    enum pcm_mix_mode mix_mode)
+{
+	return pcm_mix_ext(pcm_a, size_a, pcm_b, size_b, mix_mode, 16);
+}
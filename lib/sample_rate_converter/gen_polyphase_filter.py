@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""Generate the polyphase filters used by the sample rate converter.
+
+A Kaiser windowed sinc low-pass prototype is designed for every supported rational conversion
+and split into one branch per interpolation phase. The taps of each branch are stored in reverse
+order, so the converter can compute an output sample as a single dot product with the input
+history.
+"""
+
+import argparse
+import math
+from fractions import Fraction
+
+# (input sample rate, output sample rate)
+CONVERSIONS = [
+    (44100, 48000),
+    (48000, 44100),
+    (32000, 48000),
+    (48000, 32000),
+]
+
+# Cut-off frequency relative to the Nyquist frequency of the lower sample rate.
+ROLLOFF = 0.9
+
+# Kaiser window shape parameter, gives approximately 80 dB stop band attenuation.
+KAISER_BETA = 8.0
+
+
+def bessel_i0(x):
+    """Zeroth order modified Bessel function of the first kind."""
+    result = 1.0
+    term = 1.0
+    k = 1
+
+    while term > result * 1e-12:
+        term *= (x / (2.0 * k)) ** 2
+        result += term
+        k += 1
+
+    return result
+
+
+def prototype(interpolation, decimation, taps_per_phase):
+    """Low-pass prototype with a DC gain equal to the interpolation factor."""
+    length = interpolation * taps_per_phase
+    center = (length - 1) / 2.0
+    cutoff = ROLLOFF * 0.5 / max(interpolation, decimation)
+    i0_beta = bessel_i0(KAISER_BETA)
+    taps = []
+
+    for n in range(length):
+        t = n - center
+        x = 2.0 * cutoff * t
+        sinc = 1.0 if t == 0 else math.sin(math.pi * x) / (math.pi * x)
+        ratio = 2.0 * t / (length - 1)
+        window = bessel_i0(KAISER_BETA * math.sqrt(max(0.0, 1.0 - ratio * ratio))) / i0_beta
+        taps.append(2.0 * cutoff * sinc * window)
+
+    gain = interpolation / sum(taps)
+
+    return [tap * gain for tap in taps]
+
+
+def quantize(value, bit_depth):
+    scale = 1 << (bit_depth - 1)
+
+    return max(-scale, min(scale - 1, round(value * scale)))
+
+
+def polyphase(interpolation, decimation, taps_per_phase, bit_depth):
+    """Split the prototype into branches with the taps in reverse order."""
+    taps = prototype(interpolation, decimation, taps_per_phase)
+    branches = []
+
+    for phase in range(interpolation):
+        branch = [taps[k * interpolation + phase] for k in range(taps_per_phase)]
+        branches.append([quantize(tap, bit_depth) for tap in reversed(branch)])
+
+    return branches
+
+
+def format_coeffs(branches, bit_depth):
+    digits = bit_depth // 4
+    mask = (1 << bit_depth) - 1
+    per_line = 64 // (digits + 4)
+    lines = []
+
+    for branch in branches:
+        for i in range(0, len(branch), per_line):
+            values = ', '.join(f'0x{tap & mask:0{digits}X}' for tap in branch[i:i + per_line])
+            lines.append(f'\t{values},')
+
+    return '\n'.join(lines)
+
+
+def generate(taps_per_phase, bit_depth):
+    q_type = f'q{bit_depth - 1}_t'
+    out = [
+        '/*',
+        ' * Copyright (c) 2026 Nordic Semiconductor ASA',
+        ' *',
+        ' * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause',
+        ' */',
+        '',
+        '/* Generated by gen_polyphase_filter.py, do not edit. */',
+        '',
+        '#include "sample_rate_converter.h"',
+        '#include "sample_rate_converter_filter.h"',
+        '',
+        '#include <zephyr/sys/util.h>',
+        '',
+        f'BUILD_ASSERT(CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS_PER_PHASE == {taps_per_phase},',
+        '\t     "Polyphase filters generated for a different number of taps");',
+        '',
+    ]
+    entries = []
+
+    for rate_in, rate_out in CONVERSIONS:
+        ratio = Fraction(rate_out, rate_in)
+        interpolation = ratio.numerator
+        decimation = ratio.denominator
+        name = f'polyphase_{rate_in}hz_to_{rate_out}hz_{bit_depth}bit'
+        branches = polyphase(interpolation, decimation, taps_per_phase, bit_depth)
+
+        out.append(f'static const {q_type} {name}[] = {{')
+        out.append(format_coeffs(branches, bit_depth))
+        out.append('};')
+        out.append('')
+
+        entries.append('\n'.join([
+            '\t{',
+            f'\t\t.sample_rate_input = {rate_in},',
+            f'\t\t.sample_rate_output = {rate_out},',
+            f'\t\t.interpolation = {interpolation},',
+            f'\t\t.index_step = {decimation // interpolation},',
+            f'\t\t.phase_step = {decimation % interpolation},',
+            f'\t\t.coeffs = {name},',
+            '\t},',
+        ]))
+
+    out.append('const struct sample_rate_converter_polyphase_filter '
+               'sample_rate_converter_polyphase_filters[] = {')
+    out.extend(entries)
+    out.append('};')
+    out.append('')
+    out.append('const size_t sample_rate_converter_polyphase_filters_cnt =')
+    out.append('\tARRAY_SIZE(sample_rate_converter_polyphase_filters);')
+    out.append('')
+
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     allow_abbrev=False)
+    parser.add_argument('--taps-per-phase', type=int, required=True,
+                        help='Number of filter taps in every polyphase branch')
+    parser.add_argument('--bit-depth', type=int, choices=[16, 32], required=True,
+                        help='Bit depth of the filter coefficients')
+    parser.add_argument('--output', required=True, help='Output C file')
+    args = parser.parse_args()
+
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write(generate(args.taps_per_phase, args.bit_depth))
+
+
+if __name__ == '__main__':
+    main()
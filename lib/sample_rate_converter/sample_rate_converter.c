@@ -10,6 +10,7 @@
 #include <errno.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
@@ -36,6 +37,12 @@ LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVE
 
 static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rate_output)
 {
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	if (sample_rate_converter_polyphase_filter_get(sample_rate_input, sample_rate_output)) {
+		return 0;
+	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 	if (sample_rate_input > sample_rate_output) {
 		if (sample_rate_input != 48000) {
 			LOG_ERR("Invalid input sample rate for downsampling %d", sample_rate_input);
@@ -65,6 +72,114 @@ static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rat
 	return 0;
 }
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+#define POLYPHASE_TAPS	      CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS_PER_PHASE
+#define POLYPHASE_HISTORY_LEN (POLYPHASE_TAPS - 1)
+
+/**
+ * @brief Calculates the number of output samples the polyphase filter will produce.
+ *
+ * @details The position of the next output sample in the input stream is tracked in units of
+ *	    1/interpolation input samples, and advances by the decimation factor per output
+ *	    sample.
+ */
+static size_t polyphase_output_samples_get(const struct sample_rate_converter_ctx *ctx,
+					   size_t samples_in)
+{
+	const struct sample_rate_converter_polyphase_filter *filter = ctx->polyphase_filter;
+	uint32_t decimation = (filter->index_step * filter->interpolation) + filter->phase_step;
+	uint32_t pos = (ctx->polyphase_index * filter->interpolation) + ctx->polyphase_phase;
+	uint32_t end = samples_in * filter->interpolation;
+
+	if (pos >= end) {
+		return 0;
+	}
+
+	return DIV_ROUND_UP(end - pos, decimation);
+}
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+static void polyphase_filter_run(struct sample_rate_converter_ctx *ctx, const q15_t *input,
+				 size_t samples_in, q15_t *output)
+{
+	const struct sample_rate_converter_polyphase_filter *filter = ctx->polyphase_filter;
+	const q15_t *coeffs = filter->coeffs;
+	q15_t *buf = ctx->state_buf_15;
+	uint32_t index = ctx->polyphase_index;
+	uint32_t phase = ctx->polyphase_phase;
+	q63_t acc;
+
+	memcpy(&buf[POLYPHASE_HISTORY_LEN], input, samples_in * sizeof(q15_t));
+
+	while (index < samples_in) {
+		arm_dot_prod_q15(&coeffs[phase * POLYPHASE_TAPS], &buf[index], POLYPHASE_TAPS,
+				 &acc);
+		/* Result is in 34.30 format */
+		*output++ = (q15_t)CLAMP(acc >> 15, INT16_MIN, INT16_MAX);
+
+		index += filter->index_step;
+		phase += filter->phase_step;
+		if (phase >= filter->interpolation) {
+			phase -= filter->interpolation;
+			index++;
+		}
+	}
+
+	memmove(buf, &buf[samples_in], POLYPHASE_HISTORY_LEN * sizeof(q15_t));
+	ctx->polyphase_index = index - samples_in;
+	ctx->polyphase_phase = phase;
+}
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+static void polyphase_filter_run(struct sample_rate_converter_ctx *ctx, const q31_t *input,
+				 size_t samples_in, q31_t *output)
+{
+	const struct sample_rate_converter_polyphase_filter *filter = ctx->polyphase_filter;
+	const q31_t *coeffs = filter->coeffs;
+	q31_t *buf = ctx->state_buf_31;
+	uint32_t index = ctx->polyphase_index;
+	uint32_t phase = ctx->polyphase_phase;
+	q63_t acc;
+
+	memcpy(&buf[POLYPHASE_HISTORY_LEN], input, samples_in * sizeof(q31_t));
+
+	while (index < samples_in) {
+		arm_dot_prod_q31(&coeffs[phase * POLYPHASE_TAPS], &buf[index], POLYPHASE_TAPS,
+				 &acc);
+		/* Result is in 16.48 format */
+		*output++ = (q31_t)CLAMP(acc >> 17, INT32_MIN, INT32_MAX);
+
+		index += filter->index_step;
+		phase += filter->phase_step;
+		if (phase >= filter->interpolation) {
+			phase -= filter->interpolation;
+			index++;
+		}
+	}
+
+	memmove(buf, &buf[samples_in], POLYPHASE_HISTORY_LEN * sizeof(q31_t));
+	ctx->polyphase_index = index - samples_in;
+	ctx->polyphase_phase = phase;
+}
+#endif
+
+static int polyphase_process(struct sample_rate_converter_ctx *ctx, void const *const input,
+			     size_t samples_in, void *const output, size_t output_size,
+			     size_t *output_written, size_t bytes_per_sample)
+{
+	*output_written = polyphase_output_samples_get(ctx, samples_in) * bytes_per_sample;
+
+	if (*output_written > output_size) {
+		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	polyphase_filter_run(ctx, input, samples_in, output);
+
+	return 0;
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 static inline int calculate_conversion_ratio(uint32_t sample_rate_input,
 					     uint32_t sample_rate_output)
 {
@@ -110,10 +225,31 @@ static int sample_rate_converter_reconfigure(struct sample_rate_converter_ctx *c
 
 	ctx->sample_rate_input = sample_rate_input;
 	ctx->sample_rate_output = sample_rate_output;
+	ctx->filter_type = filter;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	ctx->polyphase_filter =
+		sample_rate_converter_polyphase_filter_get(sample_rate_input, sample_rate_output);
+	if (ctx->polyphase_filter) {
+		ctx->conversion_ratio = 0;
+		ctx->polyphase_index = 0;
+		ctx->polyphase_phase = 0;
+		ctx->input_buf.bytes_in_buf = 0;
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+		memset(ctx->state_buf_15, 0, sizeof(ctx->state_buf_15));
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+		memset(ctx->state_buf_31, 0, sizeof(ctx->state_buf_31));
+#endif
+
+		LOG_DBG("Polyphase sample rate converter initialized. Input sample rate: %d, "
+			"Output sample rate: %d",
+			ctx->sample_rate_input, ctx->sample_rate_output);
+		return 0;
+	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
 
 	ctx->conversion_ratio = calculate_conversion_ratio(sample_rate_input, sample_rate_output);
 
-	ctx->filter_type = filter;
 	ret = sample_rate_converter_filter_get(filter, ctx->conversion_ratio,
 					       (void const **)&filter_coeffs, &filter_size);
 	if (ret) {
@@ -247,6 +383,13 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		}
 	}
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	if (ctx->polyphase_filter) {
+		return polyphase_process(ctx, input, samples_in, output, output_size,
+					 output_written, bytes_per_sample);
+	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 	if ((ctx->conversion_ratio < 0) && (samples_in < abs(ctx->conversion_ratio))) {
 		LOG_ERR("Number of samples in can not be less than the conversion ratio (%d) when "
 			"downsampling",
@@ -301,3 +301,27 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
 	return 0;
 }
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/* Defined in the file generated by gen_polyphase_filter.py */
+extern const struct sample_rate_converter_polyphase_filter
+	sample_rate_converter_polyphase_filters[];
+extern const size_t sample_rate_converter_polyphase_filters_cnt;
+
+const struct sample_rate_converter_polyphase_filter *
+sample_rate_converter_polyphase_filter_get(uint32_t sample_rate_input,
+					   uint32_t sample_rate_output)
+{
+	for (size_t i = 0; i < sample_rate_converter_polyphase_filters_cnt; i++) {
+		const struct sample_rate_converter_polyphase_filter *filter =
+			&sample_rate_converter_polyphase_filters[i];
+
+		if ((filter->sample_rate_input == sample_rate_input) &&
+		    (filter->sample_rate_output == sample_rate_output)) {
+			return filter;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
@@ -24,4 +24,35 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 				     int conversion_ratio, void const **filter_ptr,
 				     size_t *filter_size);
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/**
+ * Polyphase filter for a rational conversion ratio.
+ *
+ * The filter consists of one branch per interpolation phase, each with
+ * CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS_PER_PHASE coefficients stored in reverse order.
+ * For every output sample the phase is advanced by the decimation factor, split into the number
+ * of whole input samples (index_step) and the remainder (phase_step).
+ */
+struct sample_rate_converter_polyphase_filter {
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+	uint16_t interpolation;
+	uint16_t index_step;
+	uint16_t phase_step;
+	void const *coeffs;
+};
+
+/**
+ * @brief Get the polyphase filter for a conversion.
+ *
+ * @param[in]	sample_rate_input	Sample rate of the input samples.
+ * @param[in]	sample_rate_output	Sample rate of the output samples.
+ *
+ * @return	Pointer to the filter, or NULL if the conversion has no polyphase filter.
+ */
+const struct sample_rate_converter_polyphase_filter *
+sample_rate_converter_polyphase_filter_get(uint32_t sample_rate_input,
+					   uint32_t sample_rate_output);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 #endif /* _SAMPLE_RATE_CONVERTER_FILTER_H_ */
@@ -0,0 +1,305 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Create and apply delta patches for the nRF Compression library.
+
+A patch describes the target image as operations on the source image, which is the image
+already on the device. See include/nrf_compress/delta_types.h for the format.
+
+Matches are found like in bsdiff: an exact match is extended as long as at least half of
+the bytes still match, and the bytes that differ are stored as a difference to the source.
+When code moves, most of the differences are the same few values, which compress well.
+"""
+
+import argparse
+import lzma
+import struct
+import sys
+import time
+
+MAGIC = b'NDLT'
+HEADER = struct.Struct('<4sII')
+
+OP_COPY = 0
+OP_ADD = 1
+OP_INSERT = 2
+OP_SEEK = 3
+
+# Length of the blocks that are looked up in the source image
+BLOCK_SIZE = 8
+# Shortest exact run inside a match that is worth a COPY instead of ADD
+MIN_COPY = 8
+# Source positions kept for each block
+MAX_CANDIDATES = 16
+
+
+def _varint(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7f
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def _zigzag(value: int) -> int:
+    return value << 1 if value >= 0 else ((-value - 1) << 1) | 1
+
+
+class _Writer:
+    def __init__(self, source_size: int, target_size: int):
+        self.out = bytearray(HEADER.pack(MAGIC, source_size, target_size))
+        self.source_pos = 0
+        self.literal = bytearray()
+
+    def _op(self, op: int, arg: int, data: bytes = b''):
+        self.out.append(op)
+        self.out += _varint(arg)
+        self.out += data
+
+    def insert(self, data: bytes):
+        self.literal += data
+
+    def flush(self):
+        if self.literal:
+            self._op(OP_INSERT, len(self.literal), self.literal)
+            self.literal = bytearray()
+
+    def seek(self, source_pos: int):
+        if source_pos != self.source_pos:
+            self.flush()
+            self._op(OP_SEEK, _zigzag(source_pos - self.source_pos))
+            self.source_pos = source_pos
+
+    def match(self, source: bytes, target: bytes):
+        """Output source-aligned bytes, as COPY for exact runs and ADD for the rest."""
+        self.flush()
+        length = len(target)
+        i = 0
+        while i < length:
+            j = i
+            while j < length and source[j] == target[j]:
+                j += 1
+            if j - i >= MIN_COPY:
+                self._op(OP_COPY, j - i)
+                i = j
+                continue
+            # ADD up to the next exact run that is long enough for a COPY
+            k = j
+            while k < length:
+                run = k
+                while run < length and source[run] == target[run]:
+                    run += 1
+                if run - k >= MIN_COPY:
+                    break
+                k = run + 1
+            k = min(k, length)
+            self._op(OP_ADD, k - i, bytes((t - s) & 0xff for s, t in
+                                          zip(source[i:k], target[i:k])))
+            i = k
+        self.source_pos += length
+
+
+def _index(source: bytes) -> dict:
+    index = {}
+    for pos in range(len(source) - BLOCK_SIZE + 1):
+        key = source[pos:pos + BLOCK_SIZE]
+        positions = index.setdefault(key, [])
+        if len(positions) < MAX_CANDIDATES:
+            positions.append(pos)
+    return index
+
+
+def _exact_length(source: bytes, spos: int, target: bytes, tpos: int) -> int:
+    length = 0
+    limit = min(len(source) - spos, len(target) - tpos)
+    # Compare in blocks first, then byte by byte
+    while length + 64 <= limit and \
+            source[spos + length:spos + length + 64] == target[tpos + length:tpos + length + 64]:
+        length += 64
+    while length < limit and source[spos + length] == target[tpos + length]:
+        length += 1
+    return length
+
+
+def _extend(source: bytes, spos: int, target: bytes, tpos: int) -> int:
+    """Extend a match forward while at least half of the bytes match, as bsdiff does."""
+    limit = min(len(source) - spos, len(target) - tpos)
+    score = 0
+    best_score = 0
+    best = 0
+    i = 0
+    while i < limit:
+        exact = _exact_length(source, spos + i, target, tpos + i)
+        if exact:
+            i += exact
+            score += exact
+            if score > best_score:
+                best_score = score
+                best = i
+            continue
+        score -= 1
+        i += 1
+        if score < best_score - 2 * BLOCK_SIZE:
+            break
+    return best
+
+
+def create(source: bytes, target: bytes) -> bytes:
+    """Create a patch that turns source into target."""
+    writer = _Writer(len(source), len(target))
+    index = _index(source)
+    tpos = 0
+
+    while tpos < len(target):
+        best_len = 0
+        best_spos = 0
+        key = target[tpos:tpos + BLOCK_SIZE]
+
+        # Prefer continuing where the previous match ended
+        candidates = [writer.source_pos] + index.get(key, []) if len(key) == BLOCK_SIZE else []
+        for spos in candidates:
+            if spos >= len(source):
+                continue
+            length = _exact_length(source, spos, target, tpos)
+            if length > best_len:
+                best_len = length
+                best_spos = spos
+
+        if best_len >= BLOCK_SIZE:
+            length = _extend(source, best_spos, target, tpos)
+        else:
+            # A difference right where the previous match ended, like a changed pointer
+            best_spos = writer.source_pos
+            length = _extend(source, best_spos, target, tpos)
+
+        if length < BLOCK_SIZE:
+            writer.insert(target[tpos:tpos + 1])
+            tpos += 1
+            continue
+
+        writer.seek(best_spos)
+        writer.match(source[best_spos:best_spos + length], target[tpos:tpos + length])
+        tpos += length
+
+    writer.flush()
+    return bytes(writer.out)
+
+
+def _read_varint(patch: bytes, pos: int) -> tuple:
+    value = 0
+    shift = 0
+    while True:
+        byte = patch[pos]
+        pos += 1
+        value |= (byte & 0x7f) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def apply(source: bytes, patch: bytes) -> bytes:
+    """Apply a patch to source, as the nRF Compression library does."""
+    magic, source_size, target_size = HEADER.unpack_from(patch)
+    if magic != MAGIC:
+        raise ValueError('Not a delta patch')
+    if source_size != len(source):
+        raise ValueError(f'Patch is for a source of {source_size} bytes, not {len(source)}')
+
+    out = bytearray()
+    spos = 0
+    pos = HEADER.size
+    while pos < len(patch):
+        op = patch[pos]
+        arg, pos = _read_varint(patch, pos + 1)
+        if op == OP_COPY:
+            out += source[spos:spos + arg]
+            spos += arg
+        elif op == OP_ADD:
+            out += bytes((s + d) & 0xff for s, d in zip(source[spos:spos + arg],
+                                                       patch[pos:pos + arg]))
+            spos += arg
+            pos += arg
+        elif op == OP_INSERT:
+            out += patch[pos:pos + arg]
+            pos += arg
+        elif op == OP_SEEK:
+            spos += (arg >> 1) ^ -(arg & 1)
+        else:
+            raise ValueError(f'Invalid operation {op}')
+
+    if len(out) != target_size:
+        raise ValueError(f'Patch output is {len(out)} bytes, not {target_size}')
+    return bytes(out)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description='Create or apply nRF Compression delta patches.',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    create_parser = subparsers.add_parser('create', help='Create a patch.')
+    create_parser.add_argument('--source', required=True,
+                               help='Image on the device, in binary format.')
+    create_parser.add_argument('--target', required=True,
+                               help='New image, in binary format.')
+    create_parser.add_argument('--out', required=True, help='Patch file to create.')
+
+    apply_parser = subparsers.add_parser('apply', help='Apply a patch.')
+    apply_parser.add_argument('--source', required=True,
+                              help='Image on the device, in binary format.')
+    apply_parser.add_argument('--patch', required=True, help='Patch file.')
+    apply_parser.add_argument('--out', required=True, help='New image to create.')
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+
+    with open(args.source, 'rb') as f:
+        source = f.read()
+
+    if args.command == 'create':
+        with open(args.target, 'rb') as f:
+            target = f.read()
+
+        start = time.monotonic()
+        patch = create(source, target)
+        elapsed = time.monotonic() - start
+
+        if apply(source, patch) != target:
+            print('Patch does not reproduce the target image', file=sys.stderr)
+            return 1
+
+        with open(args.out, 'wb') as f:
+            f.write(patch)
+
+        compressed = len(lzma.compress(target, format=lzma.FORMAT_RAW,
+                                       filters=[{'id': lzma.FILTER_LZMA2}]))
+        patch_compressed = len(lzma.compress(patch, format=lzma.FORMAT_RAW,
+                                             filters=[{'id': lzma.FILTER_LZMA2}]))
+        print(f'Target image:       {len(target)} bytes, {compressed} with LZMA2')
+        print(f'Patch:              {len(patch)} bytes, {patch_compressed} with LZMA2')
+        print(f'Created in {elapsed:.2f} s')
+    else:
+        with open(args.patch, 'rb') as f:
+            patch = f.read()
+
+        with open(args.out, 'wb') as f:
+            f.write(apply(source, patch))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,93 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+import random
+import struct
+
+import pytest
+from delta import HEADER, OP_SEEK, _zigzag, apply, create
+
+
+def firmware(seed: int, size: int) -> bytes:
+    rng = random.Random(seed)
+    opcodes = [rng.getrandbits(16) for _ in range(200)]
+    return b''.join(struct.pack('<H', rng.choice(opcodes)) for _ in range(size // 2))
+
+
+def test_identical_images_are_one_copy():
+    source = firmware(1, 20000)
+    patch = create(source, source)
+
+    assert apply(source, patch) == source
+    assert len(patch) == HEADER.size + 4
+
+
+@pytest.mark.parametrize('change', ['insert', 'delete', 'modify', 'append', 'truncate'])
+def test_small_change_gives_small_patch(change):
+    source = firmware(2, 30000)
+    insert = firmware(3, 500)
+    target = {
+        'insert': source[:10000] + insert + source[10000:],
+        'delete': source[:10000] + source[10500:],
+        'modify': source[:10000] + bytes(b ^ 0x55 for b in source[10000:10016]) +
+                  source[10016:],
+        'append': source + insert,
+        'truncate': source[:20000],
+    }[change]
+
+    patch = create(source, target)
+
+    assert apply(source, patch) == target
+    assert len(patch) < len(insert) + 100
+
+
+def test_moved_addresses_are_stored_as_differences():
+    rng = random.Random(4)
+    words = [rng.randrange(0x10000, 0x20000) for _ in range(2000)]
+    source = b''.join(struct.pack('<I', w) for w in words)
+    target = b''.join(struct.pack('<I', w + 0x40 if w > 0x18000 else w) for w in words)
+
+    patch = create(source, target)
+
+    assert apply(source, patch) == target
+    # Differences are mostly zero, so they compress well
+    assert patch.count(0) > len(patch) // 2
+
+
+def test_unrelated_images():
+    source = random.Random(5).randbytes(5000)
+    target = random.Random(6).randbytes(7000)
+
+    assert apply(source, create(source, target)) == target
+
+
+def test_empty_images():
+    assert apply(b'', create(b'', b'abc')) == b'abc'
+    assert apply(b'abc', create(b'abc', b'')) == b''
+
+
+@pytest.mark.parametrize('value', [0, 1, -1, 63, -64, 1 << 20, -(1 << 20)])
+def test_seek_encoding(value):
+    arg = _zigzag(value)
+
+    assert (arg >> 1) ^ -(arg & 1) == value
+    assert arg >= 0
+
+
+def test_seek_backwards():
+    source = firmware(7, 8000)
+    target = source[4000:] + source[:4000]
+    patch = create(source, target)
+
+    assert apply(source, patch) == target
+    assert OP_SEEK in patch[HEADER.size:]
+
+
+def test_wrong_source_is_rejected():
+    source = firmware(8, 1000)
+    patch = create(source, source)
+
+    with pytest.raises(ValueError):
+        apply(source[:-1], patch)
@@ -5,6 +5,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/slist.h>
@@ -12,6 +13,8 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/reboot.h>
 
+#include "app_event_manager_mem_pool.h"
+
 LOG_MODULE_REGISTER(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 
@@ -19,9 +22,44 @@ static void event_processor_fn(struct k_work *work);
 
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
+enum event_lane {
+	EVENT_LANE_HIGH,
+	EVENT_LANE_NORMAL,
+
+	EVENT_LANE_COUNT
+};
+
 static K_WORK_DEFINE(event_processor, event_processor_fn);
-static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
+
+#ifdef CONFIG_APP_EVENT_MANAGER_PROCESSING_THREAD
+static K_THREAD_STACK_DEFINE(event_processor_stack,
+			     CONFIG_APP_EVENT_MANAGER_PROCESSING_THREAD_STACK_SIZE);
+static struct k_work_q event_processor_workq;
+#endif
+
+#ifdef CONFIG_APP_EVENT_MANAGER_QUEUE_MPSC
+static struct mpsc eventq[EVENT_LANE_COUNT] = {
+	[EVENT_LANE_HIGH] = MPSC_INIT(eventq[EVENT_LANE_HIGH]),
+	[EVENT_LANE_NORMAL] = MPSC_INIT(eventq[EVENT_LANE_NORMAL]),
+};
+#else
+static sys_slist_t eventq[EVENT_LANE_COUNT] = {
+	[EVENT_LANE_HIGH] = SYS_SLIST_STATIC_INIT(&eventq[EVENT_LANE_HIGH]),
+	[EVENT_LANE_NORMAL] = SYS_SLIST_STATIC_INIT(&eventq[EVENT_LANE_NORMAL]),
+};
 static struct k_spinlock lock;
+#endif
+
+#ifdef CONFIG_APP_EVENT_MANAGER_COALESCE
+struct coalesce_slot {
+	struct app_event_header *aeh;
+	uint32_t key;
+};
+
+static struct coalesce_slot coalesce_slots[CONFIG_APP_EVENT_MANAGER_COALESCE_SLOTS];
+static atomic_t coalesced_cnt[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+static struct k_spinlock coalesce_lock;
+#endif
 
 static bool log_is_event_displayed(const struct event_type *et)
 {
@@ -116,7 +154,8 @@ static void log_event_init(void)
 
 void * __weak app_event_manager_alloc(size_t size)
 {
-	void *event = k_malloc(size);
+	void *event = IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL) ?
+		      app_event_manager_mem_pool_alloc(size) : k_malloc(size);
 
 	if (unlikely(!event)) {
 		LOG_ERR("Application Event Manager OOM error\n");
@@ -134,73 +173,239 @@ void * __weak app_event_manager_alloc(size_t size)
 
 void __weak app_event_manager_free(void *addr)
 {
-	k_free(addr);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL)) {
+		app_event_manager_mem_pool_free(addr);
+	} else {
+		k_free(addr);
+	}
 }
 
-static void event_processor_fn(struct k_work *work)
+static enum event_lane event_lane_get(const struct event_type *et)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	return app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY) ?
+	       EVENT_LANE_HIGH : EVENT_LANE_NORMAL;
+}
 
-	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+static void submit_hooks_call(const struct app_event_header *aeh)
+{
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_submit_hook, h) {
+			h->hook(aeh);
+		}
+	}
+}
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
-		return;
+#ifdef CONFIG_APP_EVENT_MANAGER_QUEUE_MPSC
+static void eventq_put(struct app_event_header *aeh)
+{
+	submit_hooks_call(aeh);
+	mpsc_push(&eventq[event_lane_get(aeh->type_id)], &aeh->node);
+}
+
+static struct app_event_header *eventq_get(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(eventq); i++) {
+		/* NULL is also returned if a producer is in the middle of
+		 * a push. The producer submits the processing work afterwards,
+		 * so the event is handled in the next processing cycle.
+		 */
+		struct mpsc_node *node = mpsc_pop(&eventq[i]);
+
+		if (node) {
+			return CONTAINER_OF(node, struct app_event_header, node);
+		}
 	}
 
-	sys_slist_merge_slist(&events, &eventq);
+	return NULL;
+}
+#else
+static void eventq_put(struct app_event_header *aeh)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	submit_hooks_call(aeh);
+	sys_slist_append(&eventq[event_lane_get(aeh->type_id)], &aeh->node);
 
 	k_spin_unlock(&lock, key);
+}
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct app_event_header *aeh = CONTAINER_OF(node,
-						       struct app_event_header,
-						       node);
+static struct app_event_header *eventq_get(void)
+{
+	sys_snode_t *node = NULL;
+	k_spinlock_key_t key = k_spin_lock(&lock);
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
+	for (size_t i = 0; (i < ARRAY_SIZE(eventq)) && !node; i++) {
+		node = sys_slist_get(&eventq[i]);
+	}
 
-		const struct event_type *et = aeh->type_id;
+	k_spin_unlock(&lock, key);
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
+	return node ? CONTAINER_OF(node, struct app_event_header, node) : NULL;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_QUEUE_MPSC */
+
+#ifdef CONFIG_APP_EVENT_MANAGER_COALESCE
+static uint32_t coalesce_key_get(const struct app_event_header *aeh)
+{
+	const struct event_type *et = aeh->type_id;
+
+	return et->coalesce_key_func ? et->coalesce_key_func(aeh) : 0;
+}
+
+static bool coalesce_on_submit(struct app_event_header *aeh)
+{
+	const struct event_type *et = aeh->type_id;
+
+	if (!app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_COALESCE)) {
+		return false;
+	}
+
+	struct coalesce_slot *free_slot = NULL;
+	uint32_t key = coalesce_key_get(aeh);
+	k_spinlock_key_t lock_key = k_spin_lock(&coalesce_lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(coalesce_slots); i++) {
+		struct coalesce_slot *slot = &coalesce_slots[i];
+
+		if (!slot->aeh) {
+			if (!free_slot) {
+				free_slot = slot;
 			}
+			continue;
 		}
 
-		log_event(aeh);
+		if ((slot->aeh->type_id == et) && (slot->key == key)) {
+			/* Pending event is not yet processed, update it in place.
+			 * The processor releases the slot under the same lock
+			 * before passing the event to the listeners.
+			 */
+			memcpy((uint8_t *)slot->aeh + sizeof(*aeh),
+			       (const uint8_t *)aeh + sizeof(*aeh),
+			       et->struct_size - sizeof(*aeh));
+			k_spin_unlock(&coalesce_lock, lock_key);
 
-		bool consumed = false;
+			atomic_inc(&coalesced_cnt[et - _event_type_list_start]);
+			app_event_manager_free(aeh);
 
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
+			return true;
+		}
+	}
 
-			__ASSERT_NO_MSG(es != NULL);
+	/* If no slot is free the event is queued without coalescing. */
+	if (free_slot) {
+		free_slot->aeh = aeh;
+		free_slot->key = key;
+	}
 
-			const struct event_listener *el = es->listener;
+	k_spin_unlock(&coalesce_lock, lock_key);
 
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
+	return false;
+}
 
-			log_event_progress(et, el);
+static void coalesce_on_process(const struct app_event_header *aeh)
+{
+	if (!app_event_get_type_flag(aeh->type_id, APP_EVENT_TYPE_FLAGS_COALESCE)) {
+		return;
+	}
 
-			consumed = el->notification(aeh);
+	k_spinlock_key_t lock_key = k_spin_lock(&coalesce_lock);
 
-			if (consumed) {
-				log_event_consumed(et);
-			}
+	for (size_t i = 0; i < ARRAY_SIZE(coalesce_slots); i++) {
+		if (coalesce_slots[i].aeh == aeh) {
+			coalesce_slots[i].aeh = NULL;
+			break;
 		}
+	}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
-			}
+	k_spin_unlock(&coalesce_lock, lock_key);
+}
+
+uint32_t app_event_manager_coalesced_cnt_get(const struct event_type *et)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	return atomic_get(&coalesced_cnt[et - _event_type_list_start]);
+}
+#else
+static bool coalesce_on_submit(struct app_event_header *aeh)
+{
+	return false;
+}
+
+static void coalesce_on_process(const struct app_event_header *aeh)
+{
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_COALESCE */
+
+static void event_processor_submit(void)
+{
+#ifdef CONFIG_APP_EVENT_MANAGER_PROCESSING_THREAD
+	/* Events submitted before the queue is started are processed
+	 * once app_event_manager_init() starts the queue.
+	 */
+	(void)k_work_submit_to_queue(&event_processor_workq, &event_processor);
+#else
+	k_work_submit(&event_processor);
+#endif
+}
+
+static void event_process(struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	const struct event_type *et = aeh->type_id;
+
+	coalesce_on_process(aeh);
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			h->hook(aeh);
 		}
+	}
+
+	log_event(aeh);
+
+	bool consumed = false;
+
+	for (const struct event_subscriber *es = et->subs_start;
+	     (es != et->subs_stop) && !consumed;
+	     es++) {
+
+		__ASSERT_NO_MSG(es != NULL);
 
-		app_event_manager_free(aeh);
+		const struct event_listener *el = es->listener;
+
+		__ASSERT_NO_MSG(el != NULL);
+		__ASSERT_NO_MSG(el->notification != NULL);
+
+		log_event_progress(et, el);
+
+		consumed = el->notification(aeh);
+
+		if (consumed) {
+			log_event_consumed(et);
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+	app_event_manager_free(aeh);
+}
+
+static void event_processor_fn(struct k_work *work)
+{
+	struct app_event_header *aeh;
+
+	/* Events are fetched one by one, so that a high priority event
+	 * submitted while processing is handled before pending normal
+	 * priority events.
+	 */
+	while (NULL != (aeh = eventq_get())) {
+		event_process(aeh);
 	}
 }
 
@@ -209,17 +414,12 @@ void _event_submit(struct app_event_header *aeh)
 	__ASSERT_NO_MSG(aeh);
 	APP_EVENT_ASSERT_ID(aeh->type_id);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
-
-	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
-		STRUCT_SECTION_FOREACH(event_submit_hook, h) {
-			h->hook(aeh);
-		}
+	if (coalesce_on_submit(aeh)) {
+		return;
 	}
-	sys_slist_append(&eventq, &aeh->node);
-	k_spin_unlock(&lock, key);
 
-	k_work_submit(&event_processor);
+	eventq_put(aeh);
+	event_processor_submit();
 }
 
 int app_event_manager_init(void)
@@ -240,5 +440,20 @@ int app_event_manager_init(void)
 		}
 	}
 
+#ifdef CONFIG_APP_EVENT_MANAGER_PROCESSING_THREAD
+	if (!ret) {
+		static const struct k_work_queue_config cfg = {
+			.name = "app_event_manager",
+		};
+
+		k_work_queue_start(&event_processor_workq, event_processor_stack,
+				   K_THREAD_STACK_SIZEOF(event_processor_stack),
+				   CONFIG_APP_EVENT_MANAGER_PROCESSING_THREAD_PRIORITY, &cfg);
+
+		/* Process events submitted before the queue was started. */
+		event_processor_submit();
+	}
+#endif
+
 	return ret;
 }
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include "app_event_manager_mem_pool.h"
+
+#define POOL_BLOCK_ALIGN 8
+
+#define POOL_CLASS_SIZE(n)  _CONCAT(_CONCAT(CONFIG_APP_EVENT_MANAGER_MEM_POOL_CLASS, n), _SIZE)
+#define POOL_CLASS_COUNT(n) _CONCAT(_CONCAT(CONFIG_APP_EVENT_MANAGER_MEM_POOL_CLASS, n), _COUNT)
+
+#define POOL_CLASS_DEFINE(n)								\
+	BUILD_ASSERT((POOL_CLASS_SIZE(n) % POOL_BLOCK_ALIGN) == 0,			\
+		     "Size class " STRINGIFY(n) " must be a multiple of "		\
+		     STRINGIFY(POOL_BLOCK_ALIGN));					\
+	K_MEM_SLAB_DEFINE_STATIC(pool_slab_##n, POOL_CLASS_SIZE(n), POOL_CLASS_COUNT(n),	\
+				 POOL_BLOCK_ALIGN)
+
+#define POOL_CLASS_ENTRY(n)					\
+	{							\
+		.slab = &pool_slab_##n,				\
+		.block_size = POOL_CLASS_SIZE(n),		\
+		.block_cnt = POOL_CLASS_COUNT(n),		\
+	}
+
+struct pool_class {
+	struct k_mem_slab *slab;
+	size_t block_size;
+	uint32_t block_cnt;
+	atomic_t borrow_cnt;
+};
+
+POOL_CLASS_DEFINE(0);
+POOL_CLASS_DEFINE(1);
+POOL_CLASS_DEFINE(2);
+POOL_CLASS_DEFINE(3);
+
+BUILD_ASSERT(POOL_CLASS_SIZE(0) < POOL_CLASS_SIZE(1), "Size classes must be in ascending order");
+BUILD_ASSERT(POOL_CLASS_SIZE(1) < POOL_CLASS_SIZE(2), "Size classes must be in ascending order");
+BUILD_ASSERT(POOL_CLASS_SIZE(2) < POOL_CLASS_SIZE(3), "Size classes must be in ascending order");
+
+static struct pool_class pool_classes[] = {
+	POOL_CLASS_ENTRY(0),
+	POOL_CLASS_ENTRY(1),
+	POOL_CLASS_ENTRY(2),
+	POOL_CLASS_ENTRY(3),
+};
+
+static atomic_t heap_fallback_cnt;
+static atomic_t fail_cnt;
+
+
+static bool pool_class_owns(const struct pool_class *pc, const void *addr)
+{
+	const char *start = pc->slab->buffer;
+	const char *end = start + (pc->block_size * pc->block_cnt);
+
+	return ((const char *)addr >= start) && ((const char *)addr < end);
+}
+
+void *app_event_manager_mem_pool_alloc(size_t size)
+{
+	size_t first_fit = ARRAY_SIZE(pool_classes);
+
+	for (size_t i = 0; i < ARRAY_SIZE(pool_classes); i++) {
+		struct pool_class *pc = &pool_classes[i];
+		void *block;
+
+		if (pc->block_size < size) {
+			continue;
+		}
+
+		if (first_fit == ARRAY_SIZE(pool_classes)) {
+			first_fit = i;
+		}
+
+		if (!k_mem_slab_alloc(pc->slab, &block, K_NO_WAIT)) {
+			if (i != first_fit) {
+				atomic_inc(&pool_classes[first_fit].borrow_cnt);
+			}
+
+			return block;
+		}
+
+		if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL_BORROW_LARGER)) {
+			break;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL_HEAP_FALLBACK)) {
+		void *addr = k_malloc(size);
+
+		if (addr) {
+			atomic_inc(&heap_fallback_cnt);
+			return addr;
+		}
+	}
+
+	atomic_inc(&fail_cnt);
+
+	return NULL;
+}
+
+void app_event_manager_mem_pool_free(void *addr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(pool_classes); i++) {
+		if (pool_class_owns(&pool_classes[i], addr)) {
+			k_mem_slab_free(pool_classes[i].slab, addr);
+			return;
+		}
+	}
+
+	__ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL_HEAP_FALLBACK),
+		 "Event not allocated from the memory pool");
+	k_free(addr);
+}
+
+size_t app_event_manager_mem_pool_class_cnt(void)
+{
+	return ARRAY_SIZE(pool_classes);
+}
+
+int app_event_manager_mem_pool_stats_get(size_t idx, struct app_event_manager_mem_pool_stats *stats)
+{
+	if (idx >= ARRAY_SIZE(pool_classes)) {
+		return -EINVAL;
+	}
+
+	struct pool_class *pc = &pool_classes[idx];
+
+	stats->block_size = pc->block_size;
+	stats->block_cnt = pc->block_cnt;
+	stats->used_cnt = k_mem_slab_num_used_get(pc->slab);
+	stats->max_used_cnt = k_mem_slab_max_used_get(pc->slab);
+	stats->borrow_cnt = atomic_get(&pc->borrow_cnt);
+
+	return 0;
+}
+
+uint32_t app_event_manager_mem_pool_heap_fallback_cnt(void)
+{
+	return atomic_get(&heap_fallback_cnt);
+}
+
+uint32_t app_event_manager_mem_pool_fail_cnt(void)
+{
+	return atomic_get(&fail_cnt);
+}
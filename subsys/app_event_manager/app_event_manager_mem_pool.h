@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Application Event Manager memory pool private header.
+ *
+ * The memory pool is used by the default event allocator if
+ * CONFIG_APP_EVENT_MANAGER_MEM_POOL is enabled.
+ */
+
+#ifndef _APP_EVENT_MANAGER_MEM_POOL_H_
+#define _APP_EVENT_MANAGER_MEM_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Statistics of a single size class of the memory pool. */
+struct app_event_manager_mem_pool_stats {
+	/** Size of a block. */
+	size_t block_size;
+
+	/** Number of blocks. */
+	uint32_t block_cnt;
+
+	/** Number of blocks currently in use. */
+	uint32_t used_cnt;
+
+	/** Maximum number of blocks used at the same time. */
+	uint32_t max_used_cnt;
+
+	/** Number of allocations that did not fit in this class and were served by a larger one. */
+	uint32_t borrow_cnt;
+};
+
+/** Allocate memory from the memory pool.
+ *
+ * The memory is taken from the smallest size class that fits the requested size.
+ * If the class is exhausted, larger classes may be used depending on configuration.
+ * If no class can serve the request, the heap may be used depending on configuration.
+ *
+ * @param size Requested size.
+ *
+ * @return Pointer to the allocated memory or NULL on failure.
+ */
+void *app_event_manager_mem_pool_alloc(size_t size);
+
+/** Free memory allocated with @ref app_event_manager_mem_pool_alloc.
+ *
+ * @param addr Pointer to the memory.
+ */
+void app_event_manager_mem_pool_free(void *addr);
+
+/** Get number of size classes of the memory pool.
+ *
+ * @return Number of size classes.
+ */
+size_t app_event_manager_mem_pool_class_cnt(void);
+
+/** Get statistics of a size class.
+ *
+ * @param idx   Index of the size class.
+ * @param stats Pointer to the structure to be filled.
+ *
+ * @retval 0       If the operation was successful.
+ * @retval -EINVAL If the index is invalid.
+ */
+int app_event_manager_mem_pool_stats_get(size_t idx, struct app_event_manager_mem_pool_stats *stats);
+
+/** Get number of allocations served by the heap because the pool was exhausted.
+ *
+ * @return Number of heap allocations.
+ */
+uint32_t app_event_manager_mem_pool_heap_fallback_cnt(void);
+
+/** Get number of allocations that could not be served.
+ *
+ * @return Number of failed allocations.
+ */
+uint32_t app_event_manager_mem_pool_fail_cnt(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _APP_EVENT_MANAGER_MEM_POOL_H_ */
@@ -16,6 +16,7 @@
 #include <zephyr/types.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/mpsc_lockfree.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -219,14 +220,26 @@ extern "C" {
 #define _APP_EVENT_TYPE_DEFINE_SIZES(ename)
 #endif
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)
+#define _APP_EVENT_TYPE_DEFINE_COALESCE_KEY(key_fn)	\
+	.coalesce_key_func = (key_fn),
+#else
+#define _APP_EVENT_TYPE_DEFINE_COALESCE_KEY(key_fn)
+#endif
+
 /** @brief Event header.
  *
  * When defining an event structure, the application event header
  * must be placed as the first field.
  */
 struct app_event_header {
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_QUEUE_MPSC)
+	/** Lock-free queue node used to chain events. */
+	struct mpsc_node node;
+#else
 	/** Linked list node used to chain events. */
 	sys_snode_t node;
+#endif
 
 	/** Pointer to the event type object. */
 	const struct event_type *type_id;
@@ -235,6 +248,9 @@ struct app_event_header {
 /** Function to log data from this event. */
 typedef void (*log_event_data)(const struct app_event_header *aeh);
 
+/** Function to get the coalescing key of this event. */
+typedef uint32_t (*coalesce_key_get)(const struct app_event_header *aeh);
+
 /** Deprecated function to log data from this event. */
 typedef	int (*log_event_data_dep)(const struct app_event_header *aeh,
 				  char *buf,
@@ -292,6 +308,11 @@ struct event_type {
 	/** The size of the event structure */
 	uint16_t struct_size;
 #endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)
+	/** Function to get the coalescing key of this event. */
+	coalesce_key_get coalesce_key_func;
+#endif
 };
 
 
@@ -299,10 +320,32 @@ extern struct event_type _event_type_list_start[];
 extern struct event_type _event_type_list_end[];
 
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL) && \
+	!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL_HEAP_FALLBACK)
+#define _APP_EVENT_TYPE_DEFINE_MEM_POOL_CHECK(ename)					\
+	BUILD_ASSERT(sizeof(struct ename) <= CONFIG_APP_EVENT_MANAGER_MEM_POOL_CLASS3_SIZE,	\
+		     "Event " STRINGIFY(ename) " does not fit in the memory pool");
+#else
+#define _APP_EVENT_TYPE_DEFINE_MEM_POOL_CHECK(ename)
+#endif
+
 #define _APP_EVENT_TYPE_DEFINE(ename, log_fn, trace_data_pointer, et_flags)		\
+	_APP_EVENT_TYPE_DEFINE_KEYED(ename, log_fn, trace_data_pointer, et_flags, NULL)
+
+#define _APP_EVENT_TYPE_DEFINE_COALESCED(ename, log_fn, trace_data_pointer, et_flags,	\
+					 key_fn)					\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE),			\
+		     "Enable APP_EVENT_MANAGER_COALESCE before usage");			\
+	BUILD_ASSERT(!_CONCAT(ename, _HAS_DYNDATA),					\
+		     "Events with dynamic data cannot be coalesced");			\
+	_APP_EVENT_TYPE_DEFINE_KEYED(ename, log_fn, trace_data_pointer,			\
+		((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_COALESCE)), key_fn)
+
+#define _APP_EVENT_TYPE_DEFINE_KEYED(ename, log_fn, trace_data_pointer, et_flags, key_fn)	\
 	BUILD_ASSERT(((et_flags) & ((BIT_MASK(APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START-	\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
+	_APP_EVENT_TYPE_DEFINE_MEM_POOL_CHECK(ename)					\
 	_APP_EVENT_SUBSCRIBERS_ARRAY_TAGS(ename);					\
 	STRUCT_SECTION_ITERABLE(event_type, _CONCAT(__event_type_, ename)) = {		\
 		.name            = STRINGIFY(ename),					\
@@ -315,6 +358,7 @@ extern struct event_type _event_type_list_end[];
 				((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) :	\
 				((et_flags) & (~BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)))),\
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
+		_APP_EVENT_TYPE_DEFINE_COALESCE_KEY(key_fn) /* No comma here intentionally */\
 	}
 
 /**
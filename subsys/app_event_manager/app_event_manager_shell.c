@@ -8,6 +8,8 @@
 #include <zephyr/shell/shell.h>
 #include <app_event_manager.h>
 
+#include "app_event_manager_mem_pool.h"
+
 
 static int show_events(const struct shell *shell, size_t argc,
 		char **argv)
@@ -27,6 +29,13 @@ static int show_events(const struct shell *shell, size_t argc,
 				'E' : 'D',
 			      ev_id,
 			      et->name);
+
+#ifdef CONFIG_APP_EVENT_MANAGER_COALESCE
+		if (app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_COALESCE)) {
+			shell_fprintf(shell, SHELL_NORMAL, "|\tcoalesced: %u\n",
+				      app_event_manager_coalesced_cnt_get(et));
+		}
+#endif
 	}
 
 	return 0;
@@ -81,6 +90,34 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#ifdef CONFIG_APP_EVENT_MANAGER_MEM_POOL
+static int show_mem_pool(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Memory pool size classes:\n");
+
+	for (size_t i = 0; i < app_event_manager_mem_pool_class_cnt(); i++) {
+		struct app_event_manager_mem_pool_stats stats;
+		int err = app_event_manager_mem_pool_stats_get(i, &stats);
+
+		__ASSERT_NO_MSG(!err);
+		ARG_UNUSED(err);
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t%zu: block size %zu, used %u/%u, max used %u, borrowed %u\n",
+			      i, stats.block_size, stats.used_cnt, stats.block_cnt,
+			      stats.max_used_cnt, stats.borrow_cnt);
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "Heap fallback allocations: %u\n",
+		      app_event_manager_mem_pool_heap_fallback_cnt());
+	shell_fprintf(shell, SHELL_NORMAL, "Failed allocations: %u\n",
+		      app_event_manager_mem_pool_fail_cnt());
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_MEM_POOL */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +192,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_MEM_POOL, show_mem_pool, NULL,
+			   "Show event memory pool statistics", show_mem_pool, 0, 0),
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
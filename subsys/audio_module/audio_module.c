@@ -11,6 +11,7 @@
 #include <ctype.h>
 #include <zephyr/kernel.h>
 #include <zephyr/shell/shell.h>
+#include <zephyr/sys/atomic.h>
 #include <data_fifo.h>
 
 #include <zephyr/logging/log.h>
@@ -130,34 +131,94 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 		return false;
 	}
 
+	if (parameters->thread.data_slab != NULL &&
+	    parameters->thread.data_slab->info.num_blocks > CONFIG_AUDIO_MODULE_DATA_BUFFERS_MAX) {
+		LOG_ERR("Data slab has more than %d buffers", CONFIG_AUDIO_MODULE_DATA_BUFFERS_MAX);
+		return false;
+	}
+
 	return true;
 }
 
+/**
+ * @brief Helper function to get the reference count of an output audio data buffer.
+ *
+ * @param handle  [in]  The handle of the module owning the buffer.
+ * @param data    [in]  Pointer to the buffer.
+ *
+ * @return Pointer to the reference count of the buffer.
+ */
+static atomic_t *data_ref_count_get(struct audio_module_handle *handle, void const *data)
+{
+	struct k_mem_slab *slab = handle->thread.data_slab;
+	size_t index = ((uint8_t const *)data - (uint8_t const *)slab->buffer) /
+		       slab->info.block_size;
+
+	__ASSERT(index < slab->info.num_blocks, "Audio data not from the slab of module %s",
+		 handle->name);
+
+	return &handle->data_ref_count[index];
+}
+
+#if CONFIG_AUDIO_MODULE_STATS
+/**
+ * @brief Helper function to update the processing statistics of a module.
+ *
+ * @param handle  [in/out]  The handle for this modules instance.
+ * @param msg_rx  [in]      Pointer to the processed message, NULL for an input module.
+ * @param start   [in]      Cycle count when the processing started.
+ */
+static void stats_update(struct audio_module_handle *handle,
+			 struct audio_module_message const *const msg_rx, uint32_t start)
+{
+	uint32_t now = k_cycle_get_32();
+	uint32_t process_cycles = now - start;
+	struct audio_module_stats *stats = &handle->stats;
+
+	stats->data_count++;
+	stats->process_cycles_last = process_cycles;
+	stats->process_cycles_max = MAX(stats->process_cycles_max, process_cycles);
+	stats->process_cycles_total += process_cycles;
+
+	if (msg_rx != NULL) {
+		uint32_t latency_cycles = now - msg_rx->timestamp;
+
+		stats->latency_cycles_last = latency_cycles;
+		stats->latency_cycles_max = MAX(stats->latency_cycles_max, latency_cycles);
+		stats->latency_cycles_total += latency_cycles;
+	}
+}
+#else
+static void stats_update(struct audio_module_handle *handle,
+			 struct audio_module_message const *const msg_rx, uint32_t start)
+{
+}
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
 /**
  * @brief General callback for releasing the data when inter-module data
  *        passing.
  *
- * @param handle      [in/out]  The handle of the sending modules instance.
+ * @param handle      [in/out]  The handle of the module owning the audio data.
  * @param audio_data  [in]      Pointer to the audio data to release.
  */
 static void audio_data_release_cb(struct audio_module_handle_private *handle,
 				  struct audio_data const *const audio_data)
 {
-	int ret;
 	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
 
-	ret = k_sem_take(&hdl->sem, K_NO_WAIT);
-	if (ret) {
-		LOG_ERR("Failed to take semaphore for data release callback function");
+	if (atomic_dec(data_ref_count_get(hdl, audio_data->data)) != 1) {
 		return;
 	}
 
-	if (k_sem_count_get(&hdl->sem) == 0) {
-		LOG_DBG("Audio data has been consumed in module %s", hdl->name);
+	LOG_DBG("Audio data has been consumed in module %s", hdl->name);
 
-		/* Audio data has been consumed by all modules so now can free the data memory. */
-		k_mem_slab_free(hdl->thread.data_slab, (void *)audio_data->data);
+	if (hdl->description->functions->data_release != NULL) {
+		hdl->description->functions->data_release(handle, audio_data);
 	}
+
+	/* Audio data has been consumed by all modules so now can free the data memory. */
+	k_mem_slab_free(hdl->thread.data_slab, (void *)audio_data->data);
 }
 
 /**
@@ -190,6 +251,9 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
 		memcpy(&(data_msg_rx->audio_data), audio_data, sizeof(struct audio_data));
 		data_msg_rx->tx_handle = tx_handle;
 		data_msg_rx->response_cb = data_in_response_cb;
+#if CONFIG_AUDIO_MODULE_STATS
+		data_msg_rx->timestamp = k_cycle_get_32();
+#endif /* CONFIG_AUDIO_MODULE_STATS */
 
 		ret = data_fifo_block_lock(rx_handle->thread.msg_rx, (void **)&data_msg_rx,
 					   sizeof(struct audio_module_message));
@@ -216,11 +280,12 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
  * @brief Send audio data item to the module's TX FIFO.
  *
  * @param handle      [in/out]  The handle for this modules instance.
+ * @param owner       [in/out]  The handle of the module owning the audio data.
  * @param audio_data  [in]      A pointer to the audio data.
  *
  * @return 0 if successful, error otherwise.
  */
-static int tx_fifo_put(struct audio_module_handle *handle,
+static int tx_fifo_put(struct audio_module_handle *handle, struct audio_module_handle *owner,
 		       struct audio_data const *const audio_data)
 {
 	int ret;
@@ -236,7 +301,7 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 
 	/* Configure audio data. */
 	memcpy(&data_msg_tx->audio_data, audio_data, sizeof(struct audio_data));
-	data_msg_tx->tx_handle = handle;
+	data_msg_tx->tx_handle = owner;
 	data_msg_tx->response_cb = audio_data_release_cb;
 
 	/* Send audio data to modules output message queue. */
@@ -248,11 +313,6 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 
 		data_fifo_block_free(handle->thread.msg_tx, (void *)data_msg_tx);
 
-		ret = k_sem_take(&handle->sem, K_NO_WAIT);
-		if (ret) {
-			LOG_ERR("Failed to take semaphore for TX FIFO put");
-		}
-
 		return ret;
 	}
 
@@ -264,83 +324,84 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 /**
  * @brief Send the audio data item to all connected modules.
  *
+ * @note The audio data is not copied, every connected module takes a reference to the
+ *       buffer of the owning module. The buffer is released when the last module has
+ *       consumed it.
+ *
  * @param handle      [in/out]  The handle for this modules instance.
+ * @param owner       [in/out]  The handle of the module owning the audio data.
  * @param audio_data  [in]      A pointer to the audio data.
  *
  * @return 0 if successful, error otherwise.
  */
 static int send_to_connected_modules(struct audio_module_handle *handle,
+				     struct audio_module_handle *owner,
 				     struct audio_data const *const audio_data)
 {
 	int ret;
+	int err = 0;
 	struct audio_module_handle *handle_to;
+	atomic_t *ref_count = data_ref_count_get(owner, audio_data->data);
 
-	if (handle->dest_count == 0) {
-		LOG_WRN("Nowhere to send the audio data from module %s so releasing it",
-			handle->name);
-
-		k_mem_slab_free(handle->thread.data_slab, (void *)audio_data->data);
-
-		return 0;
-	}
-
-	/* We need to ensure that all receiving modules have got the audio data.
-	 * This is so the first receiver cannot free the audio data before all receivers
-	 * have all gotten the audio data.
+	/* Hold a reference while sending, so the first receiver cannot free the audio data
+	 * before all receivers have gotten it. This is also released if there is nowhere to
+	 * send the audio data.
 	 */
+	atomic_inc(ref_count);
+
 	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
 	if (ret) {
 		LOG_ERR("Failed to take MUTEX lock in time");
-		return ret;
-	}
-
-	/* Here the semaphore is used as a count of the number of audio data items out in the
-	 * connected modules.
-	 */
-	ret = k_sem_init(&handle->sem, handle->dest_count, handle->dest_count);
-	if (ret) {
-		LOG_ERR("Failed to initiate semaphore");
+		audio_data_release_cb((struct audio_module_handle_private *)owner, audio_data);
 		return ret;
 	}
 
 	/* Send to all internally connected modules. */
 	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
-		ret = data_tx(handle, handle_to, audio_data, &audio_data_release_cb);
+		atomic_inc(ref_count);
+
+		ret = data_tx(owner, handle_to, audio_data, &audio_data_release_cb);
 		if (ret) {
 			LOG_ERR("Failed to send audio data to module %s from %s, ret %d",
 				handle_to->name, handle->name, ret);
 
-			return ret;
+			atomic_dec(ref_count);
+			err = ret;
 		}
 	}
 
 	ret = k_mutex_unlock(&handle->dest_mutex);
 	if (ret) {
 		LOG_ERR("Failed to release MUTEX");
-		return ret;
+		err = ret;
 	}
 
 	/* Send to this module's TX FIFO for extraction by an external
 	 * process with audio_module_rx().
 	 */
 	if (handle->use_tx_queue && handle->thread.msg_tx) {
-		ret = tx_fifo_put(handle, audio_data);
+		atomic_inc(ref_count);
+
+		ret = tx_fifo_put(handle, owner, audio_data);
 		if (ret) {
 			LOG_ERR("Failed to send audio data on module %s TX message queue",
 				handle->name);
 
-			ret = k_sem_take(&handle->sem, K_NO_WAIT);
-			if (ret) {
-				LOG_ERR("Failed to take semaphore");
-			}
-
-			return ret;
+			atomic_dec(ref_count);
+			err = ret;
+		} else {
+			LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 		}
+	}
 
-		LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
+	if (handle->dest_count == 0) {
+		LOG_WRN("Nowhere to send the audio data from module %s so releasing it",
+			handle->name);
 	}
 
-	return 0;
+	audio_data_release_cb((struct audio_module_handle_private *)owner, audio_data);
+
+	return err;
 }
 
 /**
@@ -366,6 +427,8 @@ static void module_thread_input(struct audio_module_handle *handle, void *p2, vo
 
 	/* Execute thread */
 	while (1) {
+		uint32_t start;
+
 		data = NULL;
 
 		/* Get a new output buffer.
@@ -380,8 +443,10 @@ static void module_thread_input(struct audio_module_handle *handle, void *p2, vo
 		audio_data.data_size = handle->thread.data_size;
 
 		/* Process the input audio data */
+		start = k_cycle_get_32();
 		ret = handle->description->functions->data_process(
 			(struct audio_module_handle_private *)handle, NULL, &audio_data);
+		stats_update(handle, NULL, start);
 		if (ret) {
 			k_mem_slab_free(handle->thread.data_slab, (void *)(data));
 
@@ -392,7 +457,7 @@ static void module_thread_input(struct audio_module_handle *handle, void *p2, vo
 		LOG_DBG("Module %s received new audio data ", handle->name);
 
 		/* Send input audio data to next module(s). */
-		send_to_connected_modules(handle, &audio_data);
+		send_to_connected_modules(handle, handle, &audio_data);
 	}
 
 	CODE_UNREACHABLE;
@@ -415,6 +480,7 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 
 	struct audio_module_message *msg_rx;
 	size_t size;
+	uint32_t start;
 
 	__ASSERT(handle != NULL, "Module task has NULL handle");
 	__ASSERT(handle->description->functions->data_process != NULL,
@@ -437,8 +503,10 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 		LOG_DBG("Module %s new audio data received", handle->name);
 
 		/* Process the input audio data and output from the audio system. */
+		start = k_cycle_get_32();
 		ret = handle->description->functions->data_process(
 			(struct audio_module_handle_private *)handle, &msg_rx->audio_data, NULL);
+		stats_update(handle, msg_rx, start);
 		if (ret) {
 			if (msg_rx->response_cb != NULL) {
 				msg_rx->response_cb(
@@ -475,9 +543,11 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 {
 	int ret;
 	struct audio_module_message *msg_rx;
+	struct audio_module_handle *owner;
 	struct audio_data audio_data;
 	void *data;
 	size_t size;
+	uint32_t start;
 
 	__ASSERT(handle != NULL, "Module task has NULL handle");
 	__ASSERT(handle->description->functions->data_process != NULL,
@@ -505,9 +575,11 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 		audio_data.data_size = handle->thread.data_size;
 
 		/* Process the input audio data into the output audio data. */
+		start = k_cycle_get_32();
 		ret = handle->description->functions->data_process(
 			(struct audio_module_handle_private *)handle, &msg_rx->audio_data,
 			&audio_data);
+		stats_update(handle, msg_rx, start);
 		if (ret) {
 			if (msg_rx->response_cb != NULL) {
 				msg_rx->response_cb(
@@ -523,8 +595,31 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 			continue;
 		}
 
+		owner = handle;
+
+		if (audio_data.data != data && audio_data.data == msg_rx->audio_data.data) {
+			if (msg_rx->response_cb == audio_data_release_cb) {
+				/* The input is forwarded, so pass on the buffer of the module owning
+				 * it instead of the new output buffer.
+				 */
+				k_mem_slab_free(handle->thread.data_slab, data);
+				owner = msg_rx->tx_handle;
+#if CONFIG_AUDIO_MODULE_STATS
+				handle->stats.forward_count++;
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+			} else {
+				/* The input buffer is owned outside of the audio modules and cannot
+				 * be referenced after the response, so it must be copied.
+				 */
+				audio_data.data_size =
+					MIN(audio_data.data_size, handle->thread.data_size);
+				memcpy(data, audio_data.data, audio_data.data_size);
+				audio_data.data = data;
+			}
+		}
+
 		/* Send processed audio data to next module(s). */
-		send_to_connected_modules(handle, &audio_data);
+		send_to_connected_modules(handle, owner, &audio_data);
 
 		if (msg_rx->response_cb != NULL) {
 			msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
@@ -695,7 +790,7 @@ int audio_module_close(struct audio_module_handle *handle)
 
 	/*
 	 * TODO: How to return all the data to the slab items?
-	 *       Test the semaphore and wait for it to be zero.
+	 *       Test the data reference counts and wait for them to be zero.
 	 */
 
 	k_thread_abort(handle->thread_id);
@@ -1237,6 +1332,43 @@ int audio_module_state_get(struct audio_module_handle const *const handle,
 	return 0;
 };
 
+#if CONFIG_AUDIO_MODULE_STATS
+int audio_module_stats_get(struct audio_module_handle const *const handle,
+			   struct audio_module_stats *stats)
+{
+	if (handle == NULL || stats == NULL) {
+		LOG_ERR("Input parameter is NULL");
+		return -EINVAL;
+	}
+
+	if (!state_not_undefined(handle->state)) {
+		LOG_ERR("Module %s is in an invalid state, %d", handle->name, handle->state);
+		return -ECANCELED;
+	}
+
+	memcpy(stats, &handle->stats, sizeof(struct audio_module_stats));
+
+	return 0;
+}
+
+int audio_module_stats_reset(struct audio_module_handle *handle)
+{
+	if (handle == NULL) {
+		LOG_ERR("Module handle is NULL");
+		return -EINVAL;
+	}
+
+	if (!state_not_undefined(handle->state)) {
+		LOG_ERR("Module %s is in an invalid state, %d", handle->name, handle->state);
+		return -ECANCELED;
+	}
+
+	memset(&handle->stats, 0, sizeof(struct audio_module_stats));
+
+	return 0;
+}
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
 int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_channels)
 {
 	if (number_channels == NULL) {
@@ -11,7 +11,9 @@
 
 #include <zephyr/bluetooth/hci_types.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
 #include <dsp/transform_functions.h>
+#include <dsp/complex_math_functions.h>
 #include <dsp/fast_math_functions.h>
 #include <dsp/statistics_functions.h>
 #include <arm_const_structs.h>
@@ -34,10 +36,16 @@ LOG_MODULE_REGISTER(cs_de, CONFIG_BT_CS_DE_LOG_LEVEL);
 #define DMEYR		    (1)
 #define NORMAL_PEAK_TO_NULL ((CONFIG_BT_CS_DE_NFFT_SIZE + NUM_CHANNELS - 1) / (NUM_CHANNELS))
 
+/* CMSIS-DSP FFT instance of the configured size, for example arm_cfft_sR_q31_len512. */
+#define CFFT_INSTANCE(type)                                                                        \
+	UTIL_CAT(UTIL_CAT(arm_cfft_sR_, type), UTIL_CAT(_len, CONFIG_BT_CS_DE_NFFT_SIZE))
+
+/* Fraction of the fixed-point full scale used by the largest input value. */
+#define FIXED_POINT_FULL_SCALE (0.99f)
+
+BUILD_ASSERT(ARRAY_SIZE(((cs_de_iq_tones_t *)0)->i_local) == NUM_CHANNELS);
+
 static float m_iq_scratch_mem[2 * CONFIG_BT_CS_DE_NFFT_SIZE];
-static uint16_t m_n_iqs[CONFIG_BT_RAS_MAX_ANTENNA_PATHS][NUM_CHANNELS];
-static cs_de_tone_quality_t m_tone_quality_indicators[CONFIG_BT_RAS_MAX_ANTENNA_PATHS]
-						     [NUM_CHANNELS];
 
 static void calculate_vec_cmac_f(float *iq_result, const float *i_1, const float *q_1,
 				 const float *i_2, const float *q_2)
@@ -161,6 +169,7 @@ static int32_t calculate_left_null_compensation_of_peak(int32_t peak_index,
 	return compensated_peak_index;
 }
 
+#if CONFIG_BT_CS_DE_IFFT_F32
 static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
 {
 	/* This function calculates the magnitude of the IFFT of the input IQ values.
@@ -183,15 +192,7 @@ static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE
 	}
 
 	/* Perform the FFT. */
-	#if CONFIG_BT_CS_DE_NFFT_SIZE == 512
-		arm_cfft_f32(&arm_cfft_sR_f32_len512, iq_tones_comb, 0, 1);
-	#elif CONFIG_BT_CS_DE_NFFT_SIZE == 1024
-		arm_cfft_f32(&arm_cfft_sR_f32_len1024, iq_tones_comb, 0, 1);
-	#elif CONFIG_BT_CS_DE_NFFT_SIZE == 2048
-		arm_cfft_f32(&arm_cfft_sR_f32_len2048, iq_tones_comb, 0, 1);
-	#else
-	#error
-	#endif
+	arm_cfft_f32(&CFFT_INSTANCE(f32), iq_tones_comb, 0, 1);
 
 	/* Compute the magnitude of complex values in
 	 * iq_tones_comb[0:2*CONFIG_BT_CS_DE_NFFT_SIZE - 1]
@@ -205,6 +206,60 @@ static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE
 		arm_sqrt_f32((realIn * realIn) + (imagIn * imagIn), &iq_tones_comb[n]);
 	}
 }
+#else
+static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
+{
+	/* Fixed-point variant of the IFFT magnitude calculation, see the floating point variant
+	 * for the steps.
+	 *
+	 * The input is normalized to the fixed-point full scale and converted in place, as the
+	 * fixed-point samples are never larger than the floating point ones. The fixed-point FFT
+	 * scales its output down to avoid overflows, so the magnitudes are only relative. This is
+	 * sufficient, as the peak search and interpolation only compare magnitudes with each other.
+	 * The magnitudes are converted back to floating point in place, starting from the end of
+	 * the array so that no fixed-point value is overwritten before it is read.
+	 */
+#if CONFIG_BT_CS_DE_IFFT_Q31
+	q31_t *iq_fixed = (q31_t *)iq_tones_comb;
+	const float full_scale = FIXED_POINT_FULL_SCALE * 2147483648.0f;
+#else
+	q15_t *iq_fixed = (q15_t *)iq_tones_comb;
+	const float full_scale = FIXED_POINT_FULL_SCALE * 32768.0f;
+#endif
+	float max = 0.0f;
+	float scale;
+
+	for (uint32_t i = 0; i < 2 * NUM_CHANNELS; i++) {
+		max = fmaxf(max, fabsf(iq_tones_comb[i]));
+	}
+
+	scale = (max > 0.0f) ? (full_scale / max) : 0.0f;
+
+	/* Normalize and complex conjugate the input. */
+	for (uint32_t i = 0; i < 2 * NUM_CHANNELS; i++) {
+		float value = iq_tones_comb[i] * scale;
+
+		iq_fixed[i] = (i & 1) ? -(int32_t)value : (int32_t)value;
+	}
+
+#if CONFIG_BT_CS_DE_IFFT_Q31
+	arm_cfft_q31(&CFFT_INSTANCE(q31), iq_fixed, 0, 1);
+	arm_cmplx_mag_q31(iq_fixed, iq_fixed, CONFIG_BT_CS_DE_NFFT_SIZE);
+#else
+	/* The Q15 samples are half the size of the floating point ones, so the zero padding
+	 * still holds part of the floating point input.
+	 */
+	memset(&iq_fixed[2 * NUM_CHANNELS], 0,
+	       (2 * (CONFIG_BT_CS_DE_NFFT_SIZE - NUM_CHANNELS)) * sizeof(q15_t));
+	arm_cfft_q15(&CFFT_INSTANCE(q15), iq_fixed, 0, 1);
+	arm_cmplx_mag_q15(iq_fixed, iq_fixed, CONFIG_BT_CS_DE_NFFT_SIZE);
+#endif
+
+	for (uint32_t n = CONFIG_BT_CS_DE_NFFT_SIZE; n-- > 0;) {
+		iq_tones_comb[n] = (float)iq_fixed[n];
+	}
+}
+#endif /* CONFIG_BT_CS_DE_IFFT_F32 */
 
 static uint32_t find_ifft_peak_index(float ifft_mag[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
 {
@@ -291,30 +346,27 @@ static void calculate_dist_rtt(cs_de_report_t *p_report)
 	}
 }
 
-static bool m_is_tone_quality_ok(cs_de_tone_quality_t *p_tone_qi, uint8_t channel_map[10])
+static bool m_is_tone_quality_ok(const uint16_t *p_n_iqs, const uint8_t channel_map[10])
 {
 	uint8_t ok_tones_count = 0;
 	for (uint8_t i = 0; i < NUM_CHANNELS; ++i) {
 		if (BT_LE_CS_CHANNEL_BIT_GET(channel_map, i + CHANNEL_INDEX_OFFSET) &&
-		    p_tone_qi[i] == CS_DE_TONE_QUALITY_OK) {
+		    p_n_iqs[i] > 0) {
 			ok_tones_count += 1;
 		}
 	}
 	return (ok_tones_count >= TONE_QI_OK_TONE_COUNT_THRESHOLD);
 }
 
-static void cumulate_mean(float *avg, float new_value, uint16_t *N)
-{
-	float a = 1.0f / (*N);
-	float b = 1.0f - a;
-	*avg = a * new_value + b * (*avg);
-}
-
 static void extract_pcts(cs_de_report_t *p_report, uint8_t channel_index,
 			 uint8_t antenna_permutation_index,
-			 struct bt_hci_le_cs_step_data_tone_info *local_tone_info,
-			 struct bt_hci_le_cs_step_data_tone_info *remote_tone_info)
+			 const struct bt_hci_le_cs_step_data_tone_info *local_tone_info,
+			 const struct bt_hci_le_cs_step_data_tone_info *remote_tone_info)
 {
+	if (channel_index >= NUM_CHANNELS) {
+		LOG_WRN("Invalid channel.");
+		return;
+	}
 
 	for (uint8_t tone_index = 0; tone_index < p_report->n_ap; tone_index++) {
 		int antenna_path = bt_le_cs_get_antenna_path(p_report->n_ap,
@@ -336,30 +388,18 @@ static void extract_pcts(cs_de_report_t *p_report, uint8_t channel_index,
 		struct bt_le_cs_iq_sample remote_iq =
 			bt_le_cs_parse_pct(remote_tone_info[tone_index].phase_correction_term);
 
-		m_n_iqs[antenna_path][channel_index]++;
-		m_tone_quality_indicators[antenna_path][channel_index] = CS_DE_TONE_QUALITY_OK;
-
-		if (m_n_iqs[antenna_path][channel_index] == 1) {
-			p_report->iq_tones[antenna_path].i_local[channel_index] = local_iq.i;
-			p_report->iq_tones[antenna_path].q_local[channel_index] = local_iq.q;
-			p_report->iq_tones[antenna_path].i_remote[channel_index] = remote_iq.i;
-			p_report->iq_tones[antenna_path].q_remote[channel_index] = remote_iq.q;
-		} else {
-			cumulate_mean(&p_report->iq_tones[antenna_path].i_local[channel_index],
-				      local_iq.i, &m_n_iqs[antenna_path][channel_index]);
-			cumulate_mean(&p_report->iq_tones[antenna_path].q_local[channel_index],
-				      local_iq.q, &m_n_iqs[antenna_path][channel_index]);
-			cumulate_mean(&p_report->iq_tones[antenna_path].i_remote[channel_index],
-				      remote_iq.i, &m_n_iqs[antenna_path][channel_index]);
-			cumulate_mean(&p_report->iq_tones[antenna_path].q_remote[channel_index],
-				      remote_iq.q, &m_n_iqs[antenna_path][channel_index]);
-		}
+		/* Only sum up the tones here, they are averaged once in cs_de_report_finalize(). */
+		p_report->n_iqs[antenna_path][channel_index]++;
+		p_report->iq_tones[antenna_path].i_local[channel_index] += local_iq.i;
+		p_report->iq_tones[antenna_path].q_local[channel_index] += local_iq.q;
+		p_report->iq_tones[antenna_path].i_remote[channel_index] += remote_iq.i;
+		p_report->iq_tones[antenna_path].q_remote[channel_index] += remote_iq.q;
 	}
 }
 
 static void extract_rtt_timings(cs_de_report_t *p_report,
-				struct bt_hci_le_cs_step_data_mode_1 *local_rtt_data,
-				struct bt_hci_le_cs_step_data_mode_1 *peer_rtt_data)
+				const struct bt_hci_le_cs_step_data_mode_1 *local_rtt_data,
+				const struct bt_hci_le_cs_step_data_mode_1 *peer_rtt_data)
 {
 	if (local_rtt_data->packet_quality_aa_check !=
 		    BT_HCI_LE_CS_PACKET_QUALITY_AA_CHECK_SUCCESSFUL ||
@@ -397,63 +437,76 @@ static bool process_ranging_header(struct ras_ranging_header *ranging_header, vo
 static bool process_step_data(struct bt_le_cs_subevent_step *local_step,
 			      struct bt_le_cs_subevent_step *peer_step, void *user_data)
 {
-	cs_de_report_t *p_report = (cs_de_report_t *)user_data;
+	cs_de_report_step_add((cs_de_report_t *)user_data, local_step, peer_step);
+
+	return true;
+}
 
+void cs_de_report_init(cs_de_report_t *p_report, enum bt_conn_le_cs_role role, uint8_t n_ap)
+{
+	memset(p_report, 0x0, sizeof(*p_report));
+
+	p_report->role = role;
+	p_report->n_ap = n_ap;
+}
+
+void cs_de_report_step_add(cs_de_report_t *p_report, const struct bt_le_cs_subevent_step *local_step,
+			   const struct bt_le_cs_subevent_step *peer_step)
+{
 	if (local_step->mode == BT_HCI_OP_LE_CS_MAIN_MODE_2) {
-		struct bt_hci_le_cs_step_data_mode_2 *local_step_data =
-			(struct bt_hci_le_cs_step_data_mode_2 *)local_step->data;
-		struct bt_hci_le_cs_step_data_mode_2 *peer_step_data =
-			(struct bt_hci_le_cs_step_data_mode_2 *)peer_step->data;
+		const struct bt_hci_le_cs_step_data_mode_2 *local_step_data =
+			(const struct bt_hci_le_cs_step_data_mode_2 *)local_step->data;
+		const struct bt_hci_le_cs_step_data_mode_2 *peer_step_data =
+			(const struct bt_hci_le_cs_step_data_mode_2 *)peer_step->data;
 
 		extract_pcts(p_report, local_step->channel - CHANNEL_INDEX_OFFSET,
 			     local_step_data->antenna_permutation_index, local_step_data->tone_info,
 			     peer_step_data->tone_info);
 	} else if (local_step->mode == BT_HCI_OP_LE_CS_MAIN_MODE_1) {
-		struct bt_hci_le_cs_step_data_mode_1 *local_step_data =
-			(struct bt_hci_le_cs_step_data_mode_1 *)local_step->data;
-		struct bt_hci_le_cs_step_data_mode_1 *peer_step_data =
-			(struct bt_hci_le_cs_step_data_mode_1 *)peer_step->data;
+		const struct bt_hci_le_cs_step_data_mode_1 *local_step_data =
+			(const struct bt_hci_le_cs_step_data_mode_1 *)local_step->data;
+		const struct bt_hci_le_cs_step_data_mode_1 *peer_step_data =
+			(const struct bt_hci_le_cs_step_data_mode_1 *)peer_step->data;
 
 		extract_rtt_timings(p_report, local_step_data, peer_step_data);
 	} else if (local_step->mode == BT_HCI_OP_LE_CS_MAIN_MODE_3) {
-		struct bt_hci_le_cs_step_data_mode_3 *local_step_data =
-			(struct bt_hci_le_cs_step_data_mode_3 *)local_step->data;
-		struct bt_hci_le_cs_step_data_mode_3 *peer_step_data =
-			(struct bt_hci_le_cs_step_data_mode_3 *)peer_step->data;
+		const struct bt_hci_le_cs_step_data_mode_3 *local_step_data =
+			(const struct bt_hci_le_cs_step_data_mode_3 *)local_step->data;
+		const struct bt_hci_le_cs_step_data_mode_3 *peer_step_data =
+			(const struct bt_hci_le_cs_step_data_mode_3 *)peer_step->data;
 
 		extract_pcts(p_report, local_step->channel - CHANNEL_INDEX_OFFSET,
 			     local_step_data->antenna_permutation_index, local_step_data->tone_info,
 			     peer_step_data->tone_info);
 
 		extract_rtt_timings(p_report,
-				    (struct bt_hci_le_cs_step_data_mode_1 *)local_step_data,
-				    (struct bt_hci_le_cs_step_data_mode_1 *)peer_step_data);
+				    (const struct bt_hci_le_cs_step_data_mode_1 *)local_step_data,
+				    (const struct bt_hci_le_cs_step_data_mode_1 *)peer_step_data);
 	}
-
-	return true;
 }
 
-void cs_de_populate_report(struct net_buf_simple *local_steps, struct net_buf_simple *peer_steps,
-			   struct bt_conn_le_cs_config *config, cs_de_report_t *p_report)
+void cs_de_report_finalize(cs_de_report_t *p_report, const uint8_t channel_map[10])
 {
-	memset(p_report, 0x0, sizeof(*p_report));
-	memset(m_n_iqs, 0, sizeof(m_n_iqs));
-	memset(m_tone_quality_indicators, CS_DE_TONE_QUALITY_BAD,
-	       sizeof(m_tone_quality_indicators));
+	for (uint8_t ap = 0; ap < p_report->n_ap; ap++) {
+		cs_de_iq_tones_t *iq_tones = &p_report->iq_tones[ap];
 
-	p_report->role = config->role;
+		for (uint8_t i = 0; i < NUM_CHANNELS; i++) {
+			if (p_report->n_iqs[ap][i] > 1) {
+				float a = 1.0f / p_report->n_iqs[ap][i];
 
-	bt_ras_rreq_rd_subevent_data_parse(peer_steps, local_steps, config->role,
-					   process_ranging_header, NULL, process_step_data,
-					   p_report);
+				iq_tones->i_local[i] *= a;
+				iq_tones->q_local[i] *= a;
+				iq_tones->i_remote[i] *= a;
+				iq_tones->q_remote[i] *= a;
+			}
+		}
 
-	for (uint8_t ap = 0; ap < p_report->n_ap; ap++) {
 		p_report->distance_estimates[ap].ifft = NAN;
 		p_report->distance_estimates[ap].phase_slope = NAN;
 		p_report->distance_estimates[ap].rtt = NAN;
 		p_report->distance_estimates[ap].best = NAN;
 
-		if (m_is_tone_quality_ok(&m_tone_quality_indicators[ap][0], config->channel_map)) {
+		if (m_is_tone_quality_ok(&p_report->n_iqs[ap][0], channel_map)) {
 			p_report->tone_quality[ap] = CS_DE_TONE_QUALITY_OK;
 		} else {
 			p_report->tone_quality[ap] = CS_DE_TONE_QUALITY_BAD;
@@ -461,6 +514,18 @@ void cs_de_populate_report(struct net_buf_simple *local_steps, struct net_buf_si
 	}
 }
 
+void cs_de_populate_report(struct net_buf_simple *local_steps, struct net_buf_simple *peer_steps,
+			   struct bt_conn_le_cs_config *config, cs_de_report_t *p_report)
+{
+	cs_de_report_init(p_report, config->role, 0);
+
+	bt_ras_rreq_rd_subevent_data_parse(peer_steps, local_steps, config->role,
+					   process_ranging_header, NULL, process_step_data,
+					   p_report);
+
+	cs_de_report_finalize(p_report, config->channel_map);
+}
+
 cs_de_quality_t cs_de_calc(cs_de_report_t *p_report)
 {
 	cs_de_quality_t estimation_quality[CONFIG_BT_RAS_MAX_ANTENNA_PATHS];
@@ -22,9 +22,103 @@ static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
 EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
 
+#if defined(CONFIG_BT_MESH_RPL_HASH)
+/* The index uses open addressing with linear probing. Sizing it to twice
+ * the number of RPL entries keeps the probe sequences short.
+ */
+#define RPL_HASH_SIZE (2 * CONFIG_BT_MESH_CRPL + 1)
+
+BUILD_ASSERT(CONFIG_BT_MESH_CRPL < UINT16_MAX, "Too many RPL entries for the RPL index");
+
+/* Position in replay_list plus one for each used slot, zero for a free slot.
+ * The index is only kept in RAM, and is rebuilt from replay_list.
+ */
+static uint16_t rpl_hash[RPL_HASH_SIZE];
+
+/* Number of used entries, which are kept at the start of replay_list. */
+static uint16_t rpl_cnt;
+
+static size_t rpl_hash_slot(uint16_t src)
+{
+	/* Multiplicative hashing, so that addresses assigned with a fixed
+	 * stride do not end up in neighboring slots.
+	 */
+	return ((uint32_t)src * 2654435761U) % RPL_HASH_SIZE;
+}
+
+static struct bt_mesh_rpl *rpl_hash_find(uint16_t src)
+{
+	size_t slot = rpl_hash_slot(src);
+
+	while (rpl_hash[slot]) {
+		struct bt_mesh_rpl *rpl = &replay_list[rpl_hash[slot] - 1];
+
+		if (rpl->src == src) {
+			return rpl;
+		}
+
+		slot = (slot + 1) % RPL_HASH_SIZE;
+	}
+
+	return NULL;
+}
+
+static void rpl_hash_add(uint16_t i)
+{
+	size_t slot = rpl_hash_slot(replay_list[i].src);
+
+	while (rpl_hash[slot]) {
+		slot = (slot + 1) % RPL_HASH_SIZE;
+	}
+
+	rpl_hash[slot] = i + 1;
+}
+
+static void rpl_hash_rebuild(void)
+{
+	(void)memset(rpl_hash, 0, sizeof(rpl_hash));
+
+	for (rpl_cnt = 0; rpl_cnt < ARRAY_SIZE(replay_list); rpl_cnt++) {
+		if (!replay_list[rpl_cnt].src) {
+			break;
+		}
+
+		rpl_hash_add(rpl_cnt);
+	}
+}
+
+/* EMDS restores replay_list at boot, after the mesh stack is initialized.
+ * The restored entries are detected from the number of used entries.
+ */
+static bool rpl_hash_is_stale(void)
+{
+	return (rpl_cnt < ARRAY_SIZE(replay_list) && replay_list[rpl_cnt].src) ||
+	       (rpl_cnt > 0 && !replay_list[rpl_cnt - 1].src);
+}
+
+static void rpl_hash_src_set(struct bt_mesh_rpl *rpl)
+{
+	uint16_t i = rpl - replay_list;
+
+	if (i == rpl_cnt) {
+		rpl_hash_add(i);
+		rpl_cnt++;
+	} else {
+		/* The same free entry was handed out for another source
+		 * before it was updated.
+		 */
+		rpl_hash_rebuild();
+	}
+}
+#endif /* CONFIG_BT_MESH_RPL_HASH */
+
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
+#if defined(CONFIG_BT_MESH_RPL_HASH)
+	bool new_src = (rpl->src != rx->ctx.addr);
+#endif
+
 	/* If this is the first message on the new IV index, we should reset it
 	 * to zero to avoid invalid combinations of IV index and seg.
 	 */
@@ -35,6 +129,37 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 	rpl->src = rx->ctx.addr;
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
+
+#if defined(CONFIG_BT_MESH_RPL_HASH)
+	if (new_src) {
+		rpl_hash_src_set(rpl);
+	}
+#endif
+}
+
+/* Check a free entry or the entry of the source address. */
+static bool rpl_entry_check(struct bt_mesh_rpl *rpl, struct bt_mesh_net_rx *rx,
+			    struct bt_mesh_rpl **match)
+{
+	/* Existing slot for given address */
+	if (rpl->src) {
+		if (rx->old_iv && !rpl->old_iv) {
+			return true;
+		}
+
+		if ((rx->old_iv || !rpl->old_iv) && rpl->seq >= rx->seq) {
+			return true;
+		}
+	}
+
+	/* Empty slot, or a newer message from the address */
+	if (match) {
+		*match = rpl;
+	} else {
+		bt_mesh_rpl_update(rpl, rx);
+	}
+
+	return false;
 }
 
 /* Check the Replay Protection List for a replay attempt. If non-NULL match
@@ -45,7 +170,9 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match, bool bridge)
 {
-	int i;
+#if defined(CONFIG_BT_MESH_RPL_HASH)
+	struct bt_mesh_rpl *rpl;
+#endif
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -57,40 +184,31 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
-
-		/* Empty slot */
-		if (!rpl->src) {
-			if (match) {
-				*match = rpl;
-			} else {
-				bt_mesh_rpl_update(rpl, rx);
-			}
+#if defined(CONFIG_BT_MESH_RPL_HASH)
+	rpl = rpl_hash_find(rx->ctx.addr);
 
-			return false;
-		}
+	if (!rpl && rpl_hash_is_stale()) {
+		rpl_hash_rebuild();
+		rpl = rpl_hash_find(rx->ctx.addr);
+	}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
+	if (rpl) {
+		return rpl_entry_check(rpl, rx, match);
+	}
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
+	if (rpl_cnt < ARRAY_SIZE(replay_list)) {
+		return rpl_entry_check(&replay_list[rpl_cnt], rx, match);
+	}
+#else
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		struct bt_mesh_rpl *rpl = &replay_list[i];
 
-				return false;
-			} else {
-				return true;
-			}
+		/* Empty slot or existing slot for given address */
+		if (!rpl->src || rpl->src == rx->ctx.addr) {
+			return rpl_entry_check(rpl, rx, match);
 		}
 	}
+#endif
 
 	LOG_ERR("RPL is full!");
 	return true;
@@ -99,6 +217,10 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 void bt_mesh_rpl_clear(void)
 {
 	(void)memset(replay_list, 0, sizeof(replay_list));
+
+#if defined(CONFIG_BT_MESH_RPL_HASH)
+	rpl_hash_rebuild();
+#endif
 }
 
 void bt_mesh_rpl_reset(void)
@@ -130,6 +252,11 @@ void bt_mesh_rpl_reset(void)
 	}
 
 	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+
+#if defined(CONFIG_BT_MESH_RPL_HASH)
+	/* Entries have been removed and moved */
+	rpl_hash_rebuild();
+#endif
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
@@ -975,6 +975,92 @@ static int update_handler(const struct bt_mesh_model *model)
 	return (srv->pub.msg->len > original_len) ? 0 : -ENOENT;
 }
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_SAMPLE_BATCH)
+/* Must be called with the batch lock held. */
+static void batch_send(struct bt_mesh_sensor_srv *srv)
+{
+	struct bt_mesh_sensor *s;
+	int err;
+
+	(void)k_work_cancel_delayable(&srv->batch_work);
+
+	if (!srv->batch_buf.len) {
+		return;
+	}
+
+	err = bt_mesh_msg_send(srv->model, NULL, &srv->batch_buf);
+	if (err) {
+		LOG_WRN("Sample batch publication failed: %d", err);
+	}
+
+	net_buf_simple_reset(&srv->batch_buf);
+
+	SENSOR_FOR_EACH(&srv->sensors, s)
+	{
+		s->state.batched = false;
+	}
+}
+
+static void batch_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct bt_mesh_sensor_srv *srv =
+		CONTAINER_OF(dwork, struct bt_mesh_sensor_srv, batch_work);
+
+	k_mutex_lock(&srv->batch_lock, K_FOREVER);
+	batch_send(srv);
+	k_mutex_unlock(&srv->batch_lock);
+}
+
+static int batch_add(struct bt_mesh_sensor_srv *srv,
+		     struct bt_mesh_sensor *sensor,
+		     const struct bt_mesh_sensor_value *value)
+{
+	struct net_buf_simple_state state;
+	int err;
+
+	if (!bt_mesh_is_provisioned()) {
+		return -EAGAIN;
+	}
+
+	if (srv->pub.addr == BT_MESH_ADDR_UNASSIGNED) {
+		return -EADDRNOTAVAIL;
+	}
+
+	k_mutex_lock(&srv->batch_lock, K_FOREVER);
+
+	/* A batch can only hold one value of each sensor. */
+	if (sensor->state.batched) {
+		batch_send(srv);
+	}
+
+	if (!srv->batch_buf.len) {
+		bt_mesh_model_msg_init(&srv->batch_buf,
+				       BT_MESH_SENSOR_OP_STATUS);
+	}
+
+	net_buf_simple_save(&srv->batch_buf, &state);
+	err = sensor_status_encode(&srv->batch_buf, sensor, value);
+	if (err) {
+		net_buf_simple_restore(&srv->batch_buf, &state);
+		goto unlock;
+	}
+
+	sensor_cadence_update(sensor, value);
+
+	sensor->state.prev = value[0];
+	sensor->state.batched = true;
+
+	k_work_schedule(&srv->batch_work,
+			K_MSEC(CONFIG_BT_MESH_SENSOR_SRV_SAMPLE_BATCH_DELAY));
+
+unlock:
+	k_mutex_unlock(&srv->batch_lock);
+
+	return err;
+}
+#endif
+
 static int sensor_srv_init(const struct bt_mesh_model *model)
 {
 	struct bt_mesh_sensor_srv *srv = model->rt->user_data;
@@ -1024,6 +1110,14 @@ static int sensor_srv_init(const struct bt_mesh_model *model)
 	net_buf_simple_init_with_data(&srv->setup_pub_buf, srv->setup_pub_data,
 				      sizeof(srv->setup_pub_data));
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_SAMPLE_BATCH)
+	k_work_init_delayable(&srv->batch_work, batch_timeout);
+	k_mutex_init(&srv->batch_lock);
+	net_buf_simple_init_with_data(&srv->batch_buf, srv->batch_data,
+				      sizeof(srv->batch_data));
+	net_buf_simple_reset(&srv->batch_buf);
+#endif
+
 	return 0;
 }
 
@@ -1034,15 +1128,26 @@ static void sensor_srv_reset(const struct bt_mesh_model *model)
 	net_buf_simple_reset(srv->pub.msg);
 	net_buf_simple_reset(srv->setup_pub.msg);
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_SAMPLE_BATCH)
+	k_mutex_lock(&srv->batch_lock, K_FOREVER);
+	(void)k_work_cancel_delayable(&srv->batch_work);
+	net_buf_simple_reset(&srv->batch_buf);
+#endif
+
 	for (int i = 0; i < srv->sensor_count; ++i) {
 		struct bt_mesh_sensor *s = srv->sensor_array[i];
 
 		s->state.pub_div = 0;
 		s->state.min_int = 0;
 		s->state.configured = false;
+		s->state.batched = false;
 		memset(&s->state.threshold, 0, sizeof(s->state.threshold));
 	}
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_SAMPLE_BATCH)
+	k_mutex_unlock(&srv->batch_lock);
+#endif
+
 	srv->pub.period_div = 0;
 
 	if (IS_ENABLED(CONFIG_BT_SETTINGS)) {
@@ -1182,7 +1287,13 @@ int bt_mesh_sensor_srv_sample(struct bt_mesh_sensor_srv *srv,
 		return -EALREADY;
 	}
 
+#if defined(CONFIG_BT_MESH_SENSOR_SRV_SAMPLE_BATCH)
+	LOG_DBG("Batching 0x%04x", sensor->type->id);
+
+	return batch_add(srv, sensor, value);
+#else
 	LOG_DBG("Publishing 0x%04x", sensor->type->id);
 
 	return bt_mesh_sensor_srv_pub(srv, NULL, sensor, value);
+#endif
 }
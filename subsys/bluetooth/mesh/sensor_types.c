@@ -1761,10 +1761,32 @@ SENSOR_TYPE(total_dev_runtime) = {
 
 /******************************************************************************/
 
+#if CONFIG_BT_MESH_SENSOR_TYPE_CACHE_SIZE > 0
+/* Direct mapped cache of the most recently looked up sensor types, indexed by
+ * the property ID. The type list is sorted by name, not ID, so every miss walks
+ * the full list.
+ */
+static const struct bt_mesh_sensor_type
+	*type_cache[CONFIG_BT_MESH_SENSOR_TYPE_CACHE_SIZE];
+#endif
+
 const struct bt_mesh_sensor_type *bt_mesh_sensor_type_get(uint16_t id)
 {
+#if CONFIG_BT_MESH_SENSOR_TYPE_CACHE_SIZE > 0
+	const struct bt_mesh_sensor_type **slot =
+		&type_cache[id % CONFIG_BT_MESH_SENSOR_TYPE_CACHE_SIZE];
+	const struct bt_mesh_sensor_type *cached = *slot;
+
+	if (cached && cached->id == id) {
+		return cached;
+	}
+#endif
+
 	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
 		if (type->id == id) {
+#if CONFIG_BT_MESH_SENSOR_TYPE_CACHE_SIZE > 0
+			*slot = type;
+#endif
 			return type;
 		}
 	}
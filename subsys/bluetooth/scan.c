@@ -18,6 +18,29 @@ LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+/* The hash tables use open addressing with linear probing. Sizing them
+ * to twice the number of filters keeps the probe sequences short.
+ */
+#define ADDR_INDEX_SIZE (2 * CONFIG_BT_SCAN_ADDRESS_CNT + 1)
+#define UUID_16_INDEX_SIZE (2 * CONFIG_BT_SCAN_UUID_CNT + 1)
+
+/* The name prefix tree has a node for every name character including
+ * the terminating NUL character, and a root node.
+ */
+#define NAME_TREE_SIZE \
+	(CONFIG_BT_SCAN_NAME_CNT * (CONFIG_BT_SCAN_NAME_MAX_LEN + 1) + 1)
+
+#define FNV1A_OFFSET_BASIS 2166136261U
+#define FNV1A_PRIME 16777619U
+
+BUILD_ASSERT(NAME_TREE_SIZE <= UINT16_MAX,
+	     "Too many name filters for the name prefix tree");
+BUILD_ASSERT((CONFIG_BT_SCAN_ADDRESS_CNT < UINT16_MAX) &&
+	     (CONFIG_BT_SCAN_UUID_CNT < UINT16_MAX),
+	     "Too many filters for the filter index");
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 /* Scan filter mutex. */
 K_MUTEX_DEFINE(scan_mutex);
 
@@ -47,6 +70,25 @@ struct bt_scan_control {
 	struct bt_scan_filter_match filter_status;
 };
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+/* Node of the name prefix tree. Node zero is the root, so zero is also
+ * used to mark a missing child or sibling.
+ */
+struct bt_scan_name_node {
+	/* Index of the first child node. */
+	uint16_t child;
+
+	/* Index of the next node with the same parent. */
+	uint16_t sibling;
+
+	/* Index of the first added name passing through this node. */
+	uint16_t target;
+
+	/* Name character of this node. */
+	uint8_t c;
+};
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 /* Name filter structure.
  */
 struct bt_scan_name_filter {
@@ -55,8 +97,16 @@ struct bt_scan_name_filter {
 	 */
 	char target_name[CONFIG_BT_SCAN_NAME_CNT][CONFIG_BT_SCAN_NAME_MAX_LEN];
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* Prefix tree of the target names. */
+	struct bt_scan_name_node tree[NAME_TREE_SIZE];
+
+	/* Number of prefix tree nodes in use, not including the root. */
+	uint16_t tree_cnt;
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	/* Name filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter.
 	 */
@@ -77,7 +127,7 @@ struct bt_scan_short_name_filter {
 	} name[CONFIG_BT_SCAN_SHORT_NAME_CNT];
 
 	/* Short name filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -89,8 +139,15 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* Hash table of the target address indexes plus one.
+	 * Zero marks an empty slot.
+	 */
+	uint16_t index[ADDR_INDEX_SIZE];
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	/* Address filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -120,8 +177,15 @@ struct bt_scan_uuid_filter {
 	 */
 	struct bt_scan_uuid uuid[CONFIG_BT_SCAN_UUID_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* Hash table of the indexes plus one of the UUIDs that have a 16-bit
+	 * form, keyed by the 16-bit value. Zero marks an empty slot.
+	 */
+	uint16_t index_16[UUID_16_INDEX_SIZE];
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	/* UUID filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -134,7 +198,7 @@ struct bt_scan_appearance_filter {
 	uint16_t appearance[CONFIG_BT_SCAN_APPEARANCE_CNT];
 
 	/* Appearance filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -156,7 +220,7 @@ struct bt_scan_manufacturer_data_filter {
 	} manufacturer_data[CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT];
 
 	/* Name filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -506,12 +570,76 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 }
 #endif /* CONFIG_BT_CENTRAL */
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+static uint32_t fnv1a_hash(const uint8_t *data, size_t len)
+{
+	uint32_t hash = FNV1A_OFFSET_BASIS;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ data[i]) * FNV1A_PRIME;
+	}
+
+	return hash;
+}
+
+static uint32_t addr_hash(const bt_addr_le_t *addr)
+{
+	uint8_t key[sizeof(addr->type) + sizeof(addr->a.val)];
+
+	key[0] = addr->type;
+	memcpy(&key[1], addr->a.val, sizeof(addr->a.val));
+
+	return fnv1a_hash(key, sizeof(key));
+}
+
+static int addr_index_find(const bt_addr_le_t *target_addr)
+{
+	const struct bt_scan_addr_filter *addr_filter =
+			&bt_scan.scan_filters.addr;
+	size_t slot = addr_hash(target_addr) % ADDR_INDEX_SIZE;
+
+	while (addr_filter->index[slot]) {
+		uint16_t i = addr_filter->index[slot] - 1;
+
+		if (bt_addr_le_cmp(target_addr, &addr_filter->target_addr[i]) == 0) {
+			return i;
+		}
+
+		slot = (slot + 1) % ADDR_INDEX_SIZE;
+	}
+
+	return -ENOENT;
+}
+
+static void addr_index_add(uint16_t i)
+{
+	struct bt_scan_addr_filter *addr_filter = &bt_scan.scan_filters.addr;
+	size_t slot = addr_hash(&addr_filter->target_addr[i]) % ADDR_INDEX_SIZE;
+
+	while (addr_filter->index[slot]) {
+		slot = (slot + 1) % ADDR_INDEX_SIZE;
+	}
+
+	addr_filter->index[slot] = i + 1;
+}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			     struct bt_scan_control *control)
 {
 	const bt_addr_le_t *addr =
 			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	int i = addr_index_find(target_addr);
+
+	if (i >= 0) {
+		control->filter_status.addr.addr = &addr[i];
+
+		return true;
+	}
+#else
+	uint16_t counter = bt_scan.scan_filters.addr.cnt;
 
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
@@ -520,6 +648,7 @@ static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			return true;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	return false;
 }
@@ -548,7 +677,7 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	char addr[BT_ADDR_LE_STR_LEN];
 	bt_addr_le_t *addr_filter =
 			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+	uint16_t counter = bt_scan.scan_filters.addr.cnt;
 
 	/* If no memory for filter. */
 	if (counter >= CONFIG_BT_SCAN_ADDRESS_CNT) {
@@ -556,15 +685,25 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	}
 
 	/* Check for duplicated filter. */
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	if (addr_index_find(target_addr) >= 0) {
+		return 0;
+	}
+#else
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_addr_le_cmp(target_addr, &addr_filter[i]) == 0) {
 			return 0;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	addr_index_add(counter);
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
 
@@ -585,14 +724,94 @@ static bool adv_name_cmp(const uint8_t *data,
 	return strncmp(target_name, data, data_len) == 0;
 }
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+/* Find the first added name that the advertised name is a prefix of,
+ * matching the strncmp() comparison of the linear search.
+ */
+static int name_tree_find(const uint8_t *data, uint8_t data_len)
+{
+	const struct bt_scan_name_filter *name_filter =
+			&bt_scan.scan_filters.name;
+	const struct bt_scan_name_node *node = &name_filter->tree[0];
+
+	if (name_filter->cnt == 0) {
+		return -ENOENT;
+	}
+
+	for (size_t i = 0; i < data_len; i++) {
+		uint16_t next = node->child;
+
+		while (next && (name_filter->tree[next].c != data[i])) {
+			next = name_filter->tree[next].sibling;
+		}
+
+		if (!next) {
+			return -ENOENT;
+		}
+
+		node = &name_filter->tree[next];
+
+		/* The comparison stops at the end of the target name. */
+		if (data[i] == '\0') {
+			break;
+		}
+	}
+
+	return node->target;
+}
+
+static void name_tree_add(const char *name, size_t name_len, uint16_t target)
+{
+	struct bt_scan_name_filter *name_filter = &bt_scan.scan_filters.name;
+	struct bt_scan_name_node *node = &name_filter->tree[0];
+
+	/* Add the terminating NUL character as well, so a name is told apart
+	 * from the longer names it is a prefix of.
+	 */
+	for (size_t i = 0; i <= name_len; i++) {
+		uint8_t c = (i < name_len) ? name[i] : '\0';
+		uint16_t next = node->child;
+
+		while (next && (name_filter->tree[next].c != c)) {
+			next = name_filter->tree[next].sibling;
+		}
+
+		if (!next) {
+			next = ++name_filter->tree_cnt;
+
+			__ASSERT_NO_MSG(next < ARRAY_SIZE(name_filter->tree));
+
+			name_filter->tree[next].child = 0;
+			name_filter->tree[next].sibling = node->child;
+			name_filter->tree[next].target = target;
+			name_filter->tree[next].c = c;
+			node->child = next;
+		}
+
+		node = &name_filter->tree[next];
+	}
+}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 static bool adv_name_compare(const struct bt_data *data,
 			     struct bt_scan_control *control)
 {
 	struct bt_scan_name_filter const *name_filter =
 			&bt_scan.scan_filters.name;
-	uint8_t counter = bt_scan.scan_filters.name.cnt;
 	uint8_t data_len = data->data_len;
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	int i = name_tree_find(data->data, data_len);
+
+	if (i >= 0) {
+		control->filter_status.name.name = name_filter->target_name[i];
+		control->filter_status.name.len = data_len;
+
+		return true;
+	}
+#else
+	uint16_t counter = bt_scan.scan_filters.name.cnt;
+
 	/* Compare the name found with the name filter. */
 	for (size_t i = 0; i < counter; i++) {
 		if (adv_name_cmp(data->data,
@@ -606,6 +825,7 @@ static bool adv_name_compare(const struct bt_data *data,
 			return true;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	return false;
 }
@@ -631,7 +851,7 @@ static void name_check(struct bt_scan_control *control,
 
 static int scan_name_filter_add(const char *name)
 {
-	uint8_t counter = bt_scan.scan_filters.name.cnt;
+	uint16_t counter = bt_scan.scan_filters.name.cnt;
 	size_t name_len;
 
 	/* If no memory for filter. */
@@ -657,6 +877,10 @@ static int scan_name_filter_add(const char *name)
 	memcpy(bt_scan.scan_filters.name.target_name[counter],
 	       name, name_len);
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	name_tree_add(name, name_len, counter);
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	bt_scan.scan_filters.name.cnt++;
 
 	LOG_DBG("Adding filter on %s name", name);
@@ -682,7 +906,7 @@ static bool adv_short_name_compare(const struct bt_data *data,
 {
 	const struct bt_scan_short_name_filter *name_filter =
 			&bt_scan.scan_filters.short_name;
-	uint8_t counter = bt_scan.scan_filters.short_name.cnt;
+	uint16_t counter = bt_scan.scan_filters.short_name.cnt;
 	uint8_t data_len = data->data_len;
 
 	/* Compare the name found with the name filters. */
@@ -724,7 +948,7 @@ static void short_name_check(struct bt_scan_control *control,
 
 static int scan_short_name_filter_add(const struct bt_scan_short_name *short_name)
 {
-	uint8_t counter =
+	uint16_t counter =
 		bt_scan.scan_filters.short_name.cnt;
 	struct bt_scan_short_name_filter *short_name_filter =
 		    &bt_scan.scan_filters.short_name;
@@ -803,15 +1027,131 @@ static bool find_uuid(const uint8_t *data,
 	return false;
 }
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+/* Get the 16-bit form of a UUID based on the Bluetooth Base UUID. */
+static bool uuid_16_value_get(const struct bt_uuid *uuid, uint16_t *value)
+{
+	struct bt_uuid_16 uuid_16 = BT_UUID_INIT_16(0);
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		uuid_16.val = BT_UUID_16(uuid)->val;
+		break;
+
+	case BT_UUID_TYPE_32:
+		uuid_16.val = (uint16_t)BT_UUID_32(uuid)->val;
+		break;
+
+	case BT_UUID_TYPE_128:
+		uuid_16.val = sys_get_le16(&BT_UUID_128(uuid)->val[12]);
+		break;
+
+	default:
+		return false;
+	}
+
+	*value = uuid_16.val;
+
+	return bt_uuid_cmp(&uuid_16.uuid, uuid) == 0;
+}
+
+static uint32_t uuid_16_hash(uint16_t value)
+{
+	uint8_t key[sizeof(value)];
+
+	sys_put_le16(value, key);
+
+	return fnv1a_hash(key, sizeof(key));
+}
+
+static int uuid_16_index_find(uint16_t value)
+{
+	const struct bt_scan_uuid_filter *uuid_filter =
+			&bt_scan.scan_filters.uuid;
+	size_t slot = uuid_16_hash(value) % UUID_16_INDEX_SIZE;
+
+	while (uuid_filter->index_16[slot]) {
+		uint16_t i = uuid_filter->index_16[slot] - 1;
+		uint16_t target;
+
+		if (uuid_16_value_get(uuid_filter->uuid[i].uuid, &target) &&
+		    (target == value)) {
+			return i;
+		}
+
+		slot = (slot + 1) % UUID_16_INDEX_SIZE;
+	}
+
+	return -ENOENT;
+}
+
+static void uuid_16_index_add(uint16_t i)
+{
+	struct bt_scan_uuid_filter *uuid_filter = &bt_scan.scan_filters.uuid;
+	uint16_t value;
+	size_t slot;
+
+	if (!uuid_16_value_get(uuid_filter->uuid[i].uuid, &value)) {
+		return;
+	}
+
+	slot = uuid_16_hash(value) % UUID_16_INDEX_SIZE;
+
+	while (uuid_filter->index_16[slot]) {
+		slot = (slot + 1) % UUID_16_INDEX_SIZE;
+	}
+
+	uuid_filter->index_16[slot] = i + 1;
+}
+
+/* Find the first added UUID present in a list of 16-bit UUIDs. */
+static bool adv_uuid_16_index_compare(const struct bt_data *data,
+				      struct bt_scan_control *control)
+{
+	const struct bt_scan_uuid_filter *uuid_filter =
+			&bt_scan.scan_filters.uuid;
+	int match = -ENOENT;
+
+	for (size_t i = 0; (i + sizeof(uint16_t)) <= data->data_len;
+	     i += sizeof(uint16_t)) {
+		int idx = uuid_16_index_find(sys_get_le16(&data->data[i]));
+
+		if ((idx >= 0) && ((match < 0) || (idx < match))) {
+			match = idx;
+		}
+	}
+
+	if (match < 0) {
+		control->filter_status.uuid.count = 0;
+
+		return false;
+	}
+
+	control->filter_status.uuid.uuid[0] = uuid_filter->uuid[match].uuid;
+	control->filter_status.uuid.count = 1;
+
+	return true;
+}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 			     struct bt_scan_control *control)
 {
 	const struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
 	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
-	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
+	const uint16_t counter = bt_scan.scan_filters.uuid.cnt;
 	uint8_t data_len = data->data_len;
-	uint8_t uuid_match_cnt = 0;
+	uint16_t uuid_match_cnt = 0;
+
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* In the multifilter mode, all UUIDs must be found, so the linear
+	 * search is used.
+	 */
+	if ((uuid_type == BT_UUID_TYPE_16) && !all_filters_mode) {
+		return adv_uuid_16_index_compare(data, control);
+	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	for (size_t i = 0; i < counter; i++) {
 
@@ -870,7 +1210,7 @@ static void uuid_check(struct bt_scan_control *control,
 static int scan_uuid_filter_add(struct bt_uuid *uuid)
 {
 	struct bt_scan_uuid *uuid_filter = bt_scan.scan_filters.uuid.uuid;
-	uint8_t counter = bt_scan.scan_filters.uuid.cnt;
+	uint16_t counter = bt_scan.scan_filters.uuid.cnt;
 	struct bt_uuid_16 *uuid_16;
 	struct bt_uuid_32 *uuid_32;
 	struct bt_uuid_128 *uuid_128;
@@ -917,6 +1257,10 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -EINVAL;
 	}
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	uuid_16_index_add(counter);
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
@@ -946,7 +1290,7 @@ static bool adv_appearance_compare(const struct bt_data *data,
 {
 	const struct bt_scan_appearance_filter *appearance_filter =
 			&bt_scan.scan_filters.appearance;
-	const uint8_t counter =
+	const uint16_t counter =
 			bt_scan.scan_filters.appearance.cnt;
 	uint8_t data_len = data->data_len;
 
@@ -990,7 +1334,7 @@ static void appearance_check(struct bt_scan_control *control,
 static int scan_appearance_filter_add(uint16_t appearance)
 {
 	uint16_t *appearance_filter = bt_scan.scan_filters.appearance.appearance;
-	uint8_t counter = bt_scan.scan_filters.appearance.cnt;
+	uint16_t counter = bt_scan.scan_filters.appearance.cnt;
 
 	/* If no memory. */
 	if (counter >= CONFIG_BT_SCAN_APPEARANCE_CNT) {
@@ -1034,7 +1378,7 @@ static bool adv_manufacturer_data_compare(const struct bt_data *data,
 {
 	const struct bt_scan_manufacturer_data_filter *md_filter =
 		&bt_scan.scan_filters.manufacturer_data;
-	uint8_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
+	uint16_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
 
 	/* Compare the name found with the name filter. */
 	for (size_t i = 0; i < counter; i++) {
@@ -1078,7 +1422,7 @@ static int scan_manufacturer_data_filter_add(const struct bt_scan_manufacturer_d
 {
 	struct bt_scan_manufacturer_data_filter *md_filter =
 		&bt_scan.scan_filters.manufacturer_data;
-	uint8_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
+	uint16_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
 
 	/* If no memory for filter. */
 	if (counter >= CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT) {
@@ -1221,6 +1565,10 @@ void bt_scan_filter_remove_all(void)
 	struct bt_scan_name_filter *name_filter =
 			&bt_scan.scan_filters.name;
 	name_filter->cnt = 0;
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	name_filter->tree[0].child = 0;
+	name_filter->tree_cnt = 0;
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	struct bt_scan_short_name_filter *short_name_filter =
 			&bt_scan.scan_filters.short_name;
@@ -1229,10 +1577,16 @@ void bt_scan_filter_remove_all(void)
 	struct bt_scan_addr_filter *addr_filter =
 			&bt_scan.scan_filters.addr;
 	addr_filter->cnt = 0;
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	memset(addr_filter->index, 0, sizeof(addr_filter->index));
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
 	uuid_filter->cnt = 0;
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	memset(uuid_filter->index_16, 0, sizeof(uuid_filter->index_16));
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	struct bt_scan_appearance_filter *appearance_filter =
 			&bt_scan.scan_filters.appearance;
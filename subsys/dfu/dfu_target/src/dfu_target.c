@@ -38,6 +38,9 @@ DEF_DFU_TARGET(smp);
 #include "dfu/dfu_target_custom.h"
 DEF_DFU_TARGET(custom);
 #endif
+#ifdef CONFIG_DFU_TARGET_STREAM
+#include "dfu/dfu_target_stream.h"
+#endif
 
 #define MIN_SIZE_IDENTIFY_BUF 32
 
@@ -160,6 +163,26 @@ int dfu_target_write(const void *const buf, size_t len)
 	return current_target->write(buf, len);
 }
 
+int dfu_target_buf_get(void **buf, size_t *len)
+{
+	if (current_target == NULL) {
+		return -EACCES;
+	}
+
+#ifdef CONFIG_DFU_TARGET_MCUBOOT
+	if (current_target == &dfu_target_mcuboot) {
+		return dfu_target_stream_buf_get(buf, len);
+	}
+#endif
+#ifdef CONFIG_DFU_TARGET_FULL_MODEM
+	if (current_target == &dfu_target_full_modem) {
+		return dfu_target_stream_buf_get(buf, len);
+	}
+#endif
+
+	return -ENOTSUP;
+}
+
 int dfu_target_done(bool successful)
 {
 	int err;
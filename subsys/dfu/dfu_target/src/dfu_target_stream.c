@@ -172,24 +172,66 @@ int dfu_target_stream_bytes_buffered_get(size_t *out)
 	return 0;
 }
 
+int dfu_target_stream_buf_get(void **buf, size_t *len)
+{
+	if (!buf || !len) {
+		return -EINVAL;
+	}
+
+	if (current_id == NULL) {
+		return -EACCES;
+	}
+
+	*buf = stream.buf + stream.buf_bytes;
+	*len = MIN(stream.buf_len - stream.buf_bytes,
+		   stream.available - stream.bytes_written - stream.buf_bytes);
+
+	return 0;
+}
+
+/* Take data that was received into the buffer given by dfu_target_stream_buf_get() */
+static int in_place_commit(size_t len, bool flush)
+{
+	if (len > stream.buf_len - stream.buf_bytes ||
+	    stream.bytes_written + stream.buf_bytes + len > stream.available) {
+		return -ENOMEM;
+	}
+
+	stream.buf_bytes += len;
+
+	if (!flush && stream.buf_bytes < stream.buf_len) {
+		return 0;
+	}
+
+	/* A full buffer is written as stream_flash_buffered_write() would */
+	return stream_flash_buffered_write(&stream, NULL, 0, true);
+}
+
 int dfu_target_stream_write(const uint8_t *buf, size_t len)
 {
+	int err;
+
+	if (current_id != NULL && buf == stream.buf + stream.buf_bytes) {
+		/* Received in place, see dfu_target_stream_buf_get() */
+		err = in_place_commit(len, IS_ENABLED(CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS));
+	} else {
 #ifdef CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS
-	/**
-	 * Flush immediately.
-	 * This may be necessary in scenarios where the server
-	 * cannot retransmit data that has already been ack-ed.
-	 * by the device. Without flushing, if an unaligned write
-	 * occurred prior to a reboot, some bytes that were already
-	 * sent to the device would need to be retransmitted.
-	 * This will lead to issues on the server side in the
-	 * described case, as the server would need to retransmit
-	 * already ack-ed data.
-	 */
-	int err = stream_flash_buffered_write(&stream, buf, len, true);
+		/**
+		 * Flush immediately.
+		 * This may be necessary in scenarios where the server
+		 * cannot retransmit data that has already been ack-ed.
+		 * by the device. Without flushing, if an unaligned write
+		 * occurred prior to a reboot, some bytes that were already
+		 * sent to the device would need to be retransmitted.
+		 * This will lead to issues on the server side in the
+		 * described case, as the server would need to retransmit
+		 * already ack-ed data.
+		 */
+		err = stream_flash_buffered_write(&stream, buf, len, true);
 #else
-	int err = stream_flash_buffered_write(&stream, buf, len, false);
+		err = stream_flash_buffered_write(&stream, buf, len, false);
 #endif
+	}
 
 	if (err != 0) {
 		LOG_ERR("stream_flash_buffered_write error %d", err);
@@ -243,6 +243,14 @@ int emds_store_time_get(uint32_t *store_time)
 	words += DIV_ROUND_UP(sizeof(struct emds_snapshot_metadata), 4);
 	chunk_handling = DIV_ROUND_UP(store_size, CHUNK_SIZE);
 
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		/* The incomplete chunk left by the staging is written first, and every chunk is
+		 * also compared to its staged copy.
+		 */
+		words += DIV_ROUND_UP(CHUNK_SIZE - 1, 4);
+		chunk_handling = chunk_handling * 2 + 1;
+	}
+
 	*store_time = words * CONFIG_EMDS_FLASH_TIME_WRITE_ONE_WORD_US;
 	*store_time += chunk_handling * CONFIG_EMDS_CHUNK_PREPARATION_TIME_US;
 
@@ -342,6 +350,26 @@ int emds_load(void)
 			      &freshest_snapshot.metadata);
 }
 
+static int snapshot_ready(int idx);
+
+static int snapshot_allocate(int idx, const struct emds_snapshot_candidate *freshest,
+			     size_t data_size)
+{
+	int rc;
+
+	rc = emds_flash_allocate_snapshot(&partition[idx], freshest, &allocated_snapshot,
+					  data_size);
+	if (rc || !IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		return rc;
+	}
+
+	/* The entries are written to the allocated area already by emds_prepare(). Mark the
+	 * area as staged, so that it is skipped by the next allocation if the snapshot is never
+	 * stored, instead of requiring the partition to be erased.
+	 */
+	return emds_flash_stage_snapshot(&partition[idx], &allocated_snapshot);
+}
+
 int emds_prepare(void)
 {
 	size_t data_size;
@@ -357,18 +385,19 @@ int emds_prepare(void)
 	/* Returned status is not checked since initialization state is checked above */
 	(void)emds_store_size_get(&data_size);
 
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		/* Room for the staged entries and for a copy of every entry that changes. */
+		data_size *= 2;
+	}
+
 	allocated_snapshot.metadata.fresh_cnt = freshest_snapshot.metadata.fresh_cnt + 1;
 
 	/* First try to allocate snapshot in the same partition where freshest snapshot exists */
 	if (freshest_snapshot.metadata.fresh_cnt > 0) {
 		freshest_partition_idx = freshest_snapshot.partition_index;
-		rc = emds_flash_allocate_snapshot(&partition[freshest_partition_idx],
-						  &freshest_snapshot, &allocated_snapshot,
-						  data_size);
+		rc = snapshot_allocate(freshest_partition_idx, &freshest_snapshot, data_size);
 		if (rc == 0) {
-			allocated_snapshot.partition_index = freshest_partition_idx;
-			emds_state = EMDS_STATE_READY;
-			return 0;
+			return snapshot_ready(freshest_partition_idx);
 		}
 		rc = 0;
 	}
@@ -384,12 +413,9 @@ int emds_prepare(void)
 				}
 			}
 
-			rc = emds_flash_allocate_snapshot(&partition[idx], NULL,
-							  &allocated_snapshot, data_size);
+			rc = snapshot_allocate(idx, NULL, data_size);
 			if (rc == 0) {
-				allocated_snapshot.partition_index = idx;
-				emds_state = EMDS_STATE_READY;
-				return 0;
+				return snapshot_ready(idx);
 			}
 		}
 
@@ -413,54 +439,218 @@ static void data_stream_pack(uint8_t *in, uint8_t *out, size_t *wp, size_t *rp,
 	*wp += size;
 }
 
-static void data_to_stream(const struct emds_partition *partition, off_t *data_off, uint8_t *in,
-			   uint8_t *out, size_t *wp, size_t len)
+static int stream_write(const struct emds_partition *partition, off_t data_off, uint8_t *data,
+			size_t len)
+{
+	allocated_snapshot.metadata.snapshot_crc =
+		crc32_k_4_2_update(allocated_snapshot.metadata.snapshot_crc, data, len);
+
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL) && emds_state != EMDS_STATE_READY) {
+		/* Entries are staged by emds_prepare() during normal operation, where the flash
+		 * driver must be used to not disturb the other flash users.
+		 */
+		return flash_area_write(partition->fa, data_off, data, len);
+	}
+
+	emds_flash_write_data(partition, data_off, data, len);
+
+	return 0;
+}
+
+static int data_to_stream(const struct emds_partition *partition, off_t *data_off, uint8_t *in,
+			  uint8_t *out, size_t *wp, size_t len)
 {
 	size_t rp = 0;
+	size_t size;
+	int rc;
 
 	while (rp != len) {
+		/* Write whole chunks directly from the entry when the stream is chunk aligned */
+		size = ROUND_DOWN(len - rp, CHUNK_SIZE);
+		if (*wp == 0 && size > 0) {
+			rc = stream_write(partition, *data_off, in + rp, size);
+			if (rc) {
+				return rc;
+			}
+
+			*data_off += size;
+			rp += size;
+			continue;
+		}
+
 		data_stream_pack(in, out, wp, &rp, len);
 		if (*wp == CHUNK_SIZE) {
-			allocated_snapshot.metadata.snapshot_crc = crc32_k_4_2_update(
-				allocated_snapshot.metadata.snapshot_crc, out, *wp);
-			emds_flash_write_data(partition, *data_off, out, *wp);
+			rc = stream_write(partition, *data_off, out, *wp);
+			if (rc) {
+				return rc;
+			}
+
 			*data_off += *wp;
 			*wp = 0;
 		}
 	}
+
+	return 0;
 }
 
-static void entry_to_stream(const struct emds_partition *partition, off_t *data_off, uint8_t *out,
-			    size_t *wp, struct emds_entry *entry)
+static int entry_to_stream(const struct emds_partition *partition, off_t *data_off, uint8_t *out,
+			   size_t *wp, struct emds_entry *entry)
 {
 	struct emds_data_entry data_entry = {
 		.id = entry->id,
 		.length = entry->len,
 	};
+	int rc;
 
 	LOG_DBG("Storing entry ID %u, length %u", entry->id, entry->len);
-	data_to_stream(partition, data_off, (uint8_t *)&data_entry, out, wp, sizeof(data_entry));
-	data_to_stream(partition, data_off, entry->data, out, wp, entry->len);
+	rc = data_to_stream(partition, data_off, (uint8_t *)&data_entry, out, wp,
+			    sizeof(data_entry));
+	if (rc) {
+		return rc;
+	}
+
+	return data_to_stream(partition, data_off, entry->data, out, wp, entry->len);
 }
 
 static void stream_fflush(const struct emds_partition *partition, off_t *data_off, uint8_t *out,
 			  size_t *wp)
 {
 	if (*wp > 0) {
-		allocated_snapshot.metadata.snapshot_crc =
-			crc32_k_4_2_update(allocated_snapshot.metadata.snapshot_crc, out, *wp);
-		emds_flash_write_data(partition, *data_off, out, *wp);
+		(void)stream_write(partition, *data_off, out, *wp);
 		*data_off += *wp;
 		*wp = 0;
 	}
 }
 
+/* Data stream position after the entries have been staged by emds_prepare(). The last,
+ * incomplete chunk is kept in RAM and written together with the changed entries by
+ * emds_store().
+ */
+static struct {
+	off_t data_off;
+	size_t wp;
+	uint8_t chunk[CHUNK_SIZE];
+	size_t len;
+} staged;
+
+static int entries_stage(void)
+{
+	const struct emds_partition *part = &partition[allocated_snapshot.partition_index];
+	int rc;
+
+	staged.data_off = allocated_snapshot.metadata.data_instance_off;
+	staged.wp = 0;
+	(void)emds_entries_size(&staged.len);
+
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		rc = entry_to_stream(part, &staged.data_off, staged.chunk, &staged.wp, ch);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		rc = entry_to_stream(part, &staged.data_off, staged.chunk, &staged.wp, &ch->entry);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+static bool staged_data_equal(off_t off, const uint8_t *data, size_t len)
+{
+	const struct emds_partition *part = &partition[allocated_snapshot.partition_index];
+	uint8_t buf[CHUNK_SIZE];
+	size_t size;
+
+	while (len > 0) {
+		if (off >= staged.data_off) {
+			return !memcmp(&staged.chunk[off - staged.data_off], data, len);
+		}
+
+		size = MIN(len, MIN(sizeof(buf), (size_t)(staged.data_off - off)));
+		if (flash_area_read(part->fa, off, buf, size) || memcmp(buf, data, size)) {
+			return false;
+		}
+
+		off += size;
+		data += size;
+		len -= size;
+	}
+
+	return true;
+}
+
+/* Checks whether the entry data differs from its staged copy at the given offset, and moves the
+ * offset to the next staged entry.
+ */
+static bool entry_changed(off_t *off, const struct emds_entry *entry)
+{
+	bool changed;
+
+	if (!IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		return true;
+	}
+
+	changed = !staged_data_equal(*off + sizeof(struct emds_data_entry), entry->data,
+				     entry->len);
+	*off += sizeof(struct emds_data_entry) + entry->len;
+
+	return changed;
+}
+
+static size_t changed_entries_size(void)
+{
+	off_t off = allocated_snapshot.metadata.data_instance_off;
+	size_t size = 0;
+
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		if (entry_changed(&off, ch)) {
+			size += ch->len + sizeof(struct emds_data_entry);
+		}
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		if (entry_changed(&off, &ch->entry)) {
+			size += ch->entry.len + sizeof(struct emds_data_entry);
+		}
+	}
+
+	return size;
+}
+
+static int snapshot_ready(int idx)
+{
+	int rc;
+
+	allocated_snapshot.partition_index = idx;
+
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		rc = entries_stage();
+		if (rc) {
+			LOG_ERR("Failed to stage entries: %d", rc);
+			return rc;
+		}
+	}
+
+	emds_state = EMDS_STATE_READY;
+
+	return 0;
+}
+
 int emds_store(void)
 {
 	uint32_t store_key;
 	uint8_t data_chunk[CHUNK_SIZE];
 	size_t wp = 0;
 	off_t data_off = allocated_snapshot.metadata.data_instance_off;
+	off_t staged_off = allocated_snapshot.metadata.data_instance_off;
 	int idx = allocated_snapshot.partition_index;
 	int rc = 0;
 
@@ -476,6 +666,20 @@ int emds_store(void)
 		goto unlock_and_exit;
 	}
 
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		/* Continue after the staged entries, and only append the entries that have
+		 * changed since. The latest copy of an entry is the one that is loaded.
+		 */
+		data_off = staged.data_off;
+		wp = staged.wp;
+		memcpy(data_chunk, staged.chunk, wp);
+
+		allocated_snapshot.metadata.data_instance_len = staged.len + changed_entries_size();
+		allocated_snapshot.metadata.metadata_crc = crc32_k_4_2_update(
+			0, (const unsigned char *)&allocated_snapshot.metadata,
+			offsetof(struct emds_snapshot_metadata, metadata_crc));
+	}
+
 	if (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
 		LOG_DBG("Writing metadata on offset: 0x%4lx, address : 0x%4lx",
 			 allocated_snapshot.metadata_off,
@@ -486,13 +690,18 @@ int emds_store(void)
 	}
 
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
+		if (entry_changed(&staged_off, ch)) {
+			(void)entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
+		}
 	}
 
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &ch->entry);
+		if (entry_changed(&staged_off, &ch->entry)) {
+			(void)entry_to_stream(&partition[idx], &data_off, data_chunk, &wp,
+					      &ch->entry);
+		}
 	}
 
 	stream_fflush(&partition[idx], &data_off, data_chunk, &wp);
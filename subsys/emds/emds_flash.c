@@ -22,6 +22,8 @@ LOG_MODULE_REGISTER(emds_flash, CONFIG_EMDS_LOG_LEVEL);
 #define SOC_NV_FLASH_NODE             DT_INST(0, soc_nv_flash)
 /* "EMDS" in ASCII */
 #define EMDS_SNAPSHOT_METADATA_MARKER 0x4D444553
+/* "STGD" in ASCII */
+#define EMDS_SNAPSHOT_STAGED_MARKER   0x53544744
 
 static void cand_list_init(sys_slist_t *cand_list, struct emds_snapshot_candidate *cand_buf)
 {
@@ -95,6 +97,41 @@ static bool cand_snapshot_crc_check(const struct emds_partition *partition,
 	return crc == metadata->snapshot_crc;
 }
 
+static bool metadata_crc_check(const struct emds_snapshot_metadata *metadata)
+{
+	return metadata->metadata_crc ==
+	       crc32_k_4_2_update(0, (const unsigned char *)metadata,
+				  offsetof(struct emds_snapshot_metadata, metadata_crc));
+}
+
+static bool metadata_is_staged(const struct emds_snapshot_metadata *metadata)
+{
+	return metadata->marker == EMDS_SNAPSHOT_STAGED_MARKER && metadata_crc_check(metadata);
+}
+
+static int area_empty_check(const struct emds_partition *partition, off_t off, size_t len)
+{
+	uint8_t cmp[sizeof(struct emds_snapshot_metadata)];
+	uint8_t cache[sizeof(struct emds_snapshot_metadata)];
+	int rc;
+
+	memset(cmp, partition->fp->erase_value, len);
+
+	rc = flash_area_read(partition->fa, off, cache, len);
+	if (rc) {
+		LOG_ERR("Failed to read memory at address 0x%04lx: %d",
+			partition->fa->fa_off + off, rc);
+		return rc;
+	}
+
+	if (memcmp(cmp, cache, len)) {
+		LOG_WRN("Area at address: 0x%04lx is not empty", partition->fa->fa_off + off);
+		return -EADDRINUSE;
+	}
+
+	return 0;
+}
+
 static bool metadata_iterator(off_t *read_off, int cur_failures)
 {
 	*read_off -= sizeof(struct emds_snapshot_metadata);
@@ -155,7 +192,8 @@ int emds_flash_scan_partition(const struct emds_partition *partition,
 	const struct flash_area *fa = partition->fa;
 	off_t read_off = fa->fa_size - sizeof(cache);
 	int failures = 0;
-	uint32_t crc;
+	bool staged = false;
+	bool reserved;
 	int rc;
 
 	cand_list_init(&cand_list, cand_buf);
@@ -167,17 +205,26 @@ int emds_flash_scan_partition(const struct emds_partition *partition,
 			return rc;
 		}
 
+		/* The slot below staged metadata is reserved for the metadata of the stored
+		 * snapshot, and stays empty if the snapshot was never stored.
+		 */
+		reserved = staged;
+		staged = metadata_is_staged(&cache);
+		if (staged) {
+			LOG_DBG("Staged snapshot metadata at address 0x%04lx",
+				fa->fa_off + read_off);
+			continue;
+		}
+
 		if (cache.marker != EMDS_SNAPSHOT_METADATA_MARKER) {
-			failures++;
+			failures += reserved ? 0 : 1;
 			LOG_DBG("Snapshot metadata marker mismatch at address 0x%04lx",
 				fa->fa_off + read_off);
 			continue;
 		}
 
-		crc = crc32_k_4_2_update(0, (const unsigned char *)&cache,
-					 offsetof(struct emds_snapshot_metadata, metadata_crc));
-		if (crc != cache.metadata_crc) {
-			failures++;
+		if (!metadata_crc_check(&cache)) {
+			failures += reserved ? 0 : 1;
 			LOG_DBG("Snapshot metadata CRC mismatch at address 0x%04lx",
 				fa->fa_off + read_off);
 			continue;
@@ -227,10 +274,30 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 					    fp->write_block_size)
 				 : 0;
 	size_t aligned_data_size = ROUND_UP(data_size, fp->write_block_size);
+	struct emds_snapshot_metadata staged;
 	int rc;
 
 	metadata_off -= sizeof(struct emds_snapshot_metadata);
 
+	/* Skip the data areas of the snapshots that were prepared but never stored, together with
+	 * the metadata slots reserved for them.
+	 */
+	while (metadata_off > data_off) {
+		rc = flash_area_read(fa, metadata_off, &staged, sizeof(staged));
+		if (rc) {
+			LOG_ERR("Failed to read snapshot metadata: %d", rc);
+			return rc;
+		}
+
+		if (!metadata_is_staged(&staged)) {
+			break;
+		}
+
+		data_off = ROUND_UP(staged.data_instance_off + staged.data_instance_len,
+				    fp->write_block_size);
+		metadata_off -= 2 * sizeof(struct emds_snapshot_metadata);
+	}
+
 	if (aligned_data_size +
 		    ROUND_UP(sizeof(struct emds_snapshot_metadata), fp->write_block_size) >
 	    fa->fa_size) {
@@ -245,39 +312,20 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 	}
 
 	if (flash_params_get_erase_cap(partition->fp) & FLASH_ERASE_C_EXPLICIT) {
-		uint8_t cmp[sizeof(struct emds_snapshot_metadata)];
-		uint8_t cache[sizeof(struct emds_snapshot_metadata)];
-
-		memset(cmp, fp->erase_value, sizeof(cmp));
-
-		rc = flash_area_read(fa, metadata_off, cache,
-				     sizeof(struct emds_snapshot_metadata));
+		rc = area_empty_check(partition, metadata_off,
+				      sizeof(struct emds_snapshot_metadata));
 		if (rc) {
-			LOG_ERR("Failed to read snapshot metadata memory: %d", rc);
 			return rc;
 		}
 
-		if (memcmp(cmp, cache, sizeof(struct emds_snapshot_metadata))) {
-			LOG_WRN("Metadata area at address: 0x%04lx is not empty",
-				fa->fa_off + metadata_off);
-			return -EADDRINUSE;
-		}
-
 		/* Check area of the first entry only. If it is empty then everything behind this is
 		 * empty. If area is busy then emds does not know border where it is empty. Need to
 		 * erase partition.
 		 */
-		rc = flash_area_read(fa, data_off, cache, sizeof(struct emds_data_entry));
+		rc = area_empty_check(partition, data_off, sizeof(struct emds_data_entry));
 		if (rc) {
-			LOG_ERR("Failed to read the first entry memory: %d", rc);
 			return rc;
 		}
-
-		if (memcmp(cmp, cache, sizeof(struct emds_data_entry))) {
-			LOG_WRN("Data area at address: 0x%04lx is not empty",
-				fa->fa_off + data_off);
-			return -EADDRINUSE;
-		}
 	}
 
 	allocated_snapshot->metadata_off = metadata_off;
@@ -297,6 +345,51 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 	return 0;
 }
 
+int emds_flash_stage_snapshot(const struct emds_partition *partition,
+			      struct emds_snapshot_candidate *allocated_snapshot)
+{
+	const struct flash_area *fa = partition->fa;
+	const struct flash_parameters *fp = partition->fp;
+	struct emds_snapshot_metadata staged = allocated_snapshot->metadata;
+	off_t metadata_off =
+		allocated_snapshot->metadata_off - sizeof(struct emds_snapshot_metadata);
+	int rc;
+
+	if (REGIONS_OVERLAP(metadata_off, sizeof(struct emds_snapshot_metadata),
+			    staged.data_instance_off,
+			    ROUND_UP(staged.data_instance_len, fp->write_block_size)) ||
+	    metadata_off <= staged.data_instance_off) {
+		LOG_WRN("Metadata area overlaps with data area");
+		return -ENOMEM;
+	}
+
+	if (flash_params_get_erase_cap(fp) & FLASH_ERASE_C_EXPLICIT) {
+		rc = area_empty_check(partition, metadata_off,
+				      sizeof(struct emds_snapshot_metadata));
+		if (rc) {
+			return rc;
+		}
+	}
+
+	staged.marker = EMDS_SNAPSHOT_STAGED_MARKER;
+	staged.metadata_crc =
+		crc32_k_4_2_update(0, (const unsigned char *)&staged,
+				   offsetof(struct emds_snapshot_metadata, metadata_crc));
+
+	rc = flash_area_write(fa, allocated_snapshot->metadata_off, &staged, sizeof(staged));
+	if (rc) {
+		LOG_ERR("Failed to write staged snapshot metadata: %d", rc);
+		return rc;
+	}
+
+	LOG_DBG("Staged metadata address: 0x%04lx, metadata address: 0x%04lx",
+		fa->fa_off + allocated_snapshot->metadata_off, fa->fa_off + metadata_off);
+
+	allocated_snapshot->metadata_off = metadata_off;
+
+	return 0;
+}
+
 static void nvmc_wait_ready(void)
 {
 #if defined CONFIG_SOC_FLASH_NRF_RRAM
@@ -153,6 +153,26 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 				 struct emds_snapshot_candidate *allocated_snapshot,
 				 size_t data_size);
 
+/**
+ * @brief Mark the data area of an allocated snapshot as staged.
+ *
+ * This function writes staged metadata to the metadata slot of the allocated snapshot, and
+ * moves the snapshot metadata to the slot below it. The staged metadata is ignored by the
+ * partition scanning, and the allocation skips its data area. Data can then be written to the
+ * allocated area before the snapshot is stored, without having to erase the partition if the
+ * snapshot is never stored.
+ *
+ * @param partition Pointer to the emergency data storage partition structure.
+ * @param allocated_snapshot Pointer to the snapshot allocated by
+ * @ref emds_flash_allocate_snapshot.
+ *
+ * @retval 0 on success.
+ * @retval -EADDRINUSE if the metadata slot below the allocated one is not empty.
+ * @retval -ENOMEM if the metadata slot below the allocated one overlaps with the data area.
+ */
+int emds_flash_stage_snapshot(const struct emds_partition *partition,
+			      struct emds_snapshot_candidate *allocated_snapshot);
+
 /** * @brief Write data to the emergency data storage partition.
  *
  * @param partition Pointer to the emergency data storage partition structure.
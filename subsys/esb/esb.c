@@ -25,6 +25,7 @@
 
 #include <mpsl_fem_protocol_api.h>
 
+#include "esb_fifo.h"
 #include "esb_peripherals.h"
 #include "esb_ppi_api.h"
 #include "esb_workarounds.h"
@@ -155,14 +156,19 @@ struct payload_wrap {
 	struct payload_wrap *p_next;
 };
 
+/* The payload queues are single-producer, single-consumer ring buffers shared between the
+ * application and the radio interrupt. The back index is only written by the producer and the
+ * front index only by the consumer, so no locking is needed. The indices run over twice the
+ * queue size to tell a full queue from an empty one.
+ */
+
 /* First-in, first-out queue of payloads to be transmitted. */
 struct payload_tx_fifo {
 	 /* Payload queue */
 	struct esb_payload *payload[CONFIG_ESB_TX_FIFO_SIZE];
 
-	uint32_t back;	/* Back of the queue (last in). */
-	uint32_t front;	/* Front of queue (first out). */
-	atomic_t count;	/* Number of elements in the queue. */
+	atomic_t back;	/* Back of the queue (last in). */
+	atomic_t front;	/* Front of queue (first out). */
 };
 
 /* First-in, first-out queue of received payloads. */
@@ -170,9 +176,8 @@ struct payload_rx_fifo {
 	 /* Payload queue */
 	struct esb_payload *payload[CONFIG_ESB_RX_FIFO_SIZE];
 
-	uint32_t back;	/* Back of the queue (last in). */
-	uint32_t front;	/* Front of queue (first out). */
-	atomic_t count;	/* Number of elements in the queue. */
+	atomic_t back;	/* Back of the queue (last in). */
+	atomic_t front;	/* Front of queue (first out). */
 };
 
 /* Fixed radio PDU header definition. */
@@ -270,6 +275,8 @@ static struct esb_payload *current_payload;
 /* FIFOs and buffers */
 static struct payload_tx_fifo tx_fifo;
 static struct payload_rx_fifo rx_fifo;
+/* Number of queued ACK payloads in PRX mode. */
+static atomic_t ack_pl_count;
 
 static uint8_t tx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
 				 sizeof(struct esb_radio_pdu)];
@@ -1007,15 +1014,31 @@ static bool update_radio_parameters(void)
 	return params_valid;
 }
 
+/* Number of payloads queued for transmission, or for ACKs in PRX mode. */
+static uint32_t tx_fifo_count(void)
+{
+	if (esb_cfg.mode != ESB_MODE_PTX) {
+		return atomic_get(&ack_pl_count);
+	}
+
+	return esb_fifo_count(atomic_get(&tx_fifo.back), atomic_get(&tx_fifo.front),
+			  CONFIG_ESB_TX_FIFO_SIZE);
+}
+
+static uint32_t rx_fifo_count(void)
+{
+	return esb_fifo_count(atomic_get(&rx_fifo.back), atomic_get(&rx_fifo.front),
+			  CONFIG_ESB_RX_FIFO_SIZE);
+}
+
 static void reset_fifos(void)
 {
-	tx_fifo.back = 0;
-	tx_fifo.front = 0;
-	atomic_clear(&tx_fifo.count);
+	atomic_clear(&tx_fifo.back);
+	atomic_clear(&tx_fifo.front);
+	atomic_clear(&ack_pl_count);
 
-	rx_fifo.back = 0;
-	rx_fifo.front = 0;
-	atomic_clear(&rx_fifo.count);
+	atomic_clear(&rx_fifo.back);
+	atomic_clear(&rx_fifo.front);
 }
 
 static void initialize_fifos(void)
@@ -1046,15 +1069,13 @@ static void initialize_fifos(void)
 
 static void tx_fifo_remove_first(void)
 {
-	if (atomic_get(&tx_fifo.count) == 0) {
-		return;
-	}
+	uint32_t front = atomic_get(&tx_fifo.front);
 
-	if (++tx_fifo.front >= CONFIG_ESB_TX_FIFO_SIZE) {
-		tx_fifo.front = 0;
+	if (front == atomic_get(&tx_fifo.back)) {
+		return;
 	}
 
-	atomic_dec(&tx_fifo.count);
+	atomic_set(&tx_fifo.front, esb_fifo_index_next(front, CONFIG_ESB_TX_FIFO_SIZE));
 }
 
 /*  Function to push the content of the rx_buffer to the RX FIFO.
@@ -1072,36 +1093,41 @@ static void tx_fifo_remove_first(void)
 static bool rx_fifo_push_rfbuf(uint8_t pipe, uint8_t pid)
 {
 	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	uint32_t back = atomic_get(&rx_fifo.back);
+	struct esb_payload *payload;
 
-	if (atomic_get(&rx_fifo.count) >= CONFIG_ESB_RX_FIFO_SIZE) {
+	if (esb_fifo_count(back, atomic_get(&rx_fifo.front), CONFIG_ESB_RX_FIFO_SIZE) >=
+	    CONFIG_ESB_RX_FIFO_SIZE) {
 		return false;
 	}
 
+	payload = rx_fifo.payload[esb_fifo_slot(back, CONFIG_ESB_RX_FIFO_SIZE)];
+
 	if (esb_cfg.protocol == ESB_PROTOCOL_ESB_DPL) {
 		if (rx_pdu->type.dpl_pdu.length > CONFIG_ESB_MAX_PAYLOAD_LENGTH) {
 			return false;
 		}
 
-		rx_fifo.payload[rx_fifo.back]->length = rx_pdu->type.dpl_pdu.length;
+		payload->length = rx_pdu->type.dpl_pdu.length;
 	} else if (esb_cfg.mode == ESB_MODE_PTX) {
 		/* Received packet is an acknowledgment */
-		rx_fifo.payload[rx_fifo.back]->length = 0;
+		payload->length = 0;
 	} else {
-		rx_fifo.payload[rx_fifo.back]->length = esb_cfg.payload_length;
+		payload->length = esb_cfg.payload_length;
 	}
 
-	memcpy(rx_fifo.payload[rx_fifo.back]->data, rx_pdu->data,
-	       rx_fifo.payload[rx_fifo.back]->length);
+	memcpy(payload->data, rx_pdu->data, payload->length);
 
-	rx_fifo.payload[rx_fifo.back]->pipe = pipe;
-	rx_fifo.payload[rx_fifo.back]->rssi = nrf_radio_rssi_sample_get(NRF_RADIO);
-	rx_fifo.payload[rx_fifo.back]->pid = pid;
-	rx_fifo.payload[rx_fifo.back]->noack = !rx_pdu->type.dpl_pdu.ack;
+	payload->pipe = pipe;
+	payload->rssi = nrf_radio_rssi_sample_get(NRF_RADIO);
+	payload->pid = pid;
+	payload->noack = !rx_pdu->type.dpl_pdu.ack;
+#if defined(CONFIG_ESB_RX_TIMESTAMP)
+	payload->timestamp = k_cycle_get_32();
+#endif
 
-	if (++rx_fifo.back >= CONFIG_ESB_RX_FIFO_SIZE) {
-		rx_fifo.back = 0;
-	}
-	atomic_inc(&rx_fifo.count);
+	/* Publish the payload to the reader. */
+	atomic_set(&rx_fifo.back, esb_fifo_index_next(back, CONFIG_ESB_RX_FIFO_SIZE));
 
 	return true;
 }
@@ -1168,7 +1194,8 @@ static void start_tx_transaction(void)
 	struct esb_radio_pdu *pdu = (struct esb_radio_pdu *)tx_payload_buffer;
 	last_tx_attempts = 1;
 	/* Prepare the payload */
-	current_payload = tx_fifo.payload[tx_fifo.front];
+	current_payload = tx_fifo.payload[esb_fifo_slot(atomic_get(&tx_fifo.front),
+							CONFIG_ESB_TX_FIFO_SIZE)];
 
 	switch (esb_cfg.protocol) {
 	case ESB_PROTOCOL_ESB:
@@ -1306,7 +1333,7 @@ static void on_timer_compare1_tx_noack(void)
 	atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
 	tx_fifo_remove_first();
 
-	if (atomic_get(&tx_fifo.count) == 0) {
+	if (tx_fifo_count() == 0) {
 		esb_state = ESB_STATE_PTX_TXIDLE;
 		set_evt_interrupt();
 	} else {
@@ -1323,7 +1350,7 @@ static void on_radio_disabled_tx_noack(void)
 	atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
 	tx_fifo_remove_first();
 
-	if (atomic_get(&tx_fifo.count) == 0) {
+	if (tx_fifo_count() == 0) {
 		esb_state = ESB_STATE_IDLE;
 		errata_216_off();
 		set_evt_interrupt();
@@ -1420,7 +1447,7 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 			}
 		}
 
-		if ((atomic_get(&tx_fifo.count) == 0) || (esb_cfg.tx_mode == ESB_TXMODE_MANUAL)) {
+		if ((tx_fifo_count() == 0) || (esb_cfg.tx_mode == ESB_TXMODE_MANUAL)) {
 			esb_state = ESB_STATE_IDLE;
 			errata_216_off();
 			set_evt_interrupt();
@@ -1599,7 +1626,7 @@ static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_
 
 	uint32_t pipe = nrf_radio_rxmatch_get(NRF_RADIO);
 
-	if (atomic_get(&tx_fifo.count) > 0 && ack_pl_wrap_pipe[pipe] != NULL) {
+	if (atomic_get(&ack_pl_count) > 0 && ack_pl_wrap_pipe[pipe] != NULL) {
 		current_payload = ack_pl_wrap_pipe[pipe]->p_payload;
 
 		/* Pipe stays in ACK with payload until TX FIFO is empty */
@@ -1607,8 +1634,8 @@ static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_
 		if (pipe_info->ack_payload == true && !retransmit_payload) {
 			ack_pl_wrap_pipe[pipe]->in_use = false;
 			ack_pl_wrap_pipe[pipe] = ack_pl_wrap_pipe[pipe]->p_next;
-			atomic_dec(&tx_fifo.count);
-			if (atomic_get(&tx_fifo.count) > 0 && ack_pl_wrap_pipe[pipe] != NULL) {
+			atomic_dec(&ack_pl_count);
+			if (atomic_get(&ack_pl_count) > 0 && ack_pl_wrap_pipe[pipe] != NULL) {
 				current_payload = ack_pl_wrap_pipe[pipe]->p_payload;
 			} else {
 				current_payload = 0;
@@ -1650,7 +1677,7 @@ static void on_radio_disabled_rx(void)
 		return;
 	}
 
-	if (atomic_get(&rx_fifo.count) >= CONFIG_ESB_RX_FIFO_SIZE) {
+	if (rx_fifo_count() >= CONFIG_ESB_RX_FIFO_SIZE) {
 		clear_events_restart_rx();
 		return;
 	}
@@ -2079,27 +2106,15 @@ static struct payload_wrap *find_free_payload_cont(void)
 	return 0;
 }
 
-int esb_write_payload(const struct esb_payload *payload)
+static int tx_fifo_push(const struct esb_payload *payload)
 {
-	if (esb_state == ESB_STATE_UNINITIALIZED) {
-		return -EACCES;
-	}
-
-	if (esb_cfg.mode == ESB_MODE_MONITOR) {
-		return -EPERM;
-	}
-
-	if (payload == NULL) {
-		return -EINVAL;
-	}
-
 	if ((payload->length == 0) || (payload->length > CONFIG_ESB_MAX_PAYLOAD_LENGTH) ||
 	    ((esb_cfg.protocol == ESB_PROTOCOL_ESB) &&
 	     (payload->length > esb_cfg.payload_length))) {
 		return -EMSGSIZE;
 	}
 
-	if (atomic_get(&tx_fifo.count) >= CONFIG_ESB_TX_FIFO_SIZE) {
+	if (tx_fifo_count() >= CONFIG_ESB_TX_FIFO_SIZE) {
 		return -ENOMEM;
 	}
 
@@ -2108,17 +2123,17 @@ int esb_write_payload(const struct esb_payload *payload)
 	}
 
 	if (esb_cfg.mode == ESB_MODE_PTX) {
-		memcpy(tx_fifo.payload[tx_fifo.back], payload, sizeof(struct esb_payload));
+		uint32_t back = atomic_get(&tx_fifo.back);
+		struct esb_payload *tx_payload =
+			tx_fifo.payload[esb_fifo_slot(back, CONFIG_ESB_TX_FIFO_SIZE)];
 
-		pids[payload->pipe] = (pids[payload->pipe] + 1) % (PID_MAX + 1);
-		tx_fifo.payload[tx_fifo.back]->pid = pids[payload->pipe];
-
-		if (++tx_fifo.back >= CONFIG_ESB_TX_FIFO_SIZE) {
-			tx_fifo.back = 0;
-		}
+		memcpy(tx_payload, payload, sizeof(struct esb_payload));
 
+		pids[payload->pipe] = (pids[payload->pipe] + 1) % (PID_MAX + 1);
+		tx_payload->pid = pids[payload->pipe];
 
-		atomic_inc(&tx_fifo.count);
+		/* Publish the payload to the radio interrupt. */
+		atomic_set(&tx_fifo.back, esb_fifo_index_next(back, CONFIG_ESB_TX_FIFO_SIZE));
 	} else {
 		struct payload_wrap *new_ack_payload = find_free_payload_cont();
 
@@ -2146,48 +2161,109 @@ int esb_write_payload(const struct esb_payload *payload)
 				pl->p_next = (struct payload_wrap *)new_ack_payload;
 			}
 
-			atomic_inc(&tx_fifo.count);
+			atomic_inc(&ack_pl_count);
 
 			irq_enable(ESB_RADIO_IRQ_NUMBER);
 		}
 	}
 
+	return 0;
+}
+
+int esb_write_payloads(const struct esb_payload *payloads, size_t count)
+{
+	size_t written;
+	int err = 0;
+
+	if (esb_state == ESB_STATE_UNINITIALIZED) {
+		return -EACCES;
+	}
+
+	if (esb_cfg.mode == ESB_MODE_MONITOR) {
+		return -EPERM;
+	}
+
+	if (payloads == NULL) {
+		return -EINVAL;
+	}
+
+	for (written = 0; written < count; written++) {
+		err = tx_fifo_push(&payloads[written]);
+		if (err) {
+			break;
+		}
+	}
+
+	if (written == 0) {
+		return err;
+	}
+
 	if (esb_cfg.mode == ESB_MODE_PTX && esb_cfg.tx_mode == ESB_TXMODE_AUTO &&
 	    (esb_state == ESB_STATE_IDLE ||
 	     (IS_ENABLED(CONFIG_ESB_NEVER_DISABLE_TX) && esb_state == ESB_STATE_PTX_TXIDLE))) {
 		start_tx_transaction();
 	}
 
-	return 0;
+	return written;
 }
 
-int esb_read_rx_payload(struct esb_payload *payload)
+int esb_write_payload(const struct esb_payload *payload)
+{
+	int err = esb_write_payloads(payload, 1);
+
+	return (err < 0) ? err : 0;
+}
+
+int esb_read_rx_payloads(struct esb_payload *payloads, size_t count)
 {
+	uint32_t front;
+	size_t available;
+	size_t read;
+
 	if (esb_state == ESB_STATE_UNINITIALIZED) {
 		return -EACCES;
 	}
-	if (payload == NULL) {
+	if (payloads == NULL) {
 		return -EINVAL;
 	}
-	if (atomic_get(&rx_fifo.count) == 0) {
+
+	front = atomic_get(&rx_fifo.front);
+	available = esb_fifo_count(atomic_get(&rx_fifo.back), front, CONFIG_ESB_RX_FIFO_SIZE);
+	if (available == 0) {
 		return -ENODATA;
 	}
 
-	payload->length = rx_fifo.payload[rx_fifo.front]->length;
-	payload->pipe = rx_fifo.payload[rx_fifo.front]->pipe;
-	payload->rssi = rx_fifo.payload[rx_fifo.front]->rssi;
-	payload->pid = rx_fifo.payload[rx_fifo.front]->pid;
-	payload->noack = rx_fifo.payload[rx_fifo.front]->noack;
-	memcpy(payload->data, rx_fifo.payload[rx_fifo.front]->data,
-	       payload->length);
+	count = MIN(count, available);
+
+	for (read = 0; read < count; read++) {
+		const struct esb_payload *rx_payload =
+			rx_fifo.payload[esb_fifo_slot(front, CONFIG_ESB_RX_FIFO_SIZE)];
+		struct esb_payload *payload = &payloads[read];
+
+		payload->length = rx_payload->length;
+		payload->pipe = rx_payload->pipe;
+		payload->rssi = rx_payload->rssi;
+		payload->pid = rx_payload->pid;
+		payload->noack = rx_payload->noack;
+#if defined(CONFIG_ESB_RX_TIMESTAMP)
+		payload->timestamp = rx_payload->timestamp;
+#endif
+		memcpy(payload->data, rx_payload->data, payload->length);
 
-	if (++rx_fifo.front >= CONFIG_ESB_RX_FIFO_SIZE) {
-		rx_fifo.front = 0;
+		front = esb_fifo_index_next(front, CONFIG_ESB_RX_FIFO_SIZE);
 	}
 
-	atomic_dec(&rx_fifo.count);
+	/* Release all read payloads to the radio interrupt at once. */
+	atomic_set(&rx_fifo.front, front);
 
-	return 0;
+	return read;
+}
+
+int esb_read_rx_payload(struct esb_payload *payload)
+{
+	int err = esb_read_rx_payloads(payload, 1);
+
+	return (err < 0) ? err : 0;
 }
 
 int esb_start_tx(void)
@@ -2198,7 +2274,7 @@ int esb_start_tx(void)
 	if (esb_cfg.mode != ESB_MODE_PTX) {
 		return -EPERM;
 	}
-	if (atomic_get(&tx_fifo.count) == 0) {
+	if (tx_fifo_count() == 0) {
 		return -ENODATA;
 	}
 
@@ -2238,13 +2314,13 @@ int esb_flush_tx(void)
 	if (esb_state != ESB_STATE_IDLE) {
 		return -EBUSY;
 	}
-	if (atomic_get(&tx_fifo.count) == 0) {
+	if (tx_fifo_count() == 0) {
 		return 0;
 	}
 
-	atomic_clear(&tx_fifo.count);
-	tx_fifo.back = 0;
-	tx_fifo.front = 0;
+	atomic_clear(&tx_fifo.back);
+	atomic_clear(&tx_fifo.front);
+	atomic_clear(&ack_pl_count);
 
 	for (size_t i = 0; i < CONFIG_ESB_TX_FIFO_SIZE; i++) {
 		ack_pl_wrap[i].in_use = false;
@@ -2263,10 +2339,13 @@ int esb_pop_tx(void)
 	if (esb_state == ESB_STATE_UNINITIALIZED) {
 		return -EACCES;
 	}
+	if (esb_cfg.mode != ESB_MODE_PTX) {
+		return -EPERM;
+	}
 	if (esb_state != ESB_STATE_IDLE) {
 		return -EBUSY;
 	}
-	if (atomic_get(&tx_fifo.count) == 0) {
+	if (tx_fifo_count() == 0) {
 		return -ENODATA;
 	}
 
@@ -2277,7 +2356,7 @@ int esb_pop_tx(void)
 
 bool esb_tx_full(void)
 {
-	return atomic_get(&tx_fifo.count) >= CONFIG_ESB_TX_FIFO_SIZE;
+	return tx_fifo_count() >= CONFIG_ESB_TX_FIFO_SIZE;
 }
 
 int esb_flush_rx(void)
@@ -2289,9 +2368,8 @@ int esb_flush_rx(void)
 	/* see note about irq_disable in @ref esb_write_payload */
 	irq_disable(ESB_RADIO_IRQ_NUMBER);
 
-	atomic_clear(&rx_fifo.count);
-	rx_fifo.back = 0;
-	rx_fifo.front = 0;
+	atomic_clear(&rx_fifo.back);
+	atomic_clear(&rx_fifo.front);
 
 	memset(rx_pipe_info, 0, sizeof(rx_pipe_info));
 
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef ESB_FIFO_H__
+#define ESB_FIFO_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Index arithmetic of the single-producer, single-consumer payload queues.
+ *
+ * The back and front indices run from 0 to 2 * size - 1, so that a full
+ * queue (back - front == size) can be told from an empty one
+ * (back == front) without a shared element counter.
+ */
+
+/** @brief Get the number of elements in a queue.
+ *
+ * @param back  Back index of the queue.
+ * @param front Front index of the queue.
+ * @param size  Number of slots in the queue.
+ *
+ * @return Number of elements in the queue.
+ */
+static inline uint32_t esb_fifo_count(uint32_t back, uint32_t front, uint32_t size)
+{
+	return (back >= front) ? (back - front) : (back + 2 * size - front);
+}
+
+/** @brief Get the index following a back or front index.
+ *
+ * @param index Back or front index.
+ * @param size  Number of slots in the queue.
+ *
+ * @return Next index, wrapped around at 2 * size.
+ */
+static inline uint32_t esb_fifo_index_next(uint32_t index, uint32_t size)
+{
+	return (index + 1 < 2 * size) ? (index + 1) : 0;
+}
+
+/** @brief Get the slot a back or front index refers to.
+ *
+ * @param index Back or front index.
+ * @param size  Number of slots in the queue.
+ *
+ * @return Slot in the range 0 to size - 1.
+ */
+static inline uint32_t esb_fifo_slot(uint32_t index, uint32_t size)
+{
+	return (index < size) ? index : (index - size);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ESB_FIFO_H__ */
@@ -80,6 +80,12 @@ struct transport_params_http {
 	bool ranged;
 	/** Ranged progress */
 	size_t ranged_progress;
+	/** Offset of the first byte that is not yet requested, when ranged. */
+	size_t ranged_requested;
+	/** Number of range requests sent and not yet answered in full. */
+	uint8_t ranged_in_flight;
+	/** The buffer holds the start of the next response, received with the previous one. */
+	bool buffered;
 	/** HTTP header */
 	struct {
 		/** Header length */
@@ -144,17 +150,121 @@ extern char *strnstr(const char *haystack, const char *needle, size_t haystack_s
 
 static int parse_protocol(struct downloader *dl, const char *url);
 
-static int http_get_request_send(struct downloader *dl)
+static void http_response_next(struct transport_params_http *http)
+{
+	http->header.has_end = false;
+	http->header.status_code = 0;
+	http->ranged_progress = 0;
+}
+
+/* Length of the range that is being received, the last one is cut at the end of the file. */
+static size_t http_range_len(struct downloader *dl)
+{
+	struct transport_params_http *http;
+	size_t start;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+	start = dl->progress - http->ranged_progress;
+
+	return MIN(dl->host_cfg.range_override, dl->file_size - start);
+}
+
+static int http_request_send(struct downloader *dl, char *buf, size_t buf_size, int len)
+{
+	int err;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	if (len < 0 || len > buf_size) {
+		LOG_ERR("Cannot create GET request, buffer too small");
+		return -ENOMEM;
+	}
+
+	if (IS_ENABLED(CONFIG_DOWNLOADER_LOG_HEADERS)) {
+		LOG_HEXDUMP_DBG(buf, len, "HTTP request");
+	}
+
+	LOG_DBG("http request:\n%.*s", len, buf);
+
+	err = dl_socket_send(http->sock.fd, buf, len);
+	if (err) {
+		LOG_ERR("Failed to send HTTP request, errno %d", errno);
+		return err;
+	}
+
+	return 0;
+}
+
+/* Send range requests until CONFIG_DOWNLOADER_TRANSPORT_HTTP_PIPELINE_DEPTH of them are
+ * in flight. The size of the file is not known before the first response, so the first
+ * request is sent alone. Responses come in the order of the requests, so the data is
+ * given to the application in order, and the download resumes from dl->progress.
+ */
+static int http_range_requests_send(struct downloader *dl)
 {
 	int err;
 	int len;
-	size_t off = 0;
+	size_t off;
+	char *buf;
+	size_t buf_size;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	if (http->ranged_in_flight == 0) {
+		http->ranged_requested = dl->progress;
+	}
+
+	while (http->ranged_in_flight < CONFIG_DOWNLOADER_TRANSPORT_HTTP_PIPELINE_DEPTH) {
+		if (http->ranged_in_flight &&
+		    (!dl->file_size || http->ranged_requested >= dl->file_size)) {
+			break;
+		}
+
+		off = http->ranged_requested + dl->host_cfg.range_override - 1;
+
+		if (dl->file_size) {
+			/* Don't request bytes past the end of file */
+			off = MIN(off, dl->file_size - 1);
+		}
+
+		/* Keep the start of a response that is already in the buffer */
+		buf = dl->cfg.buf + dl->buf_offset;
+		buf_size = dl->cfg.buf_size - dl->buf_offset;
+
+		len = snprintf(buf, buf_size, HTTP_GET_RANGE, dl->file, dl->hostname,
+			       http->ranged_requested, off);
+		if ((len < 0 || len > buf_size) && http->ranged_in_flight) {
+			/* Sent when the buffer is free again */
+			break;
+		}
+
+		err = http_request_send(dl, buf, buf_size, len);
+		if (err) {
+			return err;
+		}
+
+		http->ranged_requested = off + 1;
+		http->ranged_in_flight++;
+	}
+
+	return 0;
+}
+
+static int http_get_request_send(struct downloader *dl)
+{
+	int len;
 	bool tls_force_range;
 	struct transport_params_http *http;
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
-	http->header.has_end = false;
+	if (http->ranged_in_flight == 0) {
+		dl->buf_offset = 0;
+		http->buffered = false;
+		http_response_next(http);
+	}
 
 	/* nRF91 series has a limitation of decoding ~2k of data at once when using TLS */
 	tls_force_range = (http->sock.proto == IPPROTO_TLS_1_2 && !dl->host_cfg.set_native_tls &&
@@ -169,19 +279,9 @@ static int http_get_request_send(struct downloader *dl)
 	}
 
 	if (dl->host_cfg.range_override) {
-		off = dl->progress + dl->host_cfg.range_override - 1;
-
-		if (dl->file_size) {
-			/* Don't request bytes past the end of file */
-			off = MIN(off, dl->file_size - 1);
-		}
-
-		len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET_RANGE, dl->file,
-			       dl->hostname, dl->progress, off);
 		http->ranged = true;
-		http->ranged_progress = 0;
 		LOG_DBG("Range request up to %d bytes", dl->host_cfg.range_override);
-		goto send;
+		return http_range_requests_send(dl);
 	} else if (dl->progress) {
 		len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET_OFFSET, dl->file,
 			       dl->hostname, dl->progress);
@@ -192,25 +292,7 @@ static int http_get_request_send(struct downloader *dl)
 		http->ranged = false;
 	}
 
-send:
-	if (len < 0 || len > dl->cfg.buf_size) {
-		LOG_ERR("Cannot create GET request, buffer too small");
-		return -ENOMEM;
-	}
-
-	if (IS_ENABLED(CONFIG_DOWNLOADER_LOG_HEADERS)) {
-		LOG_HEXDUMP_DBG(dl->cfg.buf, len, "HTTP request");
-	}
-
-	LOG_DBG("http request:\n%s", dl->cfg.buf);
-
-	err = dl_socket_send(http->sock.fd, dl->cfg.buf, len);
-	if (err) {
-		LOG_ERR("Failed to send HTTP request, errno %d", errno);
-		return err;
-	}
-
-	return 0;
+	return http_request_send(dl, dl->cfg.buf, dl->cfg.buf_size, len);
 }
 
 /* Returns:
@@ -392,13 +474,14 @@ static int http_header_parse(struct downloader *dl, size_t buf_len)
 	q = dl->cfg.buf + buf_len;
 	/* We are still missing part of the header.
 	 * Return the lines (in number of bytes) that we have parsed.
+	 * A line is only parsed once its line feed is received.
 	 */
-	while (q > dl->cfg.buf && (*q != '\r') && (*q != '\n')) {
+	while (q > dl->cfg.buf && *(q - 1) != '\n') {
 		q--;
 	}
 
 	/* Keep \r and \n in the buffer in case it is part of the header ending. */
-	while (*(q - 1) == '\r' || *(q - 1) == '\n') {
+	while (q > dl->cfg.buf && (*(q - 1) == '\r' || *(q - 1) == '\n')) {
 		q--;
 	}
 
@@ -439,8 +522,9 @@ static int http_parse(struct downloader *dl, size_t len)
 			/* Keep remaining payload */
 			len = len - parsed_len;
 			memmove(dl->cfg.buf, dl->cfg.buf + parsed_len, len);
-			dl->buf_offset = len;
 		}
+		/* Keep a partial line too, until the rest of it is received */
+		dl->buf_offset = len;
 
 		if (!http->header.has_end) {
 			if (dl->cfg.buf_size == dl->buf_offset) {
@@ -577,6 +661,8 @@ static int dl_http_connect(struct downloader *dl)
 
 	http->connection_close = false;
 	http->new_data_req = true;
+	/* Responses to requests on the old connection are lost */
+	http->ranged_in_flight = 0;
 
 	return err;
 }
@@ -598,16 +684,51 @@ static int dl_http_close(struct downloader *dl)
 	return -EBADF;
 }
 
+/* Get a buffer from the application to receive the payload into, without a copy.
+ * Only once the header is parsed and nothing is left in the downloader buffer,
+ * and at most up to the end of the current response.
+ */
+static bool http_buf_lend(struct downloader *dl, void **buf, size_t *len)
+{
+	struct transport_params_http *http;
+	size_t left;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	if (!dl->cfg.buf_get || !http->header.has_end || dl->buf_offset || !dl->file_size) {
+		return false;
+	}
+
+	if (http->ranged) {
+		left = http_range_len(dl) - http->ranged_progress;
+	} else {
+		left = dl->file_size - dl->progress;
+	}
+
+	if (!left || dl->cfg.buf_get(buf, len) || !*len) {
+		return false;
+	}
+
+	*len = MIN(*len, left);
+
+	return true;
+}
+
 static int dl_http_download(struct downloader *dl)
 {
 	int ret, recv_len, data_len, expected_len;
+	size_t range_left = 0;
+	size_t excess = 0;
+	size_t lent_len;
+	void *lent = NULL;
+	void *data = dl->cfg.buf;
+	bool buffered;
 	struct transport_params_http *http;
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
 	if (http->new_data_req) {
 		/* Request next fragment */
-		dl->buf_offset = 0;
 		ret = http_get_request_send(dl);
 		if (ret) {
 			LOG_DBG("data_req failed, err %d", ret);
@@ -620,11 +741,22 @@ static int dl_http_download(struct downloader *dl)
 
 	__ASSERT(dl->buf_offset < dl->cfg.buf_size, "Buffer overflow");
 
-	LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
-		(void *)(dl->cfg.buf + dl->buf_offset));
+	buffered = http->buffered;
+	if (buffered) {
+		/* Parse the next response from what was received with the previous one */
+		http->buffered = false;
+		recv_len = 0;
+	} else if (http_buf_lend(dl, &lent, &lent_len)) {
+		LOG_DBG("Receiving up to %d bytes at lent %p...", lent_len, lent);
+
+		recv_len = dl_socket_recv(http->sock.fd, lent, lent_len);
+	} else {
+		LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
+			(void *)(dl->cfg.buf + dl->buf_offset));
 
-	recv_len = dl_socket_recv(http->sock.fd, dl->cfg.buf + dl->buf_offset,
-			     dl->cfg.buf_size - dl->buf_offset);
+		recv_len = dl_socket_recv(http->sock.fd, dl->cfg.buf + dl->buf_offset,
+					  dl->cfg.buf_size - dl->buf_offset);
+	}
 
 	if (recv_len < 0) {
 		if (recv_len == -EMSGSIZE && dl->host_cfg.range_override) {
@@ -647,46 +779,81 @@ static int dl_http_download(struct downloader *dl)
 		return recv_len;
 	}
 
-	data_len = http_parse(dl, recv_len + dl->buf_offset);
-	if (data_len < 0) {
-		return data_len;
-	}
+	if (lent) {
+		/* Payload only, bounded by the end of the response */
+		if (recv_len == 0) {
+			return -ECONNRESET;
+		}
 
-	expected_len = MIN(MIN_SIZE_IDENTIFY_BUF, dl->file_size - dl->progress);
+		data = lent;
+		data_len = recv_len;
+		if (http->ranged) {
+			range_left = http_range_len(dl) - http->ranged_progress;
+		}
+	} else {
+		data_len = http_parse(dl, recv_len + dl->buf_offset);
+		if (data_len < 0) {
+			return data_len;
+		}
 
-	if (data_len < expected_len) {
-		/* Wait for more data after the HTTP headers,
-		 * so we don't end up forwarding too small chunks to FOTA library.
-		 */
-		return recv_len > 0 ? 0 : -ECONNRESET; /* Fail if closed while expecting more */
+		expected_len = MIN(MIN_SIZE_IDENTIFY_BUF, dl->file_size - dl->progress);
+
+		if (http->ranged && http->header.has_end) {
+			/* With pipelined requests, the data can run into the next response */
+			range_left = http_range_len(dl) - http->ranged_progress;
+			if (data_len > range_left) {
+				excess = data_len - range_left;
+				data_len = range_left;
+			}
+			expected_len = MIN(expected_len, range_left);
+		}
+
+		if (data_len < expected_len) {
+			/* Wait for more data after the HTTP headers,
+			 * so we don't end up forwarding too small chunks to FOTA library.
+			 */
+			/* Fail if closed while expecting more */
+			return (recv_len > 0 || buffered) ? 0 : -ECONNRESET;
+		}
 	}
 
 	/* Accumulate progress */
 	dl->progress += data_len;
 	if (data_len) {
-		dl_transport_evt_data(dl, dl->cfg.buf, data_len);
+		dl_transport_evt_data(dl, data, data_len);
 	}
+	dl->buf_offset = 0;
 	if (http->ranged) {
 		http->ranged_progress += data_len;
-		if (http->ranged_progress < dl->host_cfg.range_override) {
+		if (!http->header.has_end || data_len < range_left) {
 			/* Ranged query: read until a full fragment is received */
 		} else {
 			/* Ranged query: request next fragment */
+			http->ranged_in_flight--;
+			http_response_next(http);
 			http->new_data_req = true;
+
+			if (excess) {
+				memmove(dl->cfg.buf, dl->cfg.buf + data_len, excess);
+				dl->buf_offset = excess;
+				http->buffered = true;
+			}
 		}
 	}
 	if (dl->progress == dl->file_size) {
 		/* A full file has been received */
 		dl->complete = true;
 		http->new_data_req = true;
+		http->ranged_in_flight = 0;
+		http->buffered = false;
+		dl->buf_offset = 0;
 	}
-	dl->buf_offset = 0;
 
 	if (dl->complete) {
 		return 0;
 	}
 	/* Continue reading, unless connection is closed */
-	return recv_len > 0 ? 0 : -ECONNRESET;
+	return (recv_len > 0 || buffered) ? 0 : -ECONNRESET;
 }
 
 static const struct dl_transport dl_transport_http = {
@@ -34,11 +34,13 @@ static uint32_t dl_file_hash;
 
 static struct downloader dl;
 static int downloader_callback(const struct downloader_evt *event);
+static int downloader_buf_get(void **buf, size_t *len);
 static char dl_buf[CONFIG_FOTA_DOWNLOAD_BUF_SZ];
 static struct downloader_cfg dl_cfg = {
 	.callback = downloader_callback,
 	.buf = dl_buf,
 	.buf_size = sizeof(dl_buf),
+	IF_ENABLED(CONFIG_FOTA_DOWNLOAD_ZERO_COPY, (.buf_get = downloader_buf_get,))
 };
 static struct downloader_host_cfg dl_host_cfg;
 /** SMP MCUBoot image type */
@@ -143,6 +145,16 @@ static int dl_cancel(void)
 	return downloader_cancel(&dl);
 }
 
+/* Lend the flash write buffer of the DFU target, once it is initialized by the first fragment */
+static int __maybe_unused downloader_buf_get(void **buf, size_t *len)
+{
+	if (atomic_test_bit(&flags, FLAG_FIRST_FRAGMENT)) {
+		return -EAGAIN;
+	}
+
+	return dfu_target_buf_get(buf, len);
+}
+
 static int downloader_callback(const struct downloader_evt *event)
 {
 	static size_t file_size;
@@ -35,6 +35,7 @@ struct nrf_cloud_coap_client {
 };
 
 #define NRF_CLOUD_COAP_PROXY_RSC "proxy"
+#define NRF_CLOUD_COAP_D2C_BULK_RSC "msg/d2c/bulk"
 
 /**
  * @defgroup nrf_cloud_coap_transport nRF CoAP API
@@ -245,6 +246,49 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 			 enum coap_content_format fmt, bool reliable,
 			 coap_client_response_cb_t cb, void *user);
 
+/**@brief Callback to notify that an asynchronous CoAP request is complete.
+ *
+ * @param result 0 if the request succeeded, a positive value indicating a CoAP result code,
+ * or a negative error number.
+ * @param user Pointer to user-specific data passed to @ref nrf_cloud_coap_async_request.
+ */
+typedef void (*nrf_cloud_coap_async_cb_t)(int result, void *user);
+
+/**@brief Start an asynchronous confirmable CoAP request.
+ *
+ * The function returns as soon as the request is sent, so multiple requests can be in
+ * progress at the same time. Each request has its own token and message ID, and the
+ * responses are matched to the requests in any order. The number of requests in progress is
+ * limited by CONFIG_COAP_CLIENT_MAX_REQUESTS.
+ *
+ * The payload in @p buf must remain valid until @p done is called.
+ *
+ * @param method CoAP method of the request.
+ * @param resource String containing the specific CoAP endpoint to access.
+ * @param query Optional string containing REST-style query parameters.
+ * @param buf Optional pointer to buffer containing a payload to include with the request.
+ * @param len Length of payload or 0 if none.
+ * @param fmt_out CoAP content format for the Content-Format message option of the payload.
+ * @param fmt_in CoAP content format for the Accept message option of the returned payload.
+ *               Only used with the GET and FETCH methods.
+ * @param cb Optional pointer to a callback function to receive the results.
+ * @param done Pointer to a callback function called once when the request is complete.
+ * @param user Pointer to user-specific data to be passed back to @p cb and @p done.
+ * @retval -EINVAL Invalid parameters.
+ * @retval -EACCES Device is not connected to nRF Cloud.
+ * @retval -ENOBUFS Maximum number of CoAP transfers are already in progress.
+ * @retval -EAGAIN The CoAP client has no free request slot, try again after a request
+ *                 in progress is complete.
+ * @return 0 if the request was sent, otherwise a negative error number.
+ *         @p done is only called if the request was sent.
+ */
+int nrf_cloud_coap_async_request(enum coap_method method, const char *resource,
+				 const char *query, const uint8_t *buf, size_t len,
+				 enum coap_content_format fmt_out,
+				 enum coap_content_format fmt_in,
+				 coap_client_response_cb_t cb, nrf_cloud_coap_async_cb_t done,
+				 void *user);
+
 /**
  * @brief Send binary log data to nRF Cloud on the /msg/d2c/bin topic. The data sent should
  * come from the nrf_cloud_log_backend. It will be assembled in sequential order and made
@@ -37,7 +37,6 @@ LOG_MODULE_REGISTER(nrf_cloud_coap, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
 #define COAP_SHDW_REP_RSC "state/reported"
 #define COAP_SHDW_DES_RSC "state/desired"
 #define COAP_D2C_RSC "msg/d2c"
-#define COAP_D2C_BULK_RSC COAP_D2C_RSC "/bulk"
 #define COAP_D2C_RAW_RSC COAP_D2C_RSC "/raw"
 #define COAP_D2C_BIN_RSC COAP_D2C_RSC "/bin"
 
@@ -287,7 +286,7 @@ int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable)
 
 	int err = 0;
 	bool enc = false;
-	const char *resource = bulk ? COAP_D2C_BULK_RSC : COAP_D2C_RSC;
+	const char *resource = bulk ? NRF_CLOUD_COAP_D2C_BULK_RSC : COAP_D2C_RSC;
 
 	if (!resource) {
 		return -EINVAL;
@@ -387,7 +386,7 @@ int nrf_cloud_coap_json_message_send(const char *message, bool bulk, bool confir
 		return -EACCES;
 	}
 	size_t len = strlen(message);
-	const char *resource = bulk ? COAP_D2C_BULK_RSC : COAP_D2C_RSC;
+	const char *resource = bulk ? NRF_CLOUD_COAP_D2C_BULK_RSC : COAP_D2C_RSC;
 	int err;
 
 	if (!resource) {
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/coap.h>
+#include <date_time.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+#include "coap_codec.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(nrf_cloud_coap_batch, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
+
+/* The "bulk" Uri-Path option, which a request to the message resource does not have */
+#define BULK_OPTION_LEN 5
+
+/* CBOR array header, which holds the number of messages in the low bits of the first byte,
+ * or in the following byte when there are 24 or more.
+ */
+#define CBOR_ARRAY	       0x80
+#define CBOR_ARRAY_COUNT_UINT8 24
+#define ARRAY_HEADER_MAX       2
+
+BUILD_ASSERT(SENSOR_SEND_CBOR_MAX_SIZE <= UINT8_MAX);
+
+/* The messages are kept encoded, one after the other, with room for the array header in front
+ * of the first one, so that the batch is sent straight from the buffer.
+ */
+static struct {
+	uint8_t buf[ARRAY_HEADER_MAX + CONFIG_NRF_CLOUD_COAP_BATCH_BUFFER_SIZE];
+	uint8_t lens[CONFIG_NRF_CLOUD_COAP_BATCH_MAX_MESSAGES];
+	size_t used;
+	size_t count;
+	struct nrf_cloud_coap_batch_stats stats;
+} batch;
+
+static K_MUTEX_DEFINE(batch_mutex);
+
+#if CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE > 0
+/* The batch is sent on age from a dedicated workqueue, as the request blocks until it is
+ * acknowledged, or until all retransmissions have failed.
+ */
+static K_THREAD_STACK_DEFINE(batch_stack, CONFIG_NRF_CLOUD_COAP_BATCH_STACK_SIZE);
+static struct k_work_q batch_work_q;
+static bool batch_work_q_started;
+
+static void age_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(age_work, age_work_fn);
+#endif
+
+static uint8_t *messages_get(void)
+{
+	return &batch.buf[ARRAY_HEADER_MAX];
+}
+
+static uint8_t *array_header_put(void)
+{
+	uint8_t *start = messages_get();
+
+	if (batch.count < CBOR_ARRAY_COUNT_UINT8) {
+		*--start = CBOR_ARRAY | batch.count;
+	} else {
+		*--start = batch.count;
+		*--start = CBOR_ARRAY | CBOR_ARRAY_COUNT_UINT8;
+	}
+
+	return start;
+}
+
+static void batch_clear(void)
+{
+	batch.used = 0;
+	batch.count = 0;
+#if CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE > 0
+	(void)k_work_cancel_delayable(&age_work);
+#endif
+}
+
+static void oldest_drop(void)
+{
+	uint8_t len = batch.lens[0];
+
+	memmove(messages_get(), messages_get() + len, batch.used - len);
+	memmove(batch.lens, batch.lens + 1, batch.count - 1);
+	batch.used -= len;
+	batch.count--;
+	batch.stats.dropped++;
+}
+
+static int batch_send(void)
+{
+	const uint8_t *payload;
+	size_t len;
+	int err;
+
+	if (batch.count == 0) {
+		return 0;
+	}
+
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	payload = array_header_put();
+	len = messages_get() + batch.used - payload;
+
+	err = nrf_cloud_coap_post(NRF_CLOUD_COAP_D2C_BULK_RSC, NULL, payload, len,
+				  COAP_CONTENT_FORMAT_APP_CBOR, true, NULL, NULL);
+	if (err < 0) {
+		LOG_ERR("Failed to send POST request: %d", err);
+		return err;
+	} else if (err > 0) {
+		LOG_RESULT_CODE_ERR("Error from server:", err);
+		batch.stats.dropped += batch.count;
+	} else {
+		size_t saved = (batch.count - 1) * CONFIG_NRF_CLOUD_COAP_BATCH_REQUEST_OVERHEAD;
+		size_t cost = (messages_get() - payload) + BULK_OPTION_LEN;
+
+		LOG_DBG("Sent %zu messages in %zu bytes", batch.count, len);
+		batch.stats.messages += batch.count;
+		batch.stats.batches++;
+		batch.stats.bytes_sent += len;
+		batch.stats.bytes_saved += (saved > cost) ? (saved - cost) : 0;
+	}
+
+	batch_clear();
+
+	return err;
+}
+
+#if CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE > 0
+static void age_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	int err;
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+
+	err = batch_send();
+	if (err) {
+		LOG_WRN("Failed to send the batch when it expired: %d", err);
+	}
+
+	if (err < 0) {
+		/* The messages are kept, so do not let them wait for the next one to be added */
+		(void)k_work_schedule_for_queue(&batch_work_q, &age_work,
+						K_SECONDS(CONFIG_NRF_CLOUD_COAP_BATCH_RETRY_INTERVAL));
+	}
+
+	k_mutex_unlock(&batch_mutex);
+}
+
+static void age_work_schedule(void)
+{
+	static const struct k_work_queue_config cfg = {
+		.name = "nrf_cloud_coap_batch",
+	};
+
+	if (!batch_work_q_started) {
+		k_work_queue_start(&batch_work_q, batch_stack,
+				   K_THREAD_STACK_SIZEOF(batch_stack),
+				   K_LOWEST_APPLICATION_THREAD_PRIO, &cfg);
+		batch_work_q_started = true;
+	}
+
+	/* Does nothing when already scheduled by an older message */
+	(void)k_work_schedule_for_queue(&batch_work_q, &age_work,
+					K_SECONDS(CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE));
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE > 0 */
+
+int nrf_cloud_coap_batch_sensor_add(const char *app_id, double value, int64_t ts_ms)
+{
+	uint8_t msg[SENSOR_SEND_CBOR_MAX_SIZE];
+	size_t len = sizeof(msg);
+	int64_t ts = ts_ms;
+	int err;
+
+	if (!app_id) {
+		return -EINVAL;
+	}
+
+	/* The batch is sent later, so the time of the measurement is taken now */
+	if ((ts == NRF_CLOUD_NO_TIMESTAMP) && date_time_now(&ts)) {
+		LOG_ERR("Error getting time");
+		ts = 0;
+	}
+
+	err = coap_codec_sensor_encode(app_id, value, ts, msg, &len, COAP_CONTENT_FORMAT_APP_CBOR);
+	if (err) {
+		LOG_ERR("Unable to encode sensor data: %d", err);
+		return err;
+	}
+
+	if (len > CONFIG_NRF_CLOUD_COAP_BATCH_BUFFER_SIZE) {
+		return -E2BIG;
+	}
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+
+	if ((batch.used + len > CONFIG_NRF_CLOUD_COAP_BATCH_BUFFER_SIZE) &&
+	    (batch_send() < 0)) {
+		while (batch.used + len > CONFIG_NRF_CLOUD_COAP_BATCH_BUFFER_SIZE) {
+			oldest_drop();
+		}
+	}
+
+	if (batch.count == CONFIG_NRF_CLOUD_COAP_BATCH_MAX_MESSAGES) {
+		/* Full from an earlier failure to send, which is retried first */
+		if (batch_send() < 0) {
+			oldest_drop();
+		}
+	}
+
+	memcpy(messages_get() + batch.used, msg, len);
+	batch.lens[batch.count] = len;
+	batch.used += len;
+	batch.count++;
+
+	if (batch.count == CONFIG_NRF_CLOUD_COAP_BATCH_MAX_MESSAGES) {
+		(void)batch_send();
+	}
+
+#if CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE > 0
+	if (batch.count > 0) {
+		age_work_schedule();
+	}
+#endif
+
+	k_mutex_unlock(&batch_mutex);
+
+	return 0;
+}
+
+int nrf_cloud_coap_batch_flush(void)
+{
+	int err;
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+	err = batch_send();
+	k_mutex_unlock(&batch_mutex);
+
+	return err;
+}
+
+void nrf_cloud_coap_batch_stats_get(struct nrf_cloud_coap_batch_stats *stats)
+{
+	__ASSERT_NO_MSG(stats != NULL);
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+	*stats = batch.stats;
+	k_mutex_unlock(&batch_mutex);
+}
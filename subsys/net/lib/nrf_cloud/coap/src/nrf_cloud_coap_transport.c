@@ -62,6 +62,15 @@ struct cc_xfer_data {
 	int result_code;
 	struct k_sem *sem;
 	atomic_t used;
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	/* Completion callback of an asynchronous transfer */
+	nrf_cloud_coap_async_cb_t done;
+	/* The CoAP client refers to the path and options until an asynchronous
+	 * transfer is complete.
+	 */
+	char path[MAX_COAP_PATH + 1];
+	struct coap_client_option options[1];
+#endif
 };
 
 /* Semaphore to be used with internal coap_client requests */
@@ -158,6 +167,9 @@ static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 	xfer->user_data = user;
 	xfer->result_code = -ECANCELED;
 	xfer->sem = sem;
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	xfer->done = NULL;
+#endif
 	return xfer;
 }
 
@@ -401,6 +413,21 @@ static void client_callback(int16_t result_code, size_t offset, const uint8_t *p
 			xfer->cb(result_code, offset, payload, len, last_block, xfer->user_data);
 		}
 	}
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+	if (xfer->done && (last_block || (result_code < 0) ||
+			   (result_code >= COAP_RESPONSE_CODE_BAD_REQUEST))) {
+		nrf_cloud_coap_async_cb_t done = xfer->done;
+		void *user = xfer->user_data;
+
+		LOG_DBG("End of asynchronous transfer");
+		/* Release the context first so that the callback can start a new transfer. */
+		xfer->done = NULL;
+		xfer_ctx_release(xfer);
+		done(((result_code < 0) || (result_code >= COAP_RESPONSE_CODE_BAD_REQUEST)) ?
+		     result_code : 0, user);
+		return;
+	}
+#endif
 	if (last_block || (result_code >= COAP_RESPONSE_CODE_BAD_REQUEST)) {
 		LOG_DBG("End of client transfer");
 		if (xfer->sem) {
@@ -409,6 +436,24 @@ static void client_callback(int16_t result_code, size_t offset, const uint8_t *p
 	}
 }
 
+static int path_format(char *path, const char *resource, const char *query)
+{
+	int err;
+
+	if (!query) {
+		strncpy(path, resource, MAX_COAP_PATH);
+		path[MAX_COAP_PATH] = '\0';
+		return 0;
+	}
+
+	err = snprintk(path, MAX_COAP_PATH + 1, "%s?%s", resource, query);
+	if ((err <= 0) || (err > MAX_COAP_PATH)) {
+		LOG_ERR("Could not format string");
+		return -ETXTBSY;
+	}
+
+	return 0;
+}
 
 static int client_transfer(enum coap_method method,
 			   const char *resource, const char *query,
@@ -452,16 +497,9 @@ static int client_transfer(enum coap_method method,
 		request.num_options = 0;
 	}
 
-	if (!query) {
-		strncpy(path, resource, MAX_COAP_PATH);
-		path[MAX_COAP_PATH] = '\0';
-	} else {
-		err = snprintk(path, sizeof(path), "%s?%s", resource, query);
-		if ((err <= 0) || (err >= sizeof(path))) {
-			LOG_ERR("Could not format string");
-			err = -ETXTBSY;
-			goto transfer_end;
-		}
+	err = path_format(path, resource, query);
+	if (err) {
+		goto transfer_end;
 	}
 
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
@@ -636,6 +674,89 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+int nrf_cloud_coap_async_request(enum coap_method method, const char *resource,
+				 const char *query, const uint8_t *buf, size_t len,
+				 enum coap_content_format fmt_out,
+				 enum coap_content_format fmt_in,
+				 coap_client_response_cb_t cb, nrf_cloud_coap_async_cb_t done,
+				 void *user)
+{
+	int err;
+	struct cc_xfer_data *xfer;
+	struct coap_client_request request = {
+		.method = method,
+		.confirmable = true,
+		.fmt = fmt_out,
+		.payload = (uint8_t *)buf,
+		.len = len,
+		.cb = client_callback
+	};
+
+	if (!resource || !done) {
+		return -EINVAL;
+	}
+
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	xfer = xfer_data_init(&internal_cc, cb, user, NULL);
+	if (!xfer) {
+		return -ENOBUFS;
+	}
+
+	err = path_format(xfer->path, resource, query);
+	if (err) {
+		goto fail;
+	}
+
+	request.path = xfer->path;
+	request.user_data = xfer;
+
+	if ((method == COAP_METHOD_GET) || (method == COAP_METHOD_FETCH)) {
+		xfer->options[0] = (struct coap_client_option){
+			.code = COAP_OPTION_ACCEPT,
+			.len = 1,
+			.value[0] = fmt_in
+		};
+		request.options = xfer->options;
+		request.num_options = ARRAY_SIZE(xfer->options);
+	}
+
+#if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
+	LOG_DBG("CON %s %s Content-Format:%s, %zd bytes out, asynchronous", METHOD_NAME(method),
+		xfer->path, fmt_name(fmt_out), len);
+#endif /* CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG */
+
+	/* The response can arrive before coap_client_req() returns. */
+	xfer->done = done;
+
+	/* Unlike client_transfer(), do not hold internal_transfer_mut while waiting for the
+	 * response. The client mutex only protects the socket from being closed meanwhile.
+	 */
+	k_mutex_lock(&internal_cc.mutex, K_FOREVER);
+	if (internal_cc.sock < 0) {
+		err = -EACCES;
+	} else {
+		err = coap_client_req(&internal_cc.cc, internal_cc.sock, NULL, &request, NULL);
+	}
+	k_mutex_unlock(&internal_cc.mutex);
+
+	if (err < 0) {
+		LOG_DBG("Error sending asynchronous CoAP request: %d", err);
+		goto fail;
+	}
+
+	return 0;
+
+fail:
+	xfer->done = NULL;
+	xfer_ctx_release(xfer);
+	return err;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 static void auth_cb(int16_t result_code, size_t offset, const uint8_t *payload, size_t len,
 		    bool last_block, void *user_data)
 {
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_JSON_STREAM_H__
+#define NRF_CLOUD_JSON_STREAM_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <modem/lte_lc.h>
+#include <net/wifi_location_common.h>
+#include <net/nrf_cloud.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Writer that prints JSON straight into a buffer, without building a cJSON tree.
+ *
+ * The output is the same as cJSON_PrintUnformatted() gives for the same tree.
+ * When the buffer is NULL or too small, the writer keeps counting, so that the length needed
+ * is known after a first pass.
+ */
+struct nrf_cloud_json_stream {
+	/** Output buffer, or NULL to only count the length. */
+	char *buf;
+	/** Size of the output buffer. */
+	size_t size;
+	/** Length of the output, even when it does not fit in the buffer. */
+	size_t len;
+	/** Last character written, used to tell whether a value needs a separator. */
+	char last;
+};
+
+/** @brief Function that writes a message with the given context. */
+typedef void (*nrf_cloud_json_stream_fn)(struct nrf_cloud_json_stream *const s,
+					 const void *const ctx);
+
+void nrf_cloud_json_stream_init(struct nrf_cloud_json_stream *const s, char *const buf,
+				const size_t size);
+
+/** @brief Add a value to an object with the given key, or to an array or at the top level
+ *  when the key is NULL.
+ */
+void nrf_cloud_json_stream_obj_start(struct nrf_cloud_json_stream *const s,
+				     const char *const key);
+void nrf_cloud_json_stream_obj_end(struct nrf_cloud_json_stream *const s);
+void nrf_cloud_json_stream_arr_start(struct nrf_cloud_json_stream *const s,
+				     const char *const key);
+void nrf_cloud_json_stream_arr_end(struct nrf_cloud_json_stream *const s);
+void nrf_cloud_json_stream_str_add(struct nrf_cloud_json_stream *const s, const char *const key,
+				   const char *const val);
+void nrf_cloud_json_stream_num_add(struct nrf_cloud_json_stream *const s, const char *const key,
+				   const double val);
+void nrf_cloud_json_stream_bool_add(struct nrf_cloud_json_stream *const s, const char *const key,
+				    const bool val);
+void nrf_cloud_json_stream_null_add(struct nrf_cloud_json_stream *const s,
+				    const char *const key);
+
+/** @brief Write a message into a buffer allocated with cJSON_malloc(), sized in a first pass.
+ *
+ * The output is NUL-terminated and can be freed with cJSON_free(), like the output of
+ * cJSON_PrintUnformatted().
+ *
+ * @retval 0 Success.
+ * @retval -ENOMEM Out of memory.
+ */
+int nrf_cloud_json_stream_encode(nrf_cloud_json_stream_fn fn, const void *const ctx,
+				 struct nrf_cloud_data *const output);
+
+/** @brief Encode a device message, like @ref nrf_cloud_encode_message does with cJSON. */
+int nrf_cloud_json_stream_message_encode(const char *app_id, double value, const char *str_val,
+					 const char *topic, int64_t ts,
+					 struct nrf_cloud_data *output);
+
+/** @brief Encode sensor data, like @ref nrf_cloud_sensor_data_encode does with cJSON. */
+int nrf_cloud_json_stream_sensor_data_encode(const char *const app_id, const char *const data,
+					     const int64_t ts_ms,
+					     struct nrf_cloud_data *const output);
+
+/** @brief Encode the reply to a shadow delta with control settings, like
+ *  @ref nrf_cloud_shadow_control_response_encode does with cJSON.
+ */
+int nrf_cloud_json_stream_shadow_control_response_encode(
+	struct nrf_cloud_ctrl_data const *const data, const bool accept,
+	struct nrf_cloud_data *const output);
+
+/** @brief Encode the payload of a location request, like
+ *  @ref nrf_cloud_obj_location_request_payload_add does with cJSON.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL Invalid parameters.
+ * @retval -ENODATA Not enough cellular or Wi-Fi data for a request.
+ * @retval -ENOMEM Out of memory.
+ */
+int nrf_cloud_json_stream_location_req_encode(struct lte_lc_cells_info const *const cells_inf,
+					      struct wifi_scan_info const *const wifi_inf,
+					      struct nrf_cloud_data *const output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_JSON_STREAM_H__ */
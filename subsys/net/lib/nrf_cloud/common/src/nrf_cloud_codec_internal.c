@@ -8,6 +8,7 @@
 #include "nrf_cloud_mem.h"
 #include <net/nrf_cloud_codec.h>
 #include "nrf_cloud_log_internal.h"
+#include "nrf_cloud_json_stream.h"
 #include <net/nrf_cloud_location.h>
 #include <net/nrf_cloud_alert.h>
 #include <net/nrf_cloud_log.h>
@@ -436,6 +437,10 @@ int nrf_cloud_shadow_control_response_encode(struct nrf_cloud_ctrl_data const *c
 	__ASSERT_NO_MSG(data != NULL);
 	__ASSERT_NO_MSG(output != NULL);
 
+	if (IS_ENABLED(CONFIG_NRF_CLOUD_JSON_STREAM)) {
+		return nrf_cloud_json_stream_shadow_control_response_encode(data, accept, output);
+	}
+
 	char *buffer = NULL;
 	int err = 0;
 
@@ -534,6 +539,11 @@ int nrf_cloud_encode_message(const char *app_id, double value, const char *str_v
 	__ASSERT_NO_MSG(app_id != NULL);
 	__ASSERT_NO_MSG(output != NULL);
 
+	if (IS_ENABLED(CONFIG_NRF_CLOUD_JSON_STREAM)) {
+		return nrf_cloud_json_stream_message_encode(app_id, value, str_val, topic, ts,
+							    output);
+	}
+
 	NRF_CLOUD_OBJ_JSON_DEFINE(root_obj);
 	NRF_CLOUD_OBJ_JSON_DEFINE(msg_obj);
 
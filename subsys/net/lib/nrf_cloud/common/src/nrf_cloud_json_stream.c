@@ -0,0 +1,587 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <modem/modem_info.h>
+#include <net/nrf_cloud_defs.h>
+#include <net/nrf_cloud_location.h>
+#include "cJSON.h"
+#include "nrf_cloud_json_stream.h"
+
+/* Integers below this are printed the same by "%1.15g" as by an integer conversion */
+#define INT_EXACT_MAX 1e15
+#define NUM_BUF_SIZE  32
+
+struct location_req {
+	struct lte_lc_cells_info const *cells_inf;
+	struct wifi_scan_info const *wifi_inf;
+	bool cells;
+	bool wifi;
+};
+
+struct message {
+	const char *app_id;
+	double value;
+	const char *str_val;
+	const char *topic;
+	int64_t ts;
+};
+
+struct sensor_data {
+	const char *app_id;
+	const char *data;
+	int64_t ts_ms;
+};
+
+struct control_response {
+	struct nrf_cloud_ctrl_data const *data;
+	bool accept;
+};
+
+static void put(struct nrf_cloud_json_stream *const s, const char *const str, const size_t len)
+{
+	if (s->buf && (s->len + len < s->size)) {
+		memcpy(&s->buf[s->len], str, len);
+	}
+
+	s->len += len;
+	if (len) {
+		s->last = str[len - 1];
+	}
+}
+
+static void put_char(struct nrf_cloud_json_stream *const s, const char c)
+{
+	put(s, &c, 1);
+}
+
+static void put_str(struct nrf_cloud_json_stream *const s, const char *const str)
+{
+	static const char hex[] = "0123456789abcdef";
+	const char *run = str;
+	const char *p;
+
+	put_char(s, '"');
+
+	/* Copy runs of characters that need no escaping in one go */
+	for (p = str; *p; p++) {
+		unsigned char c = *p;
+		char esc[6] = {'\\', 0, '0', '0', 0, 0};
+		size_t esc_len = 2;
+
+		switch (c) {
+		case '"':
+		case '\\':
+			esc[1] = c;
+			break;
+		case '\b':
+			esc[1] = 'b';
+			break;
+		case '\f':
+			esc[1] = 'f';
+			break;
+		case '\n':
+			esc[1] = 'n';
+			break;
+		case '\r':
+			esc[1] = 'r';
+			break;
+		case '\t':
+			esc[1] = 't';
+			break;
+		default:
+			if (c >= ' ') {
+				continue;
+			}
+			esc[1] = 'u';
+			esc[4] = hex[c >> 4];
+			esc[5] = hex[c & 0xf];
+			esc_len = sizeof(esc);
+			break;
+		}
+
+		put(s, run, p - run);
+		put(s, esc, esc_len);
+		run = p + 1;
+	}
+
+	put(s, run, p - run);
+	put_char(s, '"');
+}
+
+static void put_key(struct nrf_cloud_json_stream *const s, const char *const key)
+{
+	if ((s->last != '{') && (s->last != '[') && (s->len > 0)) {
+		put_char(s, ',');
+	}
+
+	if (key) {
+		put_str(s, key);
+		put_char(s, ':');
+	}
+}
+
+static size_t int_format(char *const buf, const int64_t val)
+{
+	char digits[20];
+	uint64_t u = (val < 0) ? -(uint64_t)val : (uint64_t)val;
+	size_t n = 0;
+	size_t len = 0;
+
+	do {
+		digits[n++] = '0' + (u % 10);
+		u /= 10;
+	} while (u);
+
+	if (val < 0) {
+		buf[len++] = '-';
+	}
+
+	while (n) {
+		buf[len++] = digits[--n];
+	}
+
+	return len;
+}
+
+/* Same as print_number() in cJSON */
+static size_t num_format(char *const buf, const double val)
+{
+	double test;
+	int len;
+
+	if (isnan(val) || isinf(val)) {
+		memcpy(buf, "null", 4);
+		return 4;
+	}
+
+	if ((fabs(val) < INT_EXACT_MAX) && (val == (double)(int64_t)val)) {
+		return int_format(buf, (int64_t)val);
+	}
+
+	len = snprintf(buf, NUM_BUF_SIZE, "%1.15g", val);
+	test = strtod(buf, NULL);
+	if (fabs(test - val) > MAX(fabs(test), fabs(val)) * DBL_EPSILON) {
+		len = snprintf(buf, NUM_BUF_SIZE, "%1.17g", val);
+	}
+
+	return (len > 0) ? len : 0;
+}
+
+void nrf_cloud_json_stream_init(struct nrf_cloud_json_stream *const s, char *const buf,
+				const size_t size)
+{
+	s->buf = buf;
+	s->size = size;
+	s->len = 0;
+	s->last = '\0';
+}
+
+void nrf_cloud_json_stream_obj_start(struct nrf_cloud_json_stream *const s,
+				     const char *const key)
+{
+	put_key(s, key);
+	put_char(s, '{');
+}
+
+void nrf_cloud_json_stream_obj_end(struct nrf_cloud_json_stream *const s)
+{
+	put_char(s, '}');
+}
+
+void nrf_cloud_json_stream_arr_start(struct nrf_cloud_json_stream *const s,
+				     const char *const key)
+{
+	put_key(s, key);
+	put_char(s, '[');
+}
+
+void nrf_cloud_json_stream_arr_end(struct nrf_cloud_json_stream *const s)
+{
+	put_char(s, ']');
+}
+
+void nrf_cloud_json_stream_str_add(struct nrf_cloud_json_stream *const s, const char *const key,
+				   const char *const val)
+{
+	put_key(s, key);
+	put_str(s, val);
+}
+
+void nrf_cloud_json_stream_num_add(struct nrf_cloud_json_stream *const s, const char *const key,
+				   const double val)
+{
+	char buf[NUM_BUF_SIZE];
+
+	put_key(s, key);
+	put(s, buf, num_format(buf, val));
+}
+
+void nrf_cloud_json_stream_bool_add(struct nrf_cloud_json_stream *const s, const char *const key,
+				    const bool val)
+{
+	put_key(s, key);
+	if (val) {
+		put(s, "true", 4);
+	} else {
+		put(s, "false", 5);
+	}
+}
+
+void nrf_cloud_json_stream_null_add(struct nrf_cloud_json_stream *const s,
+				    const char *const key)
+{
+	put_key(s, key);
+	put(s, "null", 4);
+}
+
+int nrf_cloud_json_stream_encode(nrf_cloud_json_stream_fn fn, const void *const ctx,
+				 struct nrf_cloud_data *const output)
+{
+	struct nrf_cloud_json_stream s;
+	char *buf;
+
+	/* Size the output, then write it */
+	nrf_cloud_json_stream_init(&s, NULL, 0);
+	fn(&s, ctx);
+
+	buf = cJSON_malloc(s.len + 1);
+	if (!buf) {
+		return -ENOMEM;
+	}
+
+	nrf_cloud_json_stream_init(&s, buf, s.len + 1);
+	fn(&s, ctx);
+	buf[s.len] = '\0';
+
+	output->ptr = buf;
+	output->len = s.len;
+
+	return 0;
+}
+
+static void message_write(struct nrf_cloud_json_stream *const s, const void *const ctx)
+{
+	const struct message *msg = ctx;
+
+	nrf_cloud_json_stream_obj_start(s, NULL);
+
+	if (msg->topic) {
+		nrf_cloud_json_stream_str_add(s, NRF_CLOUD_REST_TOPIC_KEY, msg->topic);
+	}
+
+	nrf_cloud_json_stream_obj_start(s, NRF_CLOUD_REST_MSG_KEY);
+	nrf_cloud_json_stream_str_add(s, NRF_CLOUD_JSON_APPID_KEY, msg->app_id);
+	nrf_cloud_json_stream_str_add(s, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				      NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	nrf_cloud_json_stream_num_add(s, NRF_CLOUD_MSG_TIMESTAMP_KEY, msg->ts);
+
+	if (msg->str_val) {
+		nrf_cloud_json_stream_str_add(s, NRF_CLOUD_JSON_DATA_KEY, msg->str_val);
+	} else {
+		nrf_cloud_json_stream_num_add(s, NRF_CLOUD_JSON_DATA_KEY, msg->value);
+	}
+
+	nrf_cloud_json_stream_obj_end(s);
+	nrf_cloud_json_stream_obj_end(s);
+}
+
+int nrf_cloud_json_stream_message_encode(const char *app_id, double value, const char *str_val,
+					 const char *topic, int64_t ts,
+					 struct nrf_cloud_data *output)
+{
+	const struct message msg = {
+		.app_id = app_id,
+		.value = value,
+		.str_val = str_val,
+		.topic = topic,
+		.ts = ts,
+	};
+
+	return nrf_cloud_json_stream_encode(message_write, &msg, output);
+}
+
+static void sensor_data_write(struct nrf_cloud_json_stream *const s, const void *const ctx)
+{
+	const struct sensor_data *sensor = ctx;
+
+	nrf_cloud_json_stream_obj_start(s, NULL);
+	nrf_cloud_json_stream_str_add(s, NRF_CLOUD_JSON_APPID_KEY, sensor->app_id);
+	nrf_cloud_json_stream_str_add(s, NRF_CLOUD_JSON_DATA_KEY, sensor->data);
+	nrf_cloud_json_stream_str_add(s, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				      NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+		nrf_cloud_json_stream_num_add(s, NRF_CLOUD_MSG_TIMESTAMP_KEY, sensor->ts_ms);
+	}
+	nrf_cloud_json_stream_obj_end(s);
+}
+
+int nrf_cloud_json_stream_sensor_data_encode(const char *const app_id, const char *const data,
+					     const int64_t ts_ms,
+					     struct nrf_cloud_data *const output)
+{
+	const struct sensor_data sensor = {
+		.app_id = app_id,
+		.data = data,
+		.ts_ms = ts_ms,
+	};
+
+	return nrf_cloud_json_stream_encode(sensor_data_write, &sensor, output);
+}
+
+static void control_write(struct nrf_cloud_json_stream *const s,
+			  struct nrf_cloud_ctrl_data const *const data)
+{
+	nrf_cloud_json_stream_obj_start(s, NRF_CLOUD_JSON_KEY_CTRL);
+	if (data) {
+		nrf_cloud_json_stream_bool_add(s, NRF_CLOUD_JSON_KEY_ALERT, data->alerts_enabled);
+		nrf_cloud_json_stream_num_add(s, NRF_CLOUD_JSON_KEY_LOG, data->log_level);
+	} else {
+		nrf_cloud_json_stream_null_add(s, NRF_CLOUD_JSON_KEY_ALERT);
+		nrf_cloud_json_stream_null_add(s, NRF_CLOUD_JSON_KEY_LOG);
+	}
+	nrf_cloud_json_stream_obj_end(s);
+}
+
+static void control_response_write(struct nrf_cloud_json_stream *const s, const void *const ctx)
+{
+	const struct control_response *rsp = ctx;
+
+	nrf_cloud_json_stream_obj_start(s, NULL);
+
+	if (IS_ENABLED(CONFIG_NRF_CLOUD_COAP)) {
+		/* CoAP can currently only modify reported, not desired */
+		control_write(s, rsp->data);
+	} else {
+		nrf_cloud_json_stream_obj_start(s, NRF_CLOUD_JSON_KEY_STATE);
+		if (!rsp->accept) {
+			/* Rejecting, add nulls to desired control items */
+			nrf_cloud_json_stream_obj_start(s, NRF_CLOUD_JSON_KEY_DES);
+			control_write(s, NULL);
+			nrf_cloud_json_stream_obj_end(s);
+		}
+		nrf_cloud_json_stream_obj_start(s, NRF_CLOUD_JSON_KEY_REP);
+		control_write(s, rsp->data);
+		nrf_cloud_json_stream_obj_end(s);
+		nrf_cloud_json_stream_obj_end(s);
+	}
+
+	nrf_cloud_json_stream_obj_end(s);
+}
+
+int nrf_cloud_json_stream_shadow_control_response_encode(
+	struct nrf_cloud_ctrl_data const *const data, const bool accept,
+	struct nrf_cloud_data *const output)
+{
+	const struct control_response rsp = {
+		.data = data,
+		.accept = accept,
+	};
+
+	return nrf_cloud_json_stream_encode(control_response_write, &rsp, output);
+}
+
+/* Same check as in nrf_cloud_codec_internal.c */
+static bool is_local_mac(const uint8_t *const mac)
+{
+	return ((mac[0] & 0x02) || ((mac[0] == 0x00) && (mac[1] == 0x00) && (mac[2] == 0x5E)));
+}
+
+static void cell_write(struct nrf_cloud_json_stream *const s, struct lte_lc_cell const *const inf)
+{
+	nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_ECI, inf->id);
+	nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_MCC, inf->mcc);
+	nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_MNC, inf->mnc);
+	nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_TAC, inf->tac);
+
+	if (inf->earfcn != NRF_CLOUD_LOCATION_CELL_OMIT_EARFCN) {
+		nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN, inf->earfcn);
+	}
+	if (inf->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) {
+		nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP,
+					      RSRP_IDX_TO_DBM(inf->rsrp));
+	}
+	if (inf->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) {
+		nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+					      RSRQ_IDX_TO_DB(inf->rsrq));
+	}
+	if (inf->timing_advance != NRF_CLOUD_LOCATION_CELL_OMIT_TIME_ADV) {
+		nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_T_ADV,
+					      MIN(inf->timing_advance,
+						  NRF_CLOUD_LOCATION_CELL_TIME_ADV_MAX));
+	}
+}
+
+static void ncells_write(struct nrf_cloud_json_stream *const s, const uint8_t ncells_count,
+			 const struct lte_lc_ncell *const neighbor_cells)
+{
+	nrf_cloud_json_stream_arr_start(s, NRF_CLOUD_CELL_POS_JSON_KEY_NBORS);
+
+	for (uint8_t i = 0; i < ncells_count; ++i) {
+		const struct lte_lc_ncell *ncell = neighbor_cells + i;
+
+		nrf_cloud_json_stream_obj_start(s, NULL);
+		nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN, ncell->earfcn);
+		nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_PCI,
+					      ncell->phys_cell_id);
+		if (ncell->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) {
+			nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP,
+						      RSRP_IDX_TO_DBM(ncell->rsrp));
+		}
+		if (ncell->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) {
+			nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+						      RSRQ_IDX_TO_DB(ncell->rsrq));
+		}
+		if (ncell->time_diff != LTE_LC_CELL_TIME_DIFF_INVALID) {
+			nrf_cloud_json_stream_num_add(s, NRF_CLOUD_CELL_POS_JSON_KEY_TDIFF,
+						      ncell->time_diff);
+		}
+		nrf_cloud_json_stream_obj_end(s);
+	}
+
+	nrf_cloud_json_stream_arr_end(s);
+}
+
+static void cells_write(struct nrf_cloud_json_stream *const s,
+			struct lte_lc_cells_info const *const inf)
+{
+	nrf_cloud_json_stream_arr_start(s, NRF_CLOUD_CELL_POS_JSON_KEY_LTE);
+
+	/* If using a GCI search type, sometimes there is no current cell */
+	if (inf->current_cell.id != LTE_LC_CELL_EUTRAN_ID_INVALID) {
+		nrf_cloud_json_stream_obj_start(s, NULL);
+		cell_write(s, &inf->current_cell);
+		if (inf->ncells_count && inf->neighbor_cells) {
+			ncells_write(s, inf->ncells_count, inf->neighbor_cells);
+		}
+		nrf_cloud_json_stream_obj_end(s);
+	}
+
+	if (inf->gci_cells) {
+		for (uint8_t i = 0; i < inf->gci_cells_count; ++i) {
+			nrf_cloud_json_stream_obj_start(s, NULL);
+			cell_write(s, inf->gci_cells + i);
+			nrf_cloud_json_stream_obj_end(s);
+		}
+	}
+
+	nrf_cloud_json_stream_arr_end(s);
+}
+
+static void wifi_write(struct nrf_cloud_json_stream *const s,
+		       struct wifi_scan_info const *const wifi)
+{
+	const bool add_all = IS_ENABLED(CONFIG_NRF_CLOUD_WIFI_LOCATION_ENCODE_OPT_ALL);
+	const bool add_rssi =
+		(add_all || IS_ENABLED(CONFIG_NRF_CLOUD_WIFI_LOCATION_ENCODE_OPT_MAC_RSSI));
+
+	nrf_cloud_json_stream_obj_start(s, NRF_CLOUD_LOCATION_JSON_KEY_WIFI);
+	nrf_cloud_json_stream_arr_start(s, NRF_CLOUD_LOCATION_JSON_KEY_APS);
+
+	for (uint8_t cnt = 0; cnt < wifi->cnt; ++cnt) {
+		char str_buf[MAX(WIFI_MAC_ADDR_STR_LEN, WIFI_SSID_MAX_LEN) + 1];
+		struct wifi_scan_result const *const ap = (wifi->ap_info + cnt);
+
+		if (is_local_mac(ap->mac)) {
+			continue;
+		}
+
+		nrf_cloud_json_stream_obj_start(s, NULL);
+
+		(void)snprintf(str_buf, sizeof(str_buf), WIFI_MAC_ADDR_TEMPLATE, ap->mac[0],
+			       ap->mac[1], ap->mac[2], ap->mac[3], ap->mac[4], ap->mac[5]);
+		nrf_cloud_json_stream_str_add(s, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_MAC, str_buf);
+
+		if (add_rssi && (ap->rssi != NRF_CLOUD_LOCATION_WIFI_OMIT_RSSI)) {
+			nrf_cloud_json_stream_num_add(s, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_RSSI,
+						      ap->rssi);
+		}
+
+		if (add_all) {
+			memset(str_buf, 0, sizeof(str_buf));
+			if ((ap->ssid_length > 0) && (ap->ssid_length <= WIFI_SSID_MAX_LEN)) {
+				memcpy(str_buf, ap->ssid, ap->ssid_length);
+			}
+
+			if (str_buf[0] != '\0') {
+				nrf_cloud_json_stream_str_add(
+					s, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_SSID, str_buf);
+			}
+
+			if (ap->channel != NRF_CLOUD_LOCATION_WIFI_OMIT_CHAN) {
+				nrf_cloud_json_stream_num_add(s, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_CH,
+							      ap->channel);
+			}
+		}
+
+		nrf_cloud_json_stream_obj_end(s);
+	}
+
+	nrf_cloud_json_stream_arr_end(s);
+	nrf_cloud_json_stream_obj_end(s);
+}
+
+static void location_req_write(struct nrf_cloud_json_stream *const s, const void *const ctx)
+{
+	const struct location_req *req = ctx;
+
+	nrf_cloud_json_stream_obj_start(s, NULL);
+	if (req->cells) {
+		cells_write(s, req->cells_inf);
+	}
+	if (req->wifi) {
+		wifi_write(s, req->wifi_inf);
+	}
+	nrf_cloud_json_stream_obj_end(s);
+}
+
+int nrf_cloud_json_stream_location_req_encode(struct lte_lc_cells_info const *const cells_inf,
+					      struct wifi_scan_info const *const wifi_inf,
+					      struct nrf_cloud_data *const output)
+{
+	struct location_req req = {
+		.cells_inf = cells_inf,
+		.wifi_inf = wifi_inf,
+	};
+
+	if ((!cells_inf && !wifi_inf) || !output) {
+		return -EINVAL;
+	}
+
+	/* Decide what goes in the request the same way as the cJSON encoder, before writing */
+	if (cells_inf) {
+		req.cells = (cells_inf->current_cell.id != LTE_LC_CELL_EUTRAN_ID_INVALID) ||
+			    (cells_inf->gci_cells_count && cells_inf->gci_cells);
+		if (!req.cells && !wifi_inf) {
+			return -ENODATA;
+		}
+	}
+
+	if (wifi_inf) {
+		int encoded_cnt = 0;
+
+		if (!wifi_inf->ap_info || !wifi_inf->cnt) {
+			return -EINVAL;
+		}
+
+		for (uint8_t cnt = 0; cnt < wifi_inf->cnt; ++cnt) {
+			encoded_cnt += !is_local_mac(wifi_inf->ap_info[cnt].mac);
+		}
+
+		req.wifi = (encoded_cnt >= NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN);
+		if (!req.wifi && !req.cells) {
+			return -ENODATA;
+		}
+	}
+
+	return nrf_cloud_json_stream_encode(location_req_write, &req, output);
+}
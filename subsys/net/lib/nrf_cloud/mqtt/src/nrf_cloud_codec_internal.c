@@ -8,6 +8,7 @@
 #include <net/nrf_cloud_codec.h>
 #include "nrf_cloud_fsm.h"
 #include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_json_stream.h"
 #include "nrf_cloud_mqtt_internal.h"
 #include <zephyr/logging/log.h>
 #include "nrf_cloud_mem.h"
@@ -60,6 +61,11 @@ int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *sensor,
 	__ASSERT_NO_MSG(output != NULL);
 	__ASSERT_NO_MSG(sensor_type_str != NULL);
 
+	if (IS_ENABLED(CONFIG_NRF_CLOUD_JSON_STREAM)) {
+		return nrf_cloud_json_stream_sensor_data_encode(sensor_type_str, sensor->data.ptr,
+								sensor->ts_ms, output);
+	}
+
 	cJSON *root_obj = cJSON_CreateObject();
 
 	if (root_obj == NULL) {
@@ -25,6 +25,7 @@
 
 #include "nrf_cloud_mem.h"
 #include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_json_stream.h"
 
 LOG_MODULE_REGISTER(nrf_cloud_rest, CONFIG_NRF_CLOUD_REST_LOG_LEVEL);
 
@@ -507,6 +508,48 @@ void nrf_cloud_rest_fota_job_free(struct nrf_cloud_fota_job_info *const job)
 	nrf_cloud_fota_job_free(job);
 }
 
+static int location_payload_encode(struct nrf_cloud_rest_location_request const *const request,
+				   struct nrf_cloud_obj *const payload_obj)
+{
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NRF_CLOUD_JSON_STREAM)) {
+		/* Encode the payload without building the object */
+		ret = nrf_cloud_json_stream_location_req_encode(request->cell_info,
+								request->wifi_info,
+								&payload_obj->encoded_data);
+		if (ret) {
+			LOG_ERR("Failed to create location request payload, err: %d", ret);
+			return ret;
+		}
+
+		payload_obj->enc_src = NRF_CLOUD_ENC_SRC_CLOUD_ENCODED;
+		return 0;
+	}
+
+	/* Init the payload object */
+	ret = nrf_cloud_obj_init(payload_obj);
+	if (ret) {
+		return ret;
+	}
+
+	/* Add the location request payload */
+	ret = nrf_cloud_obj_location_request_payload_add(payload_obj, request->cell_info,
+							 request->wifi_info);
+	if (ret) {
+		LOG_ERR("Failed to create location request payload, err: %d", ret);
+		return ret;
+	}
+
+	/* Encode the payload to be sent to the cloud */
+	ret = nrf_cloud_obj_cloud_encode(payload_obj);
+	if (ret) {
+		LOG_ERR("Failed to encode location request, err: %d", ret);
+	}
+
+	return ret;
+}
+
 int nrf_cloud_rest_location_get(struct nrf_cloud_rest_context *const rest_ctx,
 				struct nrf_cloud_rest_location_request const *const request,
 				struct nrf_cloud_location_result *const result)
@@ -547,27 +590,11 @@ int nrf_cloud_rest_location_get(struct nrf_cloud_rest_context *const rest_ctx,
 
 	req.header_fields = (const char **)headers;
 
-	/* Init the payload object */
-	ret = nrf_cloud_obj_init(&payload_obj);
+	ret = location_payload_encode(request, &payload_obj);
 	if (ret) {
 		goto clean_up;
 	}
 
-	/* Add the location request payload */
-	ret = nrf_cloud_obj_location_request_payload_add(&payload_obj, request->cell_info,
-							 request->wifi_info);
-	if (ret) {
-		LOG_ERR("Failed to create location request payload, err: %d", ret);
-		goto clean_up;
-	}
-
-	/* Encode the payload to be sent to the cloud */
-	ret = nrf_cloud_obj_cloud_encode(&payload_obj);
-	if (ret) {
-		LOG_ERR("Failed to encode location request, err: %d", ret);
-		goto clean_up;
-	}
-
 	/* Add the encoded payload to the REST request */
 	req.body = payload_obj.encoded_data.ptr;
 
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <nrf_compress/implementation.h>
+#include <nrf_compress/delta_types.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(nrf_compress_delta, CONFIG_NRF_COMPRESS_LOG_LEVEL);
+
+#define DELTA_MAGIC 0x544c444eU /* "NDLT" */
+
+/* Opcode and an argument of up to 32 bits */
+#define OP_HEADER_MAX_SIZE 6
+
+static uint8_t output_buffer[CONFIG_NRF_COMPRESS_CHUNK_SIZE];
+
+static const delta_codec *codec;
+
+static struct {
+	/** Header is parsed. */
+	bool started;
+	/** Current operation. */
+	enum delta_op op;
+	/** Bytes left of the current operation. */
+	size_t remaining;
+	/** Input bytes of the current COPY operation header, not reported as used yet. */
+	size_t held;
+	/** Position in the source image. */
+	size_t source_pos;
+	/** Size of the source image that the patch was made for. */
+	size_t source_size;
+	/** Bytes left to output. */
+	size_t target_left;
+	/** Expected size of the output, or 0 if it is not known. */
+	size_t output_limit;
+} state;
+
+static int delta_reset(void *inst, size_t decompressed_size);
+
+static int delta_init(void *inst, size_t decompressed_size)
+{
+	const delta_codec *new_codec = inst;
+
+	if (new_codec == NULL || new_codec->read == NULL) {
+		LOG_ERR("Source image read function is required");
+		return -EINVAL;
+	}
+
+	codec = new_codec;
+
+	return delta_reset(inst, decompressed_size);
+}
+
+static int delta_deinit(void *inst)
+{
+	if (inst != codec) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+	memset(output_buffer, 0x00, sizeof(output_buffer));
+#endif
+
+	codec = NULL;
+
+	return 0;
+}
+
+static int delta_reset(void *inst, size_t decompressed_size)
+{
+	if (inst != codec) {
+		return -EINVAL;
+	}
+
+	memset(&state, 0, sizeof(state));
+	state.output_limit = decompressed_size;
+	memset(output_buffer, 0x00, sizeof(output_buffer));
+
+	return 0;
+}
+
+static size_t delta_bytes_needed(void *inst)
+{
+	return state.started ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : DELTA_HEADER_SIZE;
+}
+
+static int header_parse(const uint8_t *input)
+{
+	if (sys_get_le32(input) != DELTA_MAGIC) {
+		LOG_ERR("Invalid delta patch header");
+		return -EINVAL;
+	}
+
+	state.source_size = sys_get_le32(&input[4]);
+	state.target_left = sys_get_le32(&input[8]);
+
+	if (codec->source_size != 0 && state.source_size != codec->source_size) {
+		LOG_ERR("Delta patch is for a source image of %zu bytes, not %zu",
+			state.source_size, codec->source_size);
+		return -EINVAL;
+	}
+
+	if (state.output_limit != 0 && state.target_left != state.output_limit) {
+		LOG_ERR("Delta patch output is %zu bytes, expected %zu", state.target_left,
+			state.output_limit);
+		return -EINVAL;
+	}
+
+	state.started = true;
+
+	return 0;
+}
+
+/* Parse an operation header when all of it is in the input.
+ * Returns its length, 0 if more input is needed, or a negative errno code.
+ */
+static int op_parse(const uint8_t *input, size_t len)
+{
+	uint32_t arg = 0;
+	size_t i;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	if (input[0] > DELTA_OP_SEEK) {
+		LOG_ERR("Invalid delta operation %u", input[0]);
+		return -EINVAL;
+	}
+
+	for (i = 1; i < MIN(len, OP_HEADER_MAX_SIZE); i++) {
+		arg |= (uint32_t)(input[i] & 0x7f) << (7 * (i - 1));
+
+		if ((input[i] & 0x80) == 0) {
+			break;
+		}
+	}
+
+	if (i == OP_HEADER_MAX_SIZE) {
+		LOG_ERR("Invalid delta operation argument");
+		return -EINVAL;
+	} else if (i == len) {
+		return 0;
+	}
+
+	state.op = input[0];
+
+	if (state.op == DELTA_OP_SEEK) {
+		/* Zigzag decoding */
+		int32_t seek = (int32_t)(arg >> 1) ^ -(int32_t)(arg & 1);
+
+		if ((seek < 0 && (size_t)-(int64_t)seek > state.source_pos) ||
+		    (seek > 0 && (size_t)seek > state.source_size - state.source_pos)) {
+			LOG_ERR("Delta seek out of the source image");
+			return -EINVAL;
+		}
+
+		state.source_pos += seek;
+		state.remaining = 0;
+	} else {
+		if (arg > state.target_left ||
+		    (state.op != DELTA_OP_INSERT && arg > state.source_size - state.source_pos)) {
+			LOG_ERR("Delta operation out of the image");
+			return -EINVAL;
+		}
+
+		state.remaining = arg;
+		state.target_left -= arg;
+	}
+
+	return i + 1;
+}
+
+static int delta_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
+			    uint32_t *offset, uint8_t **output, size_t *output_size)
+{
+	size_t used = 0;
+	size_t out = 0;
+	int rc;
+
+	if (inst != codec || codec == NULL) {
+		return -EINVAL;
+	}
+
+	if (input == NULL || offset == NULL || output == NULL || output_size == NULL) {
+		return -EINVAL;
+	}
+
+	*output = output_buffer;
+	*output_size = 0;
+	*offset = 0;
+
+	if (!state.started) {
+		if (input_size < DELTA_HEADER_SIZE) {
+			return last_part ? -EINVAL : 0;
+		}
+
+		rc = header_parse(input);
+		if (rc) {
+			return rc;
+		}
+
+		*offset = DELTA_HEADER_SIZE;
+
+		return 0;
+	}
+
+	if (state.held > input_size) {
+		return -EINVAL;
+	}
+
+	/* The header of an unfinished COPY operation is given again */
+	used = state.held;
+
+	while (out < sizeof(output_buffer)) {
+		size_t len;
+
+		if (state.remaining == 0) {
+			/* The operation is done, so is its header */
+			state.held = 0;
+
+			rc = op_parse(&input[used], input_size - used);
+			if (rc < 0) {
+				return rc;
+			} else if (rc == 0 && last_part && used < input_size) {
+				LOG_ERR("Delta patch ends within an operation");
+				return -EINVAL;
+			} else if (rc == 0) {
+				break;
+			}
+
+			if (state.op == DELTA_OP_COPY) {
+				state.held = rc;
+			}
+
+			used += rc;
+			continue;
+		}
+
+		len = MIN(state.remaining, sizeof(output_buffer) - out);
+
+		if (state.op != DELTA_OP_COPY) {
+			len = MIN(len, input_size - used);
+			if (len == 0) {
+				break;
+			}
+		}
+
+		if (state.op != DELTA_OP_INSERT) {
+			if (codec->read(state.source_pos, &output_buffer[out], len) != len) {
+				LOG_ERR("Failed to read %zu bytes of the source image at %zu", len,
+					state.source_pos);
+				return -EIO;
+			}
+
+			state.source_pos += len;
+		}
+
+		if (state.op == DELTA_OP_ADD) {
+			for (size_t i = 0; i < len; i++) {
+				output_buffer[out + i] += input[used + i];
+			}
+
+			used += len;
+		} else if (state.op == DELTA_OP_INSERT) {
+			memcpy(&output_buffer[out], &input[used], len);
+			used += len;
+		}
+
+		out += len;
+		state.remaining -= len;
+	}
+
+	if (state.remaining == 0) {
+		state.held = 0;
+	}
+
+	/* Report the header of an unfinished COPY operation as unused, so that the caller
+	 * provides input again, until all of the operation is output.
+	 */
+	*offset = used - state.held;
+	*output_size = out;
+
+	if (last_part && *offset == input_size &&
+	    (state.remaining != 0 || state.target_left != 0)) {
+		LOG_ERR("Delta patch ended %zu bytes short of the target image",
+			state.remaining + state.target_left);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+NRF_COMPRESS_IMPLEMENTATION_DEFINE(delta, NRF_COMPRESS_TYPE_DELTA, delta_init, delta_deinit,
+				   delta_reset, NULL, delta_bytes_needed, delta_decompress);
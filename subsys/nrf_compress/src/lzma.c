@@ -134,7 +134,11 @@ static DictHandle dict_handle;
  */
 typedef struct dict_cache_t {
 	/** Cached dictionary data. */
+#if defined(CONFIG_NRF_COMPRESS_DICTIONARY_BACKGROUND_WRITE)
+	uint8_t *data;
+#else
 	uint8_t data[CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE];
+#endif
 	/** Indicates which dictionary element is stored as first element of @a data. */
 	SizeT dict_pos_begin;
 	/** Indicates which dictionary element is stored as last element of @a data. */
@@ -146,6 +150,30 @@ typedef struct dict_cache_t {
 } dict_cache;
 
 static dict_cache cache;
+
+#if defined(CONFIG_NRF_COMPRESS_DICTIONARY_BACKGROUND_WRITE)
+/** Cache buffers, one is filled while the other one is written in the background. */
+static uint8_t cache_bufs[2][CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE];
+
+/**
+ * @brief Cache buffer that is written to the external dictionary by the writer thread.
+ */
+static struct {
+	/** Data being written. */
+	uint8_t *data;
+	/** Dictionary position of the first element of @a data. */
+	SizeT dict_pos_begin;
+	/** Length of @a data. */
+	SizeT len;
+	/** Set while the write is in progress, or its result is not collected yet. */
+	bool busy;
+	/** Result of the write. */
+	int rc;
+} flush;
+
+static K_SEM_DEFINE(flush_start, 0, 1);
+static K_SEM_DEFINE(flush_done, 0, 1);
+#endif
 #endif
 #endif
 
@@ -157,7 +185,137 @@ static CLzma2Dec lzma_decoder;
 static CLzmaDec lzma_decoder;
 #endif
 
-#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+#if defined(CONFIG_NRF_COMPRESS_DICTIONARY_BACKGROUND_WRITE)
+static void dict_writer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&flush_start, K_FOREVER);
+
+		if (ext_dict->write(flush.dict_pos_begin, flush.data, flush.len) != flush.len) {
+			flush.rc = -EIO;
+		} else {
+			flush.rc = 0;
+		}
+
+		k_sem_give(&flush_done);
+	}
+}
+
+K_THREAD_DEFINE(nrf_compress_dict_writer, CONFIG_NRF_COMPRESS_DICTIONARY_WRITE_STACK_SIZE,
+		dict_writer, NULL, NULL, NULL, CONFIG_NRF_COMPRESS_DICTIONARY_WRITE_PRIORITY, 0, 0);
+
+/**
+ * @brief Wait for the background write of the dictionary cache to complete.
+ *
+ * @retval 0 if no write is in progress or it was successful
+ * @retval -EIO on any error with writing to external dictionary
+ */
+static int flush_wait(void)
+{
+	if (!flush.busy) {
+		return 0;
+	}
+
+	k_sem_take(&flush_done, K_FOREVER);
+	flush.busy = false;
+
+	return flush.rc;
+}
+
+/**
+ * @brief Read dictionary data, from the cache buffers for the data that is not
+ * written to the external dictionary yet, and from the external dictionary otherwise.
+ */
+static SizeT cached_read(SizeT pos, Byte *data, SizeT len)
+{
+	SizeT bytes_read = 0;
+
+	while (bytes_read < len) {
+		const SizeT cache_end = cache.dict_pos_begin + cache.write_offset;
+		const SizeT flush_end = flush.dict_pos_begin + flush.len;
+		SizeT read_pos = pos + bytes_read;
+		SizeT read_len = len - bytes_read;
+
+		if (read_pos >= cache.dict_pos_begin && read_pos < cache_end) {
+			read_len = MIN(read_len, cache_end - read_pos);
+			memcpy(data + bytes_read, cache.data + (read_pos - cache.dict_pos_begin),
+			       read_len);
+		} else if (flush.busy && read_pos >= flush.dict_pos_begin && read_pos < flush_end) {
+			read_len = MIN(read_len, flush_end - read_pos);
+			memcpy(data + bytes_read, flush.data + (read_pos - flush.dict_pos_begin),
+			       read_len);
+		} else {
+			/* Up to the start of the next cached part */
+			if (read_pos < cache.dict_pos_begin) {
+				read_len = MIN(read_len, cache.dict_pos_begin - read_pos);
+			}
+
+			if (flush.busy && read_pos < flush.dict_pos_begin) {
+				read_len = MIN(read_len, flush.dict_pos_begin - read_pos);
+			}
+
+			if (ext_dict->read(read_pos, data + bytes_read, read_len) != read_len) {
+				break;
+			}
+		}
+
+		bytes_read += read_len;
+	}
+
+	return bytes_read;
+}
+
+/**
+ * @brief Start writing the dictionary cache to the external dictionary and proceed
+ * with cache window, in the other cache buffer.
+ *
+ * Unlike the synchronous variant, the next window is not read from the external dictionary,
+ * the data that is not written in it yet is read from the external dictionary instead.
+ *
+ * @param handle pointer to Lzma dictionary handle struct, for dictionary size reference.
+ *
+ * @retval 0 on successful start of the write
+ * @retval -EIO on any error with writing the previous cache to external dictionary
+ */
+static int synchronize_cache(const DictHandle *handle)
+{
+	int rc;
+
+	/* The other buffer is free once its write is done */
+	rc = flush_wait();
+	if (rc != 0) {
+		return rc;
+	}
+
+	flush.data = cache.data;
+	flush.dict_pos_begin = cache.dict_pos_begin;
+	flush.len = cache.write_offset;
+	flush.busy = true;
+	k_sem_give(&flush_start);
+
+	cache.data = (cache.data == cache_bufs[0]) ? cache_bufs[1] : cache_bufs[0];
+	cache.write_offset = 0;
+
+	cache.dict_pos_begin = cache.dict_pos_end + 1;
+
+	if (cache.dict_pos_begin == handle->dicBufSize) {
+		/* We reached the end of dictionary, start caching from the beginning. */
+		cache.dict_pos_begin = 0;
+	}
+
+	cache.dict_pos_end = cache.dict_pos_begin +
+			     MIN(handle->dicBufSize - cache.dict_pos_begin,
+				 CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE) - 1;
+
+	cache.invalid = false;
+
+	return 0;
+}
+#elif CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
 /**
  * @brief Synchronize dictionary cache with external dictionary.
  *
@@ -614,6 +772,12 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 		if (cache.invalid) {
 			rc = synchronize_cache(decoder->dicHandle);
 		}
+#endif
+#if defined(CONFIG_NRF_COMPRESS_DICTIONARY_BACKGROUND_WRITE)
+		/* The output is read from the external dictionary */
+		if (rc == 0) {
+			rc = flush_wait();
+		}
 #endif
 		*output_size = decoder->dicPos;
 		decoder->dicPos = 0;
@@ -642,9 +806,12 @@ DictHandle *LzmaDictionaryOpen(SizeT size)
 	dict_handle.isOpened = True;
 	dict_handle.dicBufSize = dict_size;
 
+#if defined(CONFIG_NRF_COMPRESS_DICTIONARY_BACKGROUND_WRITE)
+	cache.data = cache_bufs[0];
+#endif
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
 	cache.dict_pos_begin = 0;
-	cache.dict_pos_end = sizeof(cache.data) - 1;
+	cache.dict_pos_end = CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE - 1;
 	cache.write_offset = 0;
 #endif
 
@@ -676,8 +843,9 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 
 	while (bytes_written < write_len) {
 		SizeT cache_write_len =
-			(write_len - bytes_written) > (sizeof(cache.data) - cache.write_offset) ?
-				(sizeof(cache.data) - cache.write_offset) :
+			(write_len - bytes_written) >
+					(CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE - cache.write_offset) ?
+				(CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE - cache.write_offset) :
 				(write_len - bytes_written);
 
 		memcpy(cache.data + cache.write_offset, data + bytes_written, cache_write_len);
@@ -686,7 +854,7 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 		bytes_written += cache_write_len;
 		cache.write_offset += cache_write_len;
 
-		if (cache.write_offset >= sizeof(cache.data)) {
+		if (cache.write_offset >= CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE) {
 			/* Cache full, synchronize it. */
 			if (synchronize_cache(handle) != 0) {
 				bytes_written = 0;
@@ -712,7 +880,9 @@ SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 		read_len = handle->dicBufSize - pos;
 	}
 
-#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+#if defined(CONFIG_NRF_COMPRESS_DICTIONARY_BACKGROUND_WRITE)
+	return cached_read(pos, data, read_len);
+#elif CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
 	SizeT bytes_read = 0;
 
 	if (pos + read_len > cache.dict_pos_begin && pos <= cache.dict_pos_end) {
@@ -769,8 +939,17 @@ SRes LzmaDictionaryClose(DictHandle *handle)
 		}
 	}
 
+#if defined(CONFIG_NRF_COMPRESS_DICTIONARY_BACKGROUND_WRITE)
+	if (flush_wait() != 0) {
+		rc = SZ_ERROR_MEM;
+	}
+
+	/* Clear the cache. */
+	memset(cache_bufs, 0, sizeof(cache_bufs));
+#else
 	/* Clear the cache. */
 	memset(cache.data, 0, sizeof(cache.data));
+#endif
 #endif
 
 	if (ext_dict->close() != 0) {
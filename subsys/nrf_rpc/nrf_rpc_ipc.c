@@ -13,6 +13,7 @@
 #include <openamp/rpmsg.h>
 #endif /* CONFIG_OPENAMP */
 #include <zephyr/ipc/ipc_service.h>
+#include <zephyr/ipc/ipc_service_backend.h>
 
 #include <zephyr/logging/log.h>
 
@@ -80,6 +81,70 @@ static int translate_error(int ll_err)
 	return 0;
 }
 
+#if CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY
+/* Stores a shared memory buffer, so that send and free can tell it apart from a heap buffer. */
+static bool tx_buf_track(struct nrf_rpc_ipc *ipc_config, const void *buf)
+{
+	bool tracked = false;
+
+	K_SPINLOCK(&ipc_config->tx_bufs_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(ipc_config->tx_bufs); i++) {
+			if (ipc_config->tx_bufs[i] == NULL) {
+				ipc_config->tx_bufs[i] = buf;
+				tracked = true;
+				break;
+			}
+		}
+	}
+
+	return tracked;
+}
+
+static bool tx_buf_untrack(struct nrf_rpc_ipc *ipc_config, const void *buf)
+{
+	bool found = false;
+
+	K_SPINLOCK(&ipc_config->tx_bufs_lock) {
+		for (size_t i = 0; i < ARRAY_SIZE(ipc_config->tx_bufs); i++) {
+			if (ipc_config->tx_bufs[i] == buf) {
+				ipc_config->tx_bufs[i] = NULL;
+				found = true;
+				break;
+			}
+		}
+	}
+
+	return found;
+}
+
+static void *tx_buf_shared_alloc(struct nrf_rpc_ipc *ipc_config, size_t size)
+{
+	struct nrf_rpc_ipc_endpoint *endpoint = &ipc_config->endpoint;
+	void *data;
+	uint32_t len = size;
+	int err;
+
+	/* Shared buffers can only be obtained once the endpoint is bound. */
+	if (!ipc_config->zero_copy || ipc_config->state == NRF_RPC_IPC_STATE_ERROR ||
+	    !k_event_test(&endpoint->ept_bond, 0x01)) {
+		return NULL;
+	}
+
+	err = ipc_service_get_tx_buffer(&endpoint->ept, &data, &len, K_NO_WAIT);
+	if (err < 0) {
+		LOG_DBG("No shared buffer of %zu bytes: %d", size, err);
+		return NULL;
+	}
+
+	if (!tx_buf_track(ipc_config, data)) {
+		(void)ipc_service_drop_tx_buffer(&endpoint->ept, data);
+		return NULL;
+	}
+
+	return data;
+}
+#endif /* CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY */
+
 static void ept_bound(void *priv)
 {
 	const struct nrf_rpc_tr *transport = priv;
@@ -150,12 +215,32 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		return translate_error(err);
 	}
 
+#if CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY
+	const struct ipc_service_backend *backend = ipc_config->ipc->api;
+
+	ipc_config->zero_copy = backend->get_tx_buffer != NULL &&
+				backend->drop_tx_buffer != NULL && backend->send_nocopy != NULL;
+#endif
+
 	ipc_config->endpoint.timeout = K_TIMEOUT_ABS_MS(k_uptime_get() + EPT_BIND_TIMEOUT_MS);
 	ipc_config->state = NRF_RPC_IPC_STATE_WAITING;
 
 	return 0;
 }
 
+/* Gives back a buffer from tx_buf_alloc() that is not going to be sent. */
+static void tx_buf_release(struct nrf_rpc_ipc *ipc_config, const void *buf)
+{
+#if CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY
+	if (tx_buf_untrack(ipc_config, buf)) {
+		(void)ipc_service_drop_tx_buffer(&ipc_config->endpoint.ept, buf);
+		return;
+	}
+#endif
+
+	k_free((void *)buf);
+}
+
 static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
 	int err;
@@ -170,6 +255,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		if (!k_event_wait(&endpoint->ept_bond, 0x01, false,
 				ipc_config->endpoint.timeout)) {
 			LOG_ERR("IPC endpoint bond timeout");
+			tx_buf_release(ipc_config, data);
 			return -NRF_EPIPE;
 		}
 		ipc_config->state = NRF_RPC_IPC_STATE_READY;
@@ -178,12 +264,25 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		break;
 	case NRF_RPC_IPC_STATE_ERROR:
 		LOG_ERR("IPC endpoint error");
+		tx_buf_release(ipc_config, data);
 		return -NRF_EPIPE;
 	}
 
 	LOG_DBG("Sending %u bytes", length);
 	DUMP_LIMITED_DBG(data, length, "Data: ");
 
+#if CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY
+	if (tx_buf_untrack(ipc_config, data)) {
+		err = ipc_service_send_nocopy(&endpoint->ept, data, length);
+		if (err < 0) {
+			LOG_ERR("ipc_service_send_nocopy returned err: %d", err);
+			(void)ipc_service_drop_tx_buffer(&endpoint->ept, data);
+		}
+
+		return translate_error(err);
+	}
+#endif
+
 	err = ipc_service_send(&endpoint->ept, data, length);
 	if (err < 0) {
 		LOG_ERR("ipc_service_send returned err: %d", err);
@@ -207,6 +306,13 @@ static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
 		goto error;
 	}
 
+#if CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY
+	data = tx_buf_shared_alloc(ipc_config, *size);
+	if (data) {
+		return data;
+	}
+#endif
+
 	data = k_malloc(*size);
 	if (!data) {
 		LOG_ERR("Failed to allocate Tx buffer.");
@@ -231,7 +337,7 @@ static void tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
 		return;
 	}
 
-	k_free(buf);
+	tx_buf_release(ipc_config, buf);
 }
 
 const struct nrf_rpc_tr_api nrf_rpc_ipc_service_api = {
@@ -9,15 +9,30 @@
 #include <nrf_rpc/nrf_rpc_uart.h>
 #include <nrf_rpc_errno.h>
 
+#include "nrf_rpc_uart_internal.h"
+
 #include <zephyr/drivers/uart.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/crc.h>
 
+#include <string.h>
+
 LOG_MODULE_REGISTER(nrf_rpc_uart, CONFIG_NRF_RPC_TR_LOG_LEVEL);
 
-#define CRC_SIZE sizeof(uint16_t)
+/* The CRC sequence bit is only used by the stop-and-wait protocol */
+#define CRC_FLIP_ENABLED                                                                           \
+	(IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) && !IS_ENABLED(CONFIG_NRF_RPC_UART_BATCHING))
+
+#if CONFIG_NRF_RPC_UART_BATCHING
+#if CONFIG_NRF_RPC_UART_RELIABLE
+/* Consecutive out-of-sequence frames after which the receiver assumes the sender restarted */
+#define RX_RESYNC_THRESHOLD (TX_WINDOW * CONFIG_NRF_RPC_UART_TX_ATTEMPTS + 1)
+#endif
+
+#define TX_ACK_NONE -1
+#endif /* CONFIG_NRF_RPC_UART_BATCHING */
 
 enum {
 	HDLC_CHAR_ESCAPE = 0x7d,
@@ -29,64 +44,32 @@ enum flip_state {
 	FLIP_ONE
 };
 
-struct trx_flips {
-	uint8_t tx_flip : 1;
-	uint8_t rx_flip_any : 1;
-	uint16_t last_rx_crc;
-};
-
-enum hdlc_state {
-	/* Ignore incoming bytes until the delimiter is found. */
-	HDLC_STATE_UNSYNC,
-	/* Append incoming bytes to the output buffer. */
-	HDLC_STATE_FRAME,
-	/* Found the delimeter when the output buffer was non-empty. */
-	HDLC_STATE_FRAME_FOUND,
-	/* Found the escape byte. Append the following byte XORed with 0x20 to the output buffer. */
-	HDLC_STATE_ESCAPE,
-};
-
-struct hdlc_decode_ctx {
-	enum hdlc_state state;
-	/* The number of bytes of the current packet that have been decoded so far. */
-	uint16_t len;
-	/* The capacity of the buffer to store a decoded packet. */
-	uint16_t capacity;
-};
-
-struct nrf_rpc_uart {
-	const struct device *uart;
-	nrf_rpc_tr_receive_handler_t receive_callback;
-	void *receive_ctx;
-	const struct nrf_rpc_tr *transport;
+#if CONFIG_NRF_RPC_UART_STATS
+#define STATS_ADD(uart_tr, field, val)                                                             \
+	do {                                                                                       \
+		K_SPINLOCK(&(uart_tr)->stats_lock) {                                               \
+			(uart_tr)->stats.field += (val);                                           \
+		}                                                                                  \
+	} while (0)
 
-	/* RX ring buffer populated by UART ISR */
-	uint8_t rx_buffer[CONFIG_NRF_RPC_UART_RX_RINGBUF_SIZE];
-	struct ring_buf rx_ringbuf;
+#define STATS_LATENCY(uart_tr, name, start)                                                        \
+	stats_latency_update(uart_tr, &(uart_tr)->stats.name##_last_us,                            \
+			     &(uart_tr)->stats.name##_max_us, start)
 
-	/* RX work to consume and decode bytes from RX ring buffer */
-	struct k_work rx_work;
-	struct k_work_q rx_workq;
-
-	K_KERNEL_STACK_MEMBER(rx_workq_stack, CONFIG_NRF_RPC_UART_RX_THREAD_STACK_SIZE);
-
-	/* HDLC ack decoding state */
-	struct hdlc_decode_ctx rx_ack_ctx;
-	uint8_t rx_ack[CRC_SIZE];
-
-	/* HDLC packet decoding state */
-	struct hdlc_decode_ctx rx_pkt_ctx;
-	uint8_t rx_pkt[CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE];
-
-	/* Ack waiting semaphore */
-	struct k_sem ack_sem;
-	uint16_t ack_payload;
-	struct k_mutex ack_tx_lock;
-	struct trx_flips flips;
+static __maybe_unused void stats_latency_update(struct nrf_rpc_uart *uart_tr, uint32_t *last,
+						uint32_t *max, uint32_t start)
+{
+	uint32_t latency = k_cyc_to_us_floor32(k_cycle_get_32() - start);
 
-	/* TX lock */
-	struct k_mutex tx_lock;
-};
+	K_SPINLOCK(&uart_tr->stats_lock) {
+		*last = latency;
+		*max = MAX(*max, latency);
+	}
+}
+#else
+#define STATS_ADD(uart_tr, field, val)
+#define STATS_LATENCY(uart_tr, name, start) ARG_UNUSED(start)
+#endif /* CONFIG_NRF_RPC_UART_STATS */
 
 static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt, ...)
 {
@@ -104,6 +87,10 @@ static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt,
 
 static void send_byte(const struct device *dev, uint8_t byte);
 
+#if CONFIG_NRF_RPC_UART_BATCHING
+static void tx_work_handler(struct k_work *work);
+#endif
+
 static void ack_rx(struct nrf_rpc_uart *uart_tr)
 {
 	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) || uart_tr->rx_ack_ctx.len != CRC_SIZE) {
@@ -115,12 +102,23 @@ static void ack_rx(struct nrf_rpc_uart *uart_tr)
 
 	LOG_DBG(">>> RX ack %04x", rx_ack);
 
+#if CONFIG_NRF_RPC_UART_BATCHING
+	/* The ack carries the sequence number and its complement */
+	if (uart_tr->rx_ack[1] != (uint8_t)~uart_tr->rx_ack[0]) {
+		LOG_WRN("Received invalid ack %04x", rx_ack);
+		return;
+	}
+
+	atomic_set(&uart_tr->tx_ack, uart_tr->rx_ack[0]);
+	k_sem_give(&uart_tr->tx_sem);
+#else
 	if (uart_tr->ack_payload != rx_ack) {
 		LOG_WRN("Received ack %04x but expected %04x", rx_ack, uart_tr->ack_payload);
 		return;
 	}
 
 	k_sem_give(&uart_tr->ack_sem);
+#endif
 }
 
 static void ack_tx(struct nrf_rpc_uart *uart_tr, uint16_t ack_pld)
@@ -145,6 +143,7 @@ static void ack_tx(struct nrf_rpc_uart *uart_tr, uint16_t ack_pld)
 	k_mutex_unlock(&uart_tr->ack_tx_lock);
 }
 
+#if !CONFIG_NRF_RPC_UART_BATCHING
 static uint16_t tx_flip(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 {
 	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
@@ -180,10 +179,11 @@ static bool rx_flip_check(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 
 	return true;
 }
+#endif /* !CONFIG_NRF_RPC_UART_BATCHING */
 
 static bool crc_compare(uint16_t rx_crc, uint16_t calc_crc)
 {
-	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
+	if (CRC_FLIP_ENABLED) {
 		return (rx_crc & 0x7fffu) == (calc_crc & 0x7fffu);
 	}
 
@@ -229,6 +229,94 @@ static void hdlc_decode_byte(struct hdlc_decode_ctx *ctx, uint8_t *out, uint8_t
 	out[ctx->len++] = in;
 }
 
+#if CONFIG_NRF_RPC_UART_BATCHING
+#if CONFIG_NRF_RPC_UART_RELIABLE
+static uint16_t batch_ack(uint8_t seq)
+{
+	return seq | ((uint8_t)~seq << 8);
+}
+#endif
+
+static bool rx_seq_check(struct nrf_rpc_uart *uart_tr, uint8_t seq)
+{
+#if CONFIG_NRF_RPC_UART_RELIABLE
+	if (uart_tr->rx_seq_valid && seq != uart_tr->rx_seq) {
+		if (++uart_tr->rx_seq_errors < RX_RESYNC_THRESHOLD) {
+			if ((int8_t)(seq - uart_tr->rx_seq) < 0) {
+				/* The ack got lost, repeat the latest one to let the sender
+				 * move on.
+				 */
+				LOG_WRN("Duplicate frame %u", seq);
+				STATS_ADD(uart_tr, rx_duplicates, 1);
+				ack_tx(uart_tr, batch_ack(uart_tr->rx_seq - 1));
+			} else {
+				/* A preceding frame got lost, wait for its retransmission */
+				LOG_WRN("Received frame %u but expected %u", seq, uart_tr->rx_seq);
+				STATS_ADD(uart_tr, rx_errors, 1);
+			}
+
+			return false;
+		}
+
+		LOG_WRN("Resynchronizing to frame %u", seq);
+	}
+
+	uart_tr->rx_seq = seq + 1;
+	uart_tr->rx_seq_valid = true;
+	uart_tr->rx_seq_errors = 0;
+	ack_tx(uart_tr, batch_ack(seq));
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE */
+
+	return true;
+}
+
+static void batch_rx(struct nrf_rpc_uart *uart_tr)
+{
+	const uint8_t *end = uart_tr->rx_pkt + uart_tr->rx_pkt_ctx.len;
+	const uint8_t *pos = uart_tr->rx_pkt + BATCH_SEQ_SIZE;
+	uint16_t len;
+
+	/* Validate the whole frame before passing any of its packets to nRF RPC */
+	if (pos >= end) {
+		goto invalid;
+	}
+
+	for (const uint8_t *next = pos; next < end; next += BATCH_LEN_SIZE + len) {
+		if (end - next < BATCH_LEN_SIZE) {
+			goto invalid;
+		}
+
+		len = sys_get_le16(next);
+
+		if (len > end - next - BATCH_LEN_SIZE) {
+			goto invalid;
+		}
+	}
+
+	if (!rx_seq_check(uart_tr, uart_tr->rx_pkt[0])) {
+		return;
+	}
+
+	STATS_ADD(uart_tr, rx_frames, 1);
+	STATS_ADD(uart_tr, rx_bytes, uart_tr->rx_pkt_ctx.len);
+
+	while (pos < end) {
+		len = sys_get_le16(pos);
+		pos += BATCH_LEN_SIZE;
+
+		STATS_ADD(uart_tr, rx_packets, 1);
+		uart_tr->receive_callback(uart_tr->transport, pos, len, uart_tr->receive_ctx);
+		pos += len;
+	}
+
+	return;
+
+invalid:
+	LOG_ERR("Malformed frame");
+	STATS_ADD(uart_tr, rx_errors, 1);
+}
+#endif /* CONFIG_NRF_RPC_UART_BATCHING */
+
 static void work_handler(struct k_work *work)
 {
 	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(work, struct nrf_rpc_uart, rx_work);
@@ -264,18 +352,27 @@ static void work_handler(struct k_work *work)
 			if (!crc_compare(crc_received, crc_calculated)) {
 				LOG_ERR("Invalid packet CRC: calculated %04x but received %04x",
 					crc_calculated, crc_received);
+				STATS_ADD(uart_tr, rx_errors, 1);
 				continue;
 			}
 
+#if CONFIG_NRF_RPC_UART_BATCHING
+			batch_rx(uart_tr);
+#else
 			ack_tx(uart_tr, crc_received);
 
 			if (rx_flip_check(uart_tr, crc_received)) {
 				LOG_WRN("Duplicate packet %04x", crc_received);
+				STATS_ADD(uart_tr, rx_duplicates, 1);
 			} else {
+				STATS_ADD(uart_tr, rx_frames, 1);
+				STATS_ADD(uart_tr, rx_packets, 1);
+				STATS_ADD(uart_tr, rx_bytes, uart_tr->rx_pkt_ctx.len);
 				uart_tr->receive_callback(uart_tr->transport, uart_tr->rx_pkt,
 							  uart_tr->rx_pkt_ctx.len,
 							  uart_tr->receive_ctx);
 			}
+#endif
 		}
 
 		ret = ring_buf_get_finish(&uart_tr->rx_ringbuf, len);
@@ -372,9 +469,9 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 	}
 
 	k_mutex_init(&uart_tr->tx_lock);
+	k_mutex_init(&uart_tr->ack_tx_lock);
 
 	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
-		k_mutex_init(&uart_tr->ack_tx_lock);
 		k_sem_init(&uart_tr->ack_sem, 0, 1);
 		uart_tr->flips.tx_flip = FLIP_ZERO;
 		uart_tr->flips.rx_flip_any = 1;
@@ -386,6 +483,22 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 			   &workq_cfg);
 
 	k_work_init(&uart_tr->rx_work, work_handler);
+
+#if CONFIG_NRF_RPC_UART_BATCHING
+	const struct k_work_queue_config tx_workq_cfg = {.name = "rpc uart tx"};
+
+	k_fifo_init(&uart_tr->tx_fifo);
+	k_sem_init(&uart_tr->tx_sem, 0, 1);
+	atomic_set(&uart_tr->tx_ack, TX_ACK_NONE);
+
+	k_work_queue_init(&uart_tr->tx_workq);
+	k_work_queue_start(&uart_tr->tx_workq, uart_tr->tx_workq_stack,
+			   K_THREAD_STACK_SIZEOF(uart_tr->tx_workq_stack), K_PRIO_PREEMPT(0),
+			   &tx_workq_cfg);
+
+	k_work_init(&uart_tr->tx_work, tx_work_handler);
+#endif
+
 	ring_buf_init(&uart_tr->rx_ringbuf, sizeof(uart_tr->rx_buffer), uart_tr->rx_buffer);
 
 	uart_tr->rx_pkt_ctx.state = HDLC_STATE_UNSYNC;
@@ -408,9 +521,228 @@ static void send_byte(const struct device *dev, uint8_t byte)
 	uart_poll_out(dev, byte);
 }
 
+static void frame_write(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t length,
+			uint16_t crc_val)
+{
+	uint8_t crc[CRC_SIZE];
+
+	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+
+	for (size_t i = 0; i < length; i++) {
+		send_byte(uart_tr->uart, data[i]);
+	}
+
+	sys_put_le16(crc_val, crc);
+	send_byte(uart_tr->uart, crc[0]);
+	send_byte(uart_tr->uart, crc[1]);
+
+	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+
+	STATS_ADD(uart_tr, tx_frames, 1);
+	STATS_ADD(uart_tr, tx_bytes, length);
+}
+
+#if CONFIG_NRF_RPC_UART_BATCHING
+static struct tx_pkt *tx_pkt_get(const void *buf)
+{
+	return (struct tx_pkt *)((uint8_t *)buf - offsetof(struct tx_pkt, data));
+}
+
+static struct tx_frame *tx_frame_get(struct nrf_rpc_uart *uart_tr, uint8_t idx)
+{
+	return &uart_tr->tx_frames[(uart_tr->tx_head + idx) % TX_WINDOW];
+}
+
+static void tx_frame_write(struct nrf_rpc_uart *uart_tr, struct tx_frame *frame)
+{
+	uint16_t crc_val = crc16_ccitt(0xffff, frame->data, frame->len);
+
+	log_hexdump_dbg(frame->data, frame->len, "<<< TX frame %u", frame->data[0]);
+
+	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
+	frame_write(uart_tr, frame->data, frame->len, crc_val);
+	k_mutex_unlock(&uart_tr->ack_tx_lock);
+
+	frame->sent = k_cycle_get_32();
+	frame->attempts++;
+}
+
+/* Aggregates as many queued packets as fit into a single frame */
+static bool tx_frame_build(struct nrf_rpc_uart *uart_tr, struct tx_frame *frame)
+{
+	struct tx_pkt *pkt;
+
+	frame->data[0] = uart_tr->tx_seq;
+	frame->len = BATCH_SEQ_SIZE;
+	frame->attempts = 0;
+
+	/* The TX work is the only consumer, so the peeked packet cannot go away */
+	while ((pkt = k_fifo_peek_head(&uart_tr->tx_fifo)) != NULL) {
+		if (frame->len + BATCH_LEN_SIZE + pkt->len > BATCH_PAYLOAD_MAX) {
+			break;
+		}
+
+		(void)k_fifo_get(&uart_tr->tx_fifo, K_NO_WAIT);
+
+		sys_put_le16(pkt->len, &frame->data[frame->len]);
+		memcpy(&frame->data[frame->len + BATCH_LEN_SIZE], pkt->data, pkt->len);
+		frame->len += BATCH_LEN_SIZE + pkt->len;
+
+		STATS_ADD(uart_tr, tx_packets, 1);
+		STATS_LATENCY(uart_tr, queue_latency, pkt->enqueued);
+		k_free(pkt);
+	}
+
+	if (frame->len == BATCH_SEQ_SIZE) {
+		return false;
+	}
+
+	uart_tr->tx_seq++;
+
+	return true;
+}
+
+#if CONFIG_NRF_RPC_UART_RELIABLE
+static void tx_window_release(struct nrf_rpc_uart *uart_tr, uint8_t cnt)
+{
+	uart_tr->tx_head = (uart_tr->tx_head + cnt) % TX_WINDOW;
+	uart_tr->tx_in_flight -= cnt;
+}
+
+static void tx_ack_process(struct nrf_rpc_uart *uart_tr)
+{
+	atomic_val_t ack = atomic_set(&uart_tr->tx_ack, TX_ACK_NONE);
+	uint8_t idx;
+
+	if (ack == TX_ACK_NONE || uart_tr->tx_in_flight == 0) {
+		return;
+	}
+
+	/* Acks are cumulative, all frames up to the acknowledged one have been received */
+	idx = (uint8_t)ack - tx_frame_get(uart_tr, 0)->data[0];
+
+	if (idx >= uart_tr->tx_in_flight) {
+		LOG_WRN("Received ack %u outside of the TX window", (uint8_t)ack);
+		return;
+	}
+
+	LOG_DBG("Acked successfully up to frame %u", (uint8_t)ack);
+	STATS_LATENCY(uart_tr, ack_latency, tx_frame_get(uart_tr, idx)->sent);
+	tx_window_release(uart_tr, idx + 1);
+}
+
+static void tx_ack_wait(struct nrf_rpc_uart *uart_tr)
+{
+	struct tx_frame *head = tx_frame_get(uart_tr, 0);
+	uint32_t elapsed = k_cyc_to_ms_floor32(k_cycle_get_32() - head->sent);
+
+	if (elapsed < CONFIG_NRF_RPC_UART_ACK_WAITING_TIME) {
+		(void)k_sem_take(&uart_tr->tx_sem,
+				 K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME - elapsed));
+		return;
+	}
+
+	if (head->attempts >= CONFIG_NRF_RPC_UART_TX_ATTEMPTS) {
+		LOG_ERR("Frame %u not acknowledged, dropping", head->data[0]);
+		STATS_ADD(uart_tr, tx_drops, 1);
+		tx_window_release(uart_tr, 1);
+		return;
+	}
+
+	/* The receiver discards all frames following a lost one, so send them all again */
+	LOG_WRN("Ack timeout, retransmitting %u frames", uart_tr->tx_in_flight);
+
+	for (uint8_t i = 0; i < uart_tr->tx_in_flight; i++) {
+		tx_frame_write(uart_tr, tx_frame_get(uart_tr, i));
+	}
+
+	STATS_ADD(uart_tr, tx_retransmissions, uart_tr->tx_in_flight);
+}
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE */
+
+static void tx_work_handler(struct k_work *work)
+{
+	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(work, struct nrf_rpc_uart, tx_work);
+	struct tx_frame *frame;
+
+	while (true) {
+#if CONFIG_NRF_RPC_UART_RELIABLE
+		tx_ack_process(uart_tr);
+#endif
+
+		while (uart_tr->tx_in_flight < TX_WINDOW) {
+			frame = tx_frame_get(uart_tr, uart_tr->tx_in_flight);
+
+			if (!tx_frame_build(uart_tr, frame)) {
+				break;
+			}
+
+			tx_frame_write(uart_tr, frame);
+			uart_tr->tx_in_flight++;
+		}
+
+#if CONFIG_NRF_RPC_UART_RELIABLE
+		if (uart_tr->tx_in_flight > 0) {
+			tx_ack_wait(uart_tr);
+			continue;
+		}
+#else
+		uart_tr->tx_in_flight = 0;
+#endif
+
+		/* Packets queued after this point resubmit the work */
+		if (k_fifo_is_empty(&uart_tr->tx_fifo)) {
+			break;
+		}
+	}
+}
+
+static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
+{
+	struct nrf_rpc_uart *uart_tr = transport->ctx;
+	struct tx_pkt *pkt = tx_pkt_get(data);
+
+	if (length > BATCH_PKT_MAX) {
+		LOG_ERR("Packet too long: %zu", length);
+		k_free(pkt);
+		return -NRF_EINVAL;
+	}
+
+	pkt->len = length;
+	pkt->enqueued = k_cycle_get_32();
+
+	k_fifo_put(&uart_tr->tx_fifo, pkt);
+	k_sem_give(&uart_tr->tx_sem);
+	k_work_submit_to_queue(&uart_tr->tx_workq, &uart_tr->tx_work);
+
+	return 0;
+}
+
+static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
+{
+	struct tx_pkt *pkt;
+
+	pkt = k_malloc(sizeof(*pkt) + *size);
+	if (!pkt) {
+		LOG_ERR("Failed to allocate TX buffer");
+		/* It should fail to avoid writing to NULL buffer. */
+		k_oops();
+		*size = 0;
+		return NULL;
+	}
+
+	return pkt->data;
+}
+
+static void tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
+{
+	ARG_UNUSED(transport);
+
+	k_free(tx_pkt_get(buf));
+}
+#else
 static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
-	uint8_t crc[2];
 	uint16_t crc_val;
 	bool acked = true;
 	struct nrf_rpc_uart *uart_tr = transport->ctx;
@@ -420,6 +752,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 	crc_val = crc16_ccitt(0xffff, data, length);
 	crc_val = tx_flip(uart_tr, crc_val);
 	log_hexdump_dbg(data, length, "<<< TX packet %04x", crc_val);
+	STATS_ADD(uart_tr, tx_packets, 1);
 
 #if CONFIG_NRF_RPC_UART_RELIABLE
 	int attempts = 0;
@@ -433,30 +766,30 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		k_sem_reset(&uart_tr->ack_sem);
 #endif /* CONFIG_NRF_RPC_UART_RELIABLE */
 
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-		for (size_t i = 0; i < length; i++) {
-			send_byte(uart_tr->uart, data[i]);
-		}
-
-		sys_put_le16(crc_val, crc);
-		send_byte(uart_tr->uart, crc[0]);
-		send_byte(uart_tr->uart, crc[1]);
-
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+		frame_write(uart_tr, data, length, crc_val);
 
 #if CONFIG_NRF_RPC_UART_RELIABLE
+		uint32_t sent = k_cycle_get_32();
+
 		k_mutex_unlock(&uart_tr->ack_tx_lock);
 		if (k_sem_take(&uart_tr->ack_sem, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME)) ==
 		    0) {
 			acked = true;
 			LOG_DBG("Acked successfully");
+			STATS_LATENCY(uart_tr, ack_latency, sent);
 		} else {
 			LOG_WRN("Ack timeout");
+			if (attempts < CONFIG_NRF_RPC_UART_TX_ATTEMPTS) {
+				STATS_ADD(uart_tr, tx_retransmissions, 1);
+			}
 		}
 	} while (!acked && attempts < CONFIG_NRF_RPC_UART_TX_ATTEMPTS);
 #endif /* CONFIG_NRF_RPC_UART_RELIABLE */
 
+	if (!acked) {
+		STATS_ADD(uart_tr, tx_drops, 1);
+	}
+
 	k_free((void *)data);
 
 	k_mutex_unlock(&uart_tr->tx_lock);
@@ -489,6 +822,27 @@ static void tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
 
 	k_free(buf);
 }
+#endif /* CONFIG_NRF_RPC_UART_BATCHING */
+
+#if CONFIG_NRF_RPC_UART_STATS
+void nrf_rpc_uart_stats_get(const struct nrf_rpc_tr *transport, struct nrf_rpc_uart_stats *stats)
+{
+	struct nrf_rpc_uart *uart_tr = transport->ctx;
+
+	K_SPINLOCK(&uart_tr->stats_lock) {
+		*stats = uart_tr->stats;
+	}
+}
+
+void nrf_rpc_uart_stats_reset(const struct nrf_rpc_tr *transport)
+{
+	struct nrf_rpc_uart *uart_tr = transport->ctx;
+
+	K_SPINLOCK(&uart_tr->stats_lock) {
+		memset(&uart_tr->stats, 0, sizeof(uart_tr->stats));
+	}
+}
+#endif /* CONFIG_NRF_RPC_UART_STATS */
 
 __weak void nrf_rpc_uart_initialized_hook(const struct device *uart_dev)
 {
@@ -501,17 +855,4 @@ const struct nrf_rpc_tr_api nrf_rpc_uart_service_api = {
 	.tx_buf_free = tx_buf_free,
 };
 
-#define NRF_RPC_UART_INSTANCE(node_id) _CONCAT(nrf_rpc_inst_, DT_DEP_ORD(node_id))
-
-#define NRF_RPC_UART_TRANSPORT_DEFINE(node_id)                                                     \
-	struct nrf_rpc_uart NRF_RPC_UART_INSTANCE(node_id) = {                                     \
-		.uart = DEVICE_DT_GET(node_id),                                                    \
-		.receive_callback = NULL,                                                          \
-		.transport = NULL,                                                                 \
-	};                                                                                         \
-	const struct nrf_rpc_tr NRF_RPC_UART_TRANSPORT(node_id) = {                                \
-		.api = &nrf_rpc_uart_service_api,                                                  \
-		.ctx = &NRF_RPC_UART_INSTANCE(node_id),                                            \
-	};
-
 DT_FOREACH_STATUS_OKAY(nordic_nrf_uarte, NRF_RPC_UART_TRANSPORT_DEFINE);
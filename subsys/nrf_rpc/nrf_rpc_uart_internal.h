@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_UART_INTERNAL_H_
+#define NRF_RPC_UART_INTERNAL_H_
+
+#include <nrf_rpc_tr.h>
+#include <nrf_rpc/nrf_rpc_uart.h>
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CRC_SIZE sizeof(uint16_t)
+
+#if CONFIG_NRF_RPC_UART_BATCHING
+/* Batch frame payload: sequence number followed by length-prefixed packets */
+#define BATCH_SEQ_SIZE	  sizeof(uint8_t)
+#define BATCH_LEN_SIZE	  sizeof(uint16_t)
+#define BATCH_PAYLOAD_MAX (CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE - CRC_SIZE)
+#define BATCH_PKT_MAX	  (BATCH_PAYLOAD_MAX - BATCH_SEQ_SIZE - BATCH_LEN_SIZE)
+
+#if CONFIG_NRF_RPC_UART_RELIABLE
+#define TX_WINDOW CONFIG_NRF_RPC_UART_TX_WINDOW
+#else
+#define TX_WINDOW 1
+#endif
+
+/* Packet queued for the TX work, placed in front of the buffer handed to nRF RPC */
+struct tx_pkt {
+	void *fifo_reserved;
+	uint32_t enqueued;
+	uint16_t len;
+	uint8_t data[] __aligned(sizeof(void *));
+};
+
+/* Frame sent, but not acknowledged yet */
+struct tx_frame {
+	uint32_t sent;
+	uint16_t len;
+	uint8_t attempts;
+	uint8_t data[BATCH_PAYLOAD_MAX];
+};
+#endif /* CONFIG_NRF_RPC_UART_BATCHING */
+
+struct trx_flips {
+	uint8_t tx_flip : 1;
+	uint8_t rx_flip_any : 1;
+	uint16_t last_rx_crc;
+};
+
+enum hdlc_state {
+	/* Ignore incoming bytes until the delimiter is found. */
+	HDLC_STATE_UNSYNC,
+	/* Append incoming bytes to the output buffer. */
+	HDLC_STATE_FRAME,
+	/* Found the delimeter when the output buffer was non-empty. */
+	HDLC_STATE_FRAME_FOUND,
+	/* Found the escape byte. Append the following byte XORed with 0x20 to the output buffer. */
+	HDLC_STATE_ESCAPE,
+};
+
+struct hdlc_decode_ctx {
+	enum hdlc_state state;
+	/* The number of bytes of the current packet that have been decoded so far. */
+	uint16_t len;
+	/* The capacity of the buffer to store a decoded packet. */
+	uint16_t capacity;
+};
+
+struct nrf_rpc_uart {
+	const struct device *uart;
+	nrf_rpc_tr_receive_handler_t receive_callback;
+	void *receive_ctx;
+	const struct nrf_rpc_tr *transport;
+
+	/* RX ring buffer populated by UART ISR */
+	uint8_t rx_buffer[CONFIG_NRF_RPC_UART_RX_RINGBUF_SIZE];
+	struct ring_buf rx_ringbuf;
+
+	/* RX work to consume and decode bytes from RX ring buffer */
+	struct k_work rx_work;
+	struct k_work_q rx_workq;
+
+	K_KERNEL_STACK_MEMBER(rx_workq_stack, CONFIG_NRF_RPC_UART_RX_THREAD_STACK_SIZE);
+
+	/* HDLC ack decoding state */
+	struct hdlc_decode_ctx rx_ack_ctx;
+	uint8_t rx_ack[CRC_SIZE];
+
+	/* HDLC packet decoding state */
+	struct hdlc_decode_ctx rx_pkt_ctx;
+	uint8_t rx_pkt[CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE];
+
+	/* Ack waiting semaphore */
+	struct k_sem ack_sem;
+	uint16_t ack_payload;
+	struct k_mutex ack_tx_lock;
+	struct trx_flips flips;
+
+	/* TX lock */
+	struct k_mutex tx_lock;
+
+#if CONFIG_NRF_RPC_UART_BATCHING
+	/* TX work to aggregate queued packets into frames */
+	struct k_fifo tx_fifo;
+	struct k_work tx_work;
+	struct k_work_q tx_workq;
+
+	K_KERNEL_STACK_MEMBER(tx_workq_stack, CONFIG_NRF_RPC_UART_TX_THREAD_STACK_SIZE);
+
+	/* Given when a packet is queued or an ack is received */
+	struct k_sem tx_sem;
+
+	/* Window of unacknowledged frames, the oldest one at tx_head */
+	struct tx_frame tx_frames[TX_WINDOW];
+	uint8_t tx_head;
+	uint8_t tx_in_flight;
+	uint8_t tx_seq;
+
+	/* Latest sequence number acknowledged by the peer, set in ISR */
+	atomic_t tx_ack;
+
+	/* Next expected sequence number */
+	uint8_t rx_seq;
+	bool rx_seq_valid;
+	uint32_t rx_seq_errors;
+#endif
+
+#if CONFIG_NRF_RPC_UART_STATS
+	struct k_spinlock stats_lock;
+	struct nrf_rpc_uart_stats stats;
+#endif
+};
+
+extern const struct nrf_rpc_tr_api nrf_rpc_uart_service_api;
+
+#define NRF_RPC_UART_INSTANCE(node_id) _CONCAT(nrf_rpc_inst_, DT_DEP_ORD(node_id))
+
+/* Defines the nRF RPC UART transport for the given UART node. The transport is defined for every
+ * enabled UARTE node, other UART nodes need to define it explicitly.
+ */
+#define NRF_RPC_UART_TRANSPORT_DEFINE(node_id)                                                     \
+	struct nrf_rpc_uart NRF_RPC_UART_INSTANCE(node_id) = {                                     \
+		.uart = DEVICE_DT_GET(node_id),                                                    \
+		.receive_callback = NULL,                                                          \
+		.transport = NULL,                                                                 \
+	};                                                                                         \
+	const struct nrf_rpc_tr NRF_RPC_UART_TRANSPORT(node_id) = {                                \
+		.api = &nrf_rpc_uart_service_api,                                                  \
+		.ctx = &NRF_RPC_UART_INSTANCE(node_id),                                            \
+	};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_RPC_UART_INTERNAL_H_ */
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <mbedtls/platform_util.h>
+
+#include "aead_cache.h"
+#include "aead_key.h"
+
+/*
+ * Cache of decrypted objects and their AEAD keys.
+ *
+ * The plaintext and the key of an object are kept in RAM until the object is
+ * evicted or removed, and the entry is zeroized when that happens. The UID 0
+ * is invalid in the trusted storage, and marks an unused entry.
+ */
+
+#define CACHE_ENTRIES CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE_ENTRIES
+
+struct cache_entry {
+	psa_storage_uid_t uid;
+	const char *prefix;
+	uint32_t last_used;
+	psa_storage_create_flags_t create_flags;
+	size_t data_size;
+	uint8_t key[AEAD_KEY_SIZE];
+	uint8_t data[CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE];
+};
+
+static struct cache_entry cache[CACHE_ENTRIES];
+static uint32_t cache_clock;
+static K_MUTEX_DEFINE(cache_lock);
+
+static struct cache_entry *entry_find(psa_storage_uid_t uid, const char *prefix)
+{
+	for (size_t i = 0; i < CACHE_ENTRIES; i++) {
+		if (cache[i].uid == uid && strcmp(cache[i].prefix, prefix) == 0) {
+			return &cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct cache_entry *entry_alloc(void)
+{
+	struct cache_entry *oldest = &cache[0];
+
+	for (size_t i = 0; i < CACHE_ENTRIES; i++) {
+		if (cache[i].uid == 0) {
+			return &cache[i];
+		}
+
+		if (cache[i].last_used - oldest->last_used > UINT32_MAX / 2) {
+			oldest = &cache[i];
+		}
+	}
+
+	mbedtls_platform_zeroize(oldest, sizeof(*oldest));
+
+	return oldest;
+}
+
+psa_status_t trusted_storage_cache_get(psa_storage_uid_t uid, const char *prefix,
+				       size_t data_offset, size_t data_length, void *p_data,
+				       size_t *p_data_length)
+{
+	psa_status_t status = PSA_SUCCESS;
+	struct cache_entry *entry;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	entry = entry_find(uid, prefix);
+	if (!entry) {
+		status = PSA_ERROR_DOES_NOT_EXIST;
+		goto unlock;
+	}
+
+	entry->last_used = ++cache_clock;
+
+	if (data_offset > entry->data_size) {
+		*p_data_length = 0;
+		status = PSA_ERROR_INVALID_ARGUMENT;
+		goto unlock;
+	}
+
+	*p_data_length = MIN(data_length, entry->data_size - data_offset);
+	memcpy(p_data, entry->data + data_offset, *p_data_length);
+
+unlock:
+	k_mutex_unlock(&cache_lock);
+
+	return status;
+}
+
+psa_status_t trusted_storage_cache_get_info(psa_storage_uid_t uid, const char *prefix,
+					    struct psa_storage_info_t *p_info)
+{
+	psa_status_t status = PSA_ERROR_DOES_NOT_EXIST;
+	struct cache_entry *entry;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	entry = entry_find(uid, prefix);
+	if (entry) {
+		p_info->capacity = entry->data_size;
+		p_info->size = entry->data_size;
+		p_info->flags = entry->create_flags;
+		status = PSA_SUCCESS;
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return status;
+}
+
+psa_status_t trusted_storage_cache_get_key(psa_storage_uid_t uid, uint8_t *key_buf,
+					   size_t key_length)
+{
+	psa_status_t status = PSA_ERROR_DOES_NOT_EXIST;
+
+	if (key_length < AEAD_KEY_SIZE) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	/* The key only depends on the UID, not on the storage prefix. */
+	for (size_t i = 0; i < CACHE_ENTRIES; i++) {
+		if (cache[i].uid == uid) {
+			memcpy(key_buf, cache[i].key, AEAD_KEY_SIZE);
+			status = PSA_SUCCESS;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return status;
+}
+
+void trusted_storage_cache_put(psa_storage_uid_t uid, const char *prefix, const uint8_t *key_buf,
+			       psa_storage_create_flags_t create_flags, const void *p_data,
+			       size_t data_size)
+{
+	struct cache_entry *entry;
+
+	if (uid == 0 || data_size > sizeof(entry->data)) {
+		return;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	entry = entry_find(uid, prefix);
+	if (entry) {
+		mbedtls_platform_zeroize(entry, sizeof(*entry));
+	} else {
+		entry = entry_alloc();
+	}
+
+	entry->uid = uid;
+	entry->prefix = prefix;
+	entry->last_used = ++cache_clock;
+	entry->create_flags = create_flags;
+	entry->data_size = data_size;
+	memcpy(entry->key, key_buf, AEAD_KEY_SIZE);
+	if (data_size > 0) {
+		memcpy(entry->data, p_data, data_size);
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+void trusted_storage_cache_remove(psa_storage_uid_t uid, const char *prefix)
+{
+	struct cache_entry *entry;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	entry = entry_find(uid, prefix);
+	if (entry) {
+		mbedtls_platform_zeroize(entry, sizeof(*entry));
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef __TRUSTED_STORAGE_AEAD_CACHE_H_
+#define __TRUSTED_STORAGE_AEAD_CACHE_H_
+
+#include <psa/error.h>
+#include <psa/storage_common.h>
+
+/* Copies up to data_length bytes from data_offset of a cached object.
+ * Returns PSA_ERROR_DOES_NOT_EXIST if the object is not cached.
+ */
+psa_status_t trusted_storage_cache_get(psa_storage_uid_t uid, const char *prefix,
+				       size_t data_offset, size_t data_length, void *p_data,
+				       size_t *p_data_length);
+
+/* Gets the size and flags of a cached object */
+psa_status_t trusted_storage_cache_get_info(psa_storage_uid_t uid, const char *prefix,
+					    struct psa_storage_info_t *p_info);
+
+/* Gets the AEAD key of a cached object with the given UID */
+psa_status_t trusted_storage_cache_get_key(psa_storage_uid_t uid, uint8_t *key_buf,
+					   size_t key_length);
+
+/* Adds or replaces a decrypted object and its AEAD key, evicting the least recently used object */
+void trusted_storage_cache_put(psa_storage_uid_t uid, const char *prefix, const uint8_t *key_buf,
+			       psa_storage_create_flags_t create_flags, const void *p_data,
+			       size_t data_size);
+
+/* Removes an object from the cache */
+void trusted_storage_cache_remove(psa_storage_uid_t uid, const char *prefix);
+
+#endif /* __TRUSTED_STORAGE_AEAD_CACHE_H_ */
@@ -16,6 +16,7 @@ LOG_MODULE_REGISTER(internal_trusted_aead, CONFIG_TRUSTED_STORAGE_LOG_LEVEL);
 #include "aead_key.h"
 #include "aead_nonce.h"
 #include "aead_crypt.h"
+#include "aead_cache.h"
 
 /*
  * AEAD based Authenticated Encrypted trust implementation
@@ -47,11 +48,38 @@ typedef struct stored_object {
 	uint8_t data[AEAD_MAX_BUF_SIZE];
 } stored_object;
 
+/* Gets the AEAD key of an object, from the cache if possible. */
+static psa_status_t aead_key_get(const psa_storage_uid_t uid, uint8_t *key_buf)
+{
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE) &&
+	    trusted_storage_cache_get_key(uid, key_buf, AEAD_KEY_SIZE) == PSA_SUCCESS) {
+		return PSA_SUCCESS;
+	}
+
+	return trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+}
+
+/* Gets the header of a stored object, from the cache if possible. */
+static psa_status_t object_header_get(const psa_storage_uid_t uid, const char *prefix,
+				      stored_object_header *header)
+{
+	struct psa_storage_info_t info;
+	size_t out_length;
+
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE) &&
+	    trusted_storage_cache_get_info(uid, prefix, &info) == PSA_SUCCESS) {
+		header->create_flags = info.flags;
+		header->data_size = info.size;
+		return PSA_SUCCESS;
+	}
+
+	return storage_get_object(uid, prefix, (void *)header, sizeof(*header), &out_length);
+}
+
 psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 			      struct psa_storage_info_t *p_info)
 {
 	psa_status_t status;
-	size_t out_length;
 	stored_object_header header;
 
 	if (p_info == NULL || uid == INVALID_UID) {
@@ -59,7 +87,7 @@ psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 	}
 
 	/* Get size & flags */
-	status = storage_get_object(uid, prefix, (void *)&header, sizeof(header), &out_length);
+	status = object_header_get(uid, prefix, &header);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
@@ -92,8 +120,16 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE)) {
+		status = trusted_storage_cache_get(uid, prefix, data_offset, data_length, p_data,
+						   p_data_length);
+		if (status != PSA_ERROR_DOES_NOT_EXIST) {
+			return status;
+		}
+	}
+
 	/* Get AEAD key */
-	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+	status = aead_key_get(uid, key_buf);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
@@ -115,6 +151,11 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 		goto clean_up;
 	}
 
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE)) {
+		trusted_storage_cache_put(uid, prefix, key_buf, object_data.header.create_flags,
+					  object_data.data, out_length);
+	}
+
 	if (data_offset > out_length) {
 		*p_data_length = 0;
 		status = PSA_ERROR_INVALID_ARGUMENT;
@@ -159,8 +200,7 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 	}
 
 	/* Get flags */
-	status = storage_get_object(uid, prefix, (void *)&object_data.header,
-				    sizeof(object_data.header), &out_length);
+	status = object_header_get(uid, prefix, &object_data.header);
 
 	if (status != PSA_SUCCESS && status != PSA_ERROR_DOES_NOT_EXIST) {
 		return status;
@@ -173,7 +213,7 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 	}
 
 	/* Get AEAD key */
-	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+	status = aead_key_get(uid, key_buf);
 	if (status != PSA_SUCCESS) {
 		goto cleanup_objects;
 	}
@@ -192,8 +232,6 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 					      sizeof(object_data.header), p_data, data_length,
 					      object_data.data, AEAD_MAX_BUF_SIZE, &out_length);
 
-	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
-
 	if (status != PSA_SUCCESS) {
 		goto cleanup;
 	}
@@ -205,6 +243,11 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 		goto cleanup_objects;
 	}
 
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE)) {
+		trusted_storage_cache_put(uid, prefix, key_buf, create_flags, p_data,
+					  data_length);
+	}
+
 	goto cleanup;
 
 cleanup_objects:
@@ -212,7 +255,12 @@ cleanup_objects:
 	LOG_DBG("trusted_set cleanup. status %d", status);
 	storage_remove_object(uid, prefix);
 
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE)) {
+		trusted_storage_cache_remove(uid, prefix);
+	}
+
 cleanup:
+	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
 	mbedtls_platform_zeroize(&object_data, sizeof(object_data));
 
 	return status;
@@ -221,7 +269,6 @@ cleanup:
 psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 {
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-	size_t out_length;
 	stored_object_header header;
 
 	if (uid == INVALID_UID) {
@@ -229,7 +276,7 @@ psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 	}
 
 	/* Get flags */
-	status = storage_get_object(uid, prefix, (void *)&header, sizeof(header), &out_length);
+	status = object_header_get(uid, prefix, &header);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
@@ -238,6 +285,10 @@ psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 		return PSA_ERROR_NOT_PERMITTED;
 	}
 
+	if (IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE)) {
+		trusted_storage_cache_remove(uid, prefix);
+	}
+
 	return storage_remove_object(uid, prefix);
 }
 
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+
+#define PRODUCER_CNT		4
+#define PRODUCER_PRIORITY	K_PRIO_COOP(2)
+#define PRODUCER_STACK_SIZE	1024
+#define PRODUCER_BURST		16
+#define EVENTS_PER_PRODUCER	(PRODUCER_BURST * 32)
+#define HP_EVENT_CNT		64
+#define HP_EVENT_PERIOD		K_USEC(500)
+
+struct bench_event {
+	struct app_event_header header;
+
+	uint32_t timestamp;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_event);
+APP_EVENT_TYPE_DEFINE(bench_event,
+		      NULL,
+		      NULL,
+		      APP_EVENT_FLAGS_CREATE());
+
+struct bench_hp_event {
+	struct app_event_header header;
+
+	uint32_t timestamp;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_hp_event);
+APP_EVENT_TYPE_DEFINE(bench_hp_event,
+		      NULL,
+		      NULL,
+		      APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY));
+
+struct latency_stats {
+	uint32_t cnt;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+};
+
+static struct latency_stats normal_stats;
+static struct latency_stats hp_stats;
+static struct latency_stats submit_stats;
+static struct k_spinlock submit_stats_lock;
+
+static K_SEM_DEFINE(bench_done_sem, 0, 1);
+static K_THREAD_STACK_ARRAY_DEFINE(producer_stacks, PRODUCER_CNT, PRODUCER_STACK_SIZE);
+static struct k_thread producer_threads[PRODUCER_CNT];
+static atomic_t hp_submitted;
+
+
+static void stats_reset(struct latency_stats *stats)
+{
+	stats->cnt = 0;
+	stats->min = UINT32_MAX;
+	stats->max = 0;
+	stats->sum = 0;
+}
+
+static void stats_update(struct latency_stats *stats, uint32_t cycles)
+{
+	stats->cnt++;
+	stats->min = MIN(stats->min, cycles);
+	stats->max = MAX(stats->max, cycles);
+	stats->sum += cycles;
+}
+
+static void stats_print(const char *name, const struct latency_stats *stats)
+{
+	if (stats->cnt == 0) {
+		TC_PRINT("%s: no samples\n", name);
+		return;
+	}
+
+	TC_PRINT("%s: cnt %u, min %llu ns, avg %llu ns, max %llu ns\n", name, stats->cnt,
+		 k_cyc_to_ns_floor64(stats->min),
+		 k_cyc_to_ns_floor64(stats->sum / stats->cnt),
+		 k_cyc_to_ns_floor64(stats->max));
+}
+
+static void bench_submit(struct app_event_header *aeh)
+{
+	uint32_t start = k_cycle_get_32();
+
+	_event_submit(aeh);
+
+	uint32_t cycles = k_cycle_get_32() - start;
+	k_spinlock_key_t key = k_spin_lock(&submit_stats_lock);
+
+	stats_update(&submit_stats, cycles);
+	k_spin_unlock(&submit_stats_lock, key);
+}
+
+static void hp_timer_handler(struct k_timer *timer)
+{
+	struct bench_hp_event *event = new_bench_hp_event();
+
+	event->timestamp = k_cycle_get_32();
+	bench_submit(&event->header);
+
+	if (atomic_inc(&hp_submitted) + 1 >= HP_EVENT_CNT) {
+		k_timer_stop(timer);
+	}
+}
+
+static K_TIMER_DEFINE(hp_timer, hp_timer_handler, NULL);
+
+static void producer_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (size_t i = 0; i < EVENTS_PER_PRODUCER; i++) {
+		struct bench_event *event = new_bench_event();
+
+		event->timestamp = k_cycle_get_32();
+		bench_submit(&event->header);
+
+		/* Let the events pile up in the queue before yielding to the processing. */
+		if ((i % PRODUCER_BURST) == (PRODUCER_BURST - 1)) {
+			k_sleep(K_USEC(100));
+		}
+	}
+}
+
+static bool bench_done(void)
+{
+	return (normal_stats.cnt == (PRODUCER_CNT * EVENTS_PER_PRODUCER)) &&
+	       (hp_stats.cnt == HP_EVENT_CNT);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_bench_event(aeh)) {
+		const struct bench_event *event = cast_bench_event(aeh);
+
+		stats_update(&normal_stats, k_cycle_get_32() - event->timestamp);
+	} else if (is_bench_hp_event(aeh)) {
+		const struct bench_hp_event *event = cast_bench_hp_event(aeh);
+
+		stats_update(&hp_stats, k_cycle_get_32() - event->timestamp);
+	} else {
+		zassert_true(false, "Event unhandled");
+	}
+
+	if (bench_done()) {
+		k_sem_give(&bench_done_sem);
+	}
+
+	return false;
+}
+
+APP_EVENT_LISTENER(bench, app_event_handler);
+APP_EVENT_SUBSCRIBE(bench, bench_event);
+APP_EVENT_SUBSCRIBE(bench, bench_hp_event);
+
+static void *bench_setup(void)
+{
+	zassert_ok(app_event_manager_init(), "Error when initializing");
+
+	return NULL;
+}
+
+ZTEST(app_event_manager_latency, test_submit_to_handler_latency)
+{
+	stats_reset(&normal_stats);
+	stats_reset(&hp_stats);
+	stats_reset(&submit_stats);
+	atomic_set(&hp_submitted, 0);
+
+	uint32_t start = k_cycle_get_32();
+
+	for (size_t i = 0; i < PRODUCER_CNT; i++) {
+		k_thread_create(&producer_threads[i], producer_stacks[i],
+				K_THREAD_STACK_SIZEOF(producer_stacks[i]),
+				producer_fn, NULL, NULL, NULL,
+				PRODUCER_PRIORITY, 0, K_NO_WAIT);
+	}
+
+	k_timer_start(&hp_timer, HP_EVENT_PERIOD, HP_EVENT_PERIOD);
+
+	zassert_ok(k_sem_take(&bench_done_sem, K_SECONDS(30)), "Benchmark timed out");
+
+	uint32_t total = k_cycle_get_32() - start;
+
+	for (size_t i = 0; i < PRODUCER_CNT; i++) {
+		k_thread_join(&producer_threads[i], K_FOREVER);
+	}
+
+	TC_PRINT("Queue backend: %s, processing: %s\n",
+		 IS_ENABLED(CONFIG_APP_EVENT_MANAGER_QUEUE_MPSC) ? "mpsc" : "slist",
+		 IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROCESSING_THREAD) ?
+			"dedicated thread" : "system workqueue");
+	stats_print("Submit", &submit_stats);
+	stats_print("Normal priority latency", &normal_stats);
+	stats_print("High priority latency", &hp_stats);
+	TC_PRINT("Total time: %llu us\n", k_cyc_to_us_floor64(total));
+}
+
+ZTEST_SUITE(app_event_manager_latency, NULL, bench_setup, NULL, NULL, NULL);
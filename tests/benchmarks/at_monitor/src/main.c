@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <modem/at_monitor.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#define ROUNDS	   200
+#define BURST_SIZE 16
+
+/* Implemented in the AT monitor library */
+extern void at_monitor_dispatch(const char *notif);
+
+/* The Modem library is not linked */
+int nrf_modem_at_notif_handler_set(void (*callback)(const char *notif))
+{
+	ARG_UNUSED(callback);
+
+	return 0;
+}
+
+#define MONITOR_FILTERS                                                                            \
+	"+CEREG", "+CSCON", "%XMODEMSLEEP", "%NCELLMEAS", "+CGEV", "%CESQ", "%XT3412", "%MDMEV",   \
+	"+CEDRXP", "%XVBATLOWLVL", "%XSIM", "+CMT", "+CDS", "+CMS ERROR", "%XTIME",               \
+	"+CNEC_ESM", "%XPOFWARN", "%CONEVAL", "#XCUSTOM0", "#XCUSTOM1", "#XCUSTOM2", "#XCUSTOM3",  \
+	"#XCUSTOM4", "#XCUSTOM5", "#XCUSTOM6", "#XCUSTOM7", "#XCUSTOM8", "#XCUSTOM9",             \
+	"#XAPP_STATE", "#XAPP_EVENT", "%XDATAPRFL", "%XMODEMUUID", "%XCOEX0", "%XRAI", "%XPTW",    \
+	"%XCONNSTAT", "%XSYSTEMMODE", "%XBANDLOCK", "%XEMPR"
+
+/* Receive the notifications in the ISR */
+#define MONITOR_ISR_FILTERS "+CEREG: 5", "+CSCON: 0", "%MDMEV: ME"
+
+static const char *const filters[] = { MONITOR_FILTERS };
+static const char *const filters_isr[] = { MONITOR_ISR_FILTERS };
+
+static uint32_t calls[ARRAY_SIZE(filters)];
+static uint32_t calls_isr[ARRAY_SIZE(filters_isr)];
+
+#define MONITOR_DEFINE(idx, filter)                                                                \
+	AT_MONITOR(monitor_##idx, filter, monitor_handler_##idx);                                  \
+	static void monitor_handler_##idx(const char *notif)                                       \
+	{                                                                                          \
+		calls[idx]++;                                                                      \
+	}
+
+#define MONITOR_ISR_DEFINE(idx, filter)                                                            \
+	AT_MONITOR_ISR(monitor_isr_##idx, filter, monitor_isr_handler_##idx);                      \
+	static void monitor_isr_handler_##idx(const char *notif)                                   \
+	{                                                                                          \
+		calls_isr[idx]++;                                                                  \
+	}
+
+FOR_EACH_IDX(MONITOR_DEFINE, (), MONITOR_FILTERS)
+FOR_EACH_IDX(MONITOR_ISR_DEFINE, (), MONITOR_ISR_FILTERS)
+
+/* A burst of notifications as received after waking up from PSM */
+static const char *const notifs[] = {
+	"+CSCON: 1\r\n",
+	"+CEREG: 5,\"4E94\",\"0139C10A\",7,,,\"11100000\",\"11100000\"\r\n",
+	"%CESQ: 54,2,16,2\r\n",
+	"%MDMEV: SEARCH STATUS 2\r\n",
+	"+CGEV: ME PDN ACT 0\r\n",
+	"%XTIME: \"80\",\"52011231700280\",\"00\"\r\n",
+	"+CEDRXP: 4,\"1000\",\"0101\",\"1011\"\r\n",
+	"%XT3412: 1200000\r\n",
+	"#XCUSTOM7: 12,34\r\n",
+	"%NCELLMEAS: 0,\"0139C10A\",\"24201\",\"4E94\",65535,6400,110,51,20,10213,8,"
+	"6400,213,35,12,24,0\r\n",
+	"%XMODEMSLEEP: 1,36000\r\n",
+	"+CSCON: 0\r\n",
+	"%CONEVAL: 0,1,5,8,2,14,\"011B0780\",\"24202\",47,1300,3,0,0,0,1,1,1\r\n",
+	"#XAPP_EVENT: 3\r\n",
+	"%XVBATLOWLVL: 3100\r\n",
+	"+CMT: \"+1234567890\",22\r\n0791534850020290040C9153485002\r\n",
+};
+
+BUILD_ASSERT(ARRAY_SIZE(notifs) == BURST_SIZE);
+
+static void calls_verify(const char *const *filter_list, size_t filter_cnt, const uint32_t *cnt)
+{
+	for (size_t f = 0; f < filter_cnt; f++) {
+		uint32_t expected = 0;
+
+		for (size_t i = 0; i < ARRAY_SIZE(notifs); i++) {
+			expected += strstr(notifs[i], filter_list[f]) ? ROUNDS : 0;
+		}
+
+		zassert_equal(cnt[f], expected, "Monitor %s called %u times, expected %u",
+			      filter_list[f], cnt[f], expected);
+	}
+}
+
+static uint64_t dispatch_ns(const char *notif)
+{
+#if defined(CONFIG_EXTERNAL_LIBC)
+	struct timespec start;
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	at_monitor_dispatch(notif);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+#else
+	uint32_t start = k_cycle_get_32();
+
+	at_monitor_dispatch(notif);
+
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+#endif
+}
+
+ZTEST(at_monitor_benchmark, test_dispatch)
+{
+	uint64_t sum = 0;
+	uint64_t max = 0;
+
+	TC_PRINT("%zu monitors, %s matching\n", ARRAY_SIZE(filters) + ARRAY_SIZE(filters_isr),
+		 IS_ENABLED(CONFIG_AT_MONITOR_MATCHER) ? "compiled" : "linear");
+
+	for (int round = 0; round < ROUNDS; round++) {
+		for (size_t i = 0; i < ARRAY_SIZE(notifs); i++) {
+			uint64_t ns = dispatch_ns(notifs[i]);
+
+			sum += ns;
+			max = MAX(max, ns);
+		}
+
+		/* Let the system workqueue dispatch the burst */
+		k_sleep(K_MSEC(1));
+	}
+
+	calls_verify(filters, ARRAY_SIZE(filters), calls);
+	calls_verify(filters_isr, ARRAY_SIZE(filters_isr), calls_isr);
+
+	TC_PRINT("ISR time per notification: avg %u ns, max %u ns\n",
+		 (uint32_t)(sum / (ROUNDS * ARRAY_SIZE(notifs))), (uint32_t)max);
+}
+
+ZTEST_SUITE(at_monitor_benchmark, NULL, NULL, NULL, NULL, NULL);
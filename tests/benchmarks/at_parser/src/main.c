@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <modem/at_parser.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#define ROUNDS	   100
+#define TOKENS_MAX 128
+
+struct response {
+	const char *name;
+	const char *at;
+};
+
+/* Responses recorded from the modem, with the identifiers changed */
+static const struct response responses[] = {
+	{
+		.name = "XMONITOR",
+		.at = "%XMONITOR: 1,\"Operator\",\"OP\",\"24201\",\"4E94\",7,20,\"0139C10A\","
+		      "110,6400,51,20,\"\",\"11100000\",\"11100000\",\"01001001\"\r\n"
+		      "OK\r\n",
+	},
+	{
+		.name = "NCELLMEAS",
+		.at = "%NCELLMEAS: 0,\"0139C10A\",\"24201\",\"4E94\",65535,6400,110,51,20,10213,"
+		      "6400,213,35,12,24,6400,87,30,9,24,6400,301,22,4,24,1650,12,41,15,36,"
+		      "1650,404,38,11,36,1650,17,26,6,36,300,291,19,3,48,300,56,15,1,48,"
+		      "300,388,12,0,48,3750,110,33,10,52,3750,213,28,7,52,3750,87,21,3,52,"
+		      "6200,12,18,2,60,6200,404,14,1,60,6200,17,10,0,60,9610,291,31,9,71,"
+		      "9610,56,24,6,71,9610,388,17,2,71,100,111,9,0,83,100,198,6,0,83,8\r\n"
+		      "OK\r\n",
+	},
+	{
+		.name = "NCELLMEAS GCI",
+		.at = "%NCELLMEAS: 0,\"0139C10A\",\"24201\",\"4E94\",65535,6400,110,51,20,10213,"
+		      "6400,213,35,12,24,6400,87,30,9,24,6400,301,22,4,24,1650,12,41,15,36,1\r\n"
+		      "%NCELLMEAS: 0,\"0139C10B\",\"24201\",\"4E94\",65535,1650,404,38,11,12412,"
+		      "1650,17,26,6,24,300,291,19,3,36,300,56,15,1,36,300,388,12,0,36,0\r\n"
+		      "%NCELLMEAS: 0,\"0139D301\",\"24202\",\"4E95\",65535,3750,110,33,10,13106,"
+		      "3750,213,28,7,24,3750,87,21,3,24,6200,12,18,2,48,6200,404,14,1,48,0\r\n"
+		      "%NCELLMEAS: 0,\"0139D302\",\"24202\",\"4E95\",65535,9610,291,31,9,14220,"
+		      "9610,56,24,6,24,9610,388,17,2,24,100,111,9,0,60,100,198,6,0,60,0\r\n"
+		      "OK\r\n",
+	},
+};
+
+static struct at_parser_token tokens[TOKENS_MAX];
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+typedef struct timespec timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now;
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	struct timespec end = timestamp();
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+}
+#else
+typedef uint32_t timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	return k_cycle_get_32();
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+}
+#endif
+
+/* Read every value of every line, the way a response handler does, and fold them into a
+ * checksum.
+ */
+static uint32_t response_read(struct at_parser *parser, size_t *values)
+{
+	uint32_t checksum = 0;
+	int err;
+
+	do {
+		size_t count;
+
+		err = at_parser_cmd_count_get(parser, &count);
+		zassert_ok(err);
+
+		for (size_t i = 0; i < count; i++) {
+			const char *str;
+			size_t len;
+			int32_t num;
+
+			err = at_parser_num_get(parser, i, &num);
+			if (err == -EOPNOTSUPP) {
+				err = at_parser_string_ptr_get(parser, i, &str, &len);
+				zassert_ok(err, "Value %zu is neither a number nor a string", i);
+
+				num = len ? str[0] + str[len - 1] : 0;
+			} else if (err == -ENODATA) {
+				num = 0;
+			}
+
+			zassert_ok(err, "Failed to read value %zu, err %d", i, err);
+
+			checksum = checksum * 31 + (uint32_t)num;
+		}
+
+		*values += count;
+	} while (at_parser_cmd_next(parser) == 0);
+
+	return checksum;
+}
+
+ZTEST(at_parser_benchmark, test_read_all)
+{
+	for (size_t r = 0; r < ARRAY_SIZE(responses); r++) {
+		struct at_parser parser;
+		uint64_t ns_lazy = 0;
+		uint64_t ns_indexed = 0;
+		uint32_t checksum_lazy = 0;
+		uint32_t checksum_indexed = 0;
+		size_t values = 0;
+
+		for (int round = 0; round < ROUNDS; round++) {
+			timestamp_t start;
+
+			values = 0;
+			start = timestamp();
+			zassert_ok(at_parser_init(&parser, responses[r].at));
+			checksum_lazy = response_read(&parser, &values);
+			ns_lazy += elapsed_ns(start);
+
+			values = 0;
+			start = timestamp();
+			zassert_ok(at_parser_indexed_init(&parser, responses[r].at, tokens,
+							  ARRAY_SIZE(tokens)));
+			checksum_indexed = response_read(&parser, &values);
+			ns_indexed += elapsed_ns(start);
+		}
+
+		zassert_equal(checksum_lazy, checksum_indexed, "%s values differ",
+			      responses[r].name);
+
+		TC_PRINT("%-14s %3zu values: lazy %7u ns, indexed %6u ns\n", responses[r].name,
+			 values, (uint32_t)(ns_lazy / ROUNDS), (uint32_t)(ns_indexed / ROUNDS));
+	}
+}
+
+ZTEST(at_parser_benchmark, test_tokens_overflow)
+{
+	const struct response *response = &responses[1];
+	struct at_parser parser;
+	uint32_t checksum_lazy;
+	size_t values = 0;
+
+	zassert_ok(at_parser_init(&parser, response->at));
+	checksum_lazy = response_read(&parser, &values);
+
+	/* The values that do not fit in the array are read by tokenizing the line. */
+	for (size_t size = 1; size < values; size += 16) {
+		size_t values_indexed = 0;
+
+		zassert_ok(at_parser_indexed_init(&parser, response->at, tokens, size));
+		zassert_equal(response_read(&parser, &values_indexed), checksum_lazy,
+			      "Values differ with %zu tokens", size);
+		zassert_equal(values_indexed, values);
+	}
+}
+
+ZTEST_SUITE(at_parser_benchmark, NULL, NULL, NULL, NULL, NULL);
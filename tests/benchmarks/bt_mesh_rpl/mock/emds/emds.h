@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* The benchmark does not store the entries, so they are not placed in the
+ * EMDS entry section.
+ */
+
+#ifndef MOCK_EMDS_H_
+#define MOCK_EMDS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct emds_entry {
+	uint16_t id;
+	uint8_t *data;
+	size_t len;
+};
+
+#define EMDS_STATIC_ENTRY_DEFINE(_name, _id, _data, _len)                      \
+	static const struct emds_entry emds_##_name = {                        \
+		.id = _id,                                                     \
+		.data = (uint8_t *)_data,                                      \
+		.len = _len,                                                   \
+	}
+
+#endif /* MOCK_EMDS_H_ */
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* The parts of the mesh stack network layer used by the replay protection list. */
+
+#ifndef MOCK_MESH_NET_H_
+#define MOCK_MESH_NET_H_
+
+#include <stdint.h>
+#include <zephyr/bluetooth/mesh.h>
+
+enum bt_mesh_net_if {
+	BT_MESH_NET_IF_ADV,
+	BT_MESH_NET_IF_LOCAL,
+	BT_MESH_NET_IF_PROXY,
+	BT_MESH_NET_IF_PROXY_CFG,
+};
+
+struct bt_mesh_net_rx {
+	struct bt_mesh_subnet *sub;
+	struct bt_mesh_msg_ctx ctx;
+	uint32_t seq;
+	uint8_t old_iv:1,
+		new_key:1,
+		friend_cred:1,
+		ctl:1,
+		net_if:2,
+		local_match:1,
+		friend_match:1;
+};
+
+#endif /* MOCK_MESH_NET_H_ */
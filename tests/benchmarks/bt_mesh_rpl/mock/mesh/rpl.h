@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* The replay protection list interface of the mesh stack. */
+
+#ifndef MOCK_MESH_RPL_H_
+#define MOCK_MESH_RPL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct bt_mesh_net_rx;
+
+struct bt_mesh_rpl {
+	uint64_t src:15,
+		 old_iv:1,
+		 seq:24,
+		 seg:24;
+};
+
+void bt_mesh_rpl_reset(void);
+bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx, struct bt_mesh_rpl **match, bool bridge);
+void bt_mesh_rpl_clear(void);
+void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl, struct bt_mesh_net_rx *rx);
+void bt_mesh_rpl_pending_store(uint16_t addr);
+void bt_mesh_rpl_pending_store_all_nodes(void);
+
+#endif /* MOCK_MESH_RPL_H_ */
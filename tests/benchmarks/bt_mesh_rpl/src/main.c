@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <mesh/net.h>
+#include <mesh/rpl.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+/* The traffic is generated from a fixed seed, so every run and every lookup
+ * sees the same messages.
+ */
+#define TRAFFIC_SEED 0x5EED1234
+#define MSG_CNT 10000
+#define PASS_CNT 20
+
+/* Nodes with two elements, where only the primary element sends messages. */
+#define ADDR_STRIDE 2
+
+/* One in this many messages is a replay of the previous message from the node. */
+#define REPLAY_INTERVAL 8
+
+static const uint16_t source_cnts[] = {16, 64, 256, CONFIG_BT_MESH_CRPL};
+
+static uint32_t seq[CONFIG_BT_MESH_CRPL];
+static uint32_t rng_state;
+
+static uint32_t rng_next(void)
+{
+	/* xorshift32 */
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+
+	return rng_state;
+}
+
+static uint16_t source_addr_get(uint16_t source)
+{
+	return 1 + source * ADDR_STRIDE;
+}
+
+static bool msg_check(uint16_t source, bool old_iv)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = source_addr_get(source),
+		.seq = seq[source],
+		.old_iv = old_iv,
+		.net_if = BT_MESH_NET_IF_ADV,
+		.local_match = 1,
+	};
+
+	return bt_mesh_rpl_check(&rx, NULL, false);
+}
+
+/* Fill the list with the first message from every source, in random order. */
+static void sources_add(uint16_t cnt)
+{
+	bt_mesh_rpl_clear();
+
+	for (uint16_t i = 0; i < cnt; i++) {
+		seq[i] = 1;
+	}
+
+	for (uint16_t i = 0; i < cnt; i++) {
+		uint16_t source = (i * 7919U) % cnt;
+
+		zassert_false(msg_check(source, false), "First message from %u rejected", source);
+	}
+}
+
+static uint64_t traffic_run_ns(uint16_t cnt, uint32_t *replay_cnt)
+{
+#if defined(CONFIG_EXTERNAL_LIBC)
+	struct timespec start;
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+#else
+	uint32_t start = k_cycle_get_32();
+#endif
+
+	for (uint32_t i = 0; i < MSG_CNT; i++) {
+		uint16_t source = rng_next() % cnt;
+
+		/* The sequence number is only advanced for new messages. */
+		if (i % REPLAY_INTERVAL) {
+			seq[source]++;
+		}
+
+		if (msg_check(source, false)) {
+			(*replay_cnt)++;
+		}
+	}
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+#else
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+#endif
+}
+
+ZTEST(bt_mesh_rpl_benchmark, test_rx)
+{
+	TC_PRINT("%s lookup, %d messages, one in %d replayed\n",
+		 IS_ENABLED(CONFIG_BT_MESH_RPL_HASH) ? "hashed" : "linear", MSG_CNT,
+		 REPLAY_INTERVAL);
+
+	for (size_t i = 0; i < ARRAY_SIZE(source_cnts); i++) {
+		uint64_t min = UINT64_MAX;
+		uint64_t max = 0;
+		uint64_t sum = 0;
+
+		rng_state = TRAFFIC_SEED;
+		sources_add(source_cnts[i]);
+
+		for (size_t pass = 0; pass < PASS_CNT; pass++) {
+			uint32_t replay_cnt = 0;
+			uint64_t ns;
+
+			ns = traffic_run_ns(source_cnts[i], &replay_cnt) / MSG_CNT;
+
+			zassert_equal(replay_cnt, MSG_CNT / REPLAY_INTERVAL,
+				      "%u replays detected, expected %u", replay_cnt,
+				      MSG_CNT / REPLAY_INTERVAL);
+
+			min = MIN(min, ns);
+			max = MAX(max, ns);
+			sum += ns;
+		}
+
+		TC_PRINT("%4u sources: min %u, avg %u, max %u ns per message\n", source_cnts[i],
+			 (uint32_t)min, (uint32_t)(sum / PASS_CNT), (uint32_t)max);
+	}
+}
+
+ZTEST(bt_mesh_rpl_benchmark, test_iv_update)
+{
+	uint16_t last = CONFIG_BT_MESH_CRPL - 1;
+
+	sources_add(CONFIG_BT_MESH_CRPL);
+
+	/* All entries are flagged as old. A message on the new IV Index is
+	 * accepted once.
+	 */
+	bt_mesh_rpl_reset();
+	zassert_false(msg_check(last, false), "Message on the new IV Index rejected");
+	zassert_true(msg_check(last, false), "Replay accepted");
+
+	/* The other entries are removed, and the remaining entry is moved to
+	 * the start of the list and flagged as old.
+	 */
+	bt_mesh_rpl_reset();
+	zassert_true(msg_check(last, true), "Replay on the old IV Index accepted");
+	zassert_false(msg_check(0, false), "Message from a removed entry rejected");
+}
+
+ZTEST_SUITE(bt_mesh_rpl_benchmark, NULL, NULL, NULL, NULL, NULL);
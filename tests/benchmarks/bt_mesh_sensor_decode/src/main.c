@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <bluetooth/mesh/properties.h>
+#include <bluetooth/mesh/sensor_types.h>
+#include <sensor.h> /* private header from the source folder */
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+/* The messages are generated from a fixed seed, so every run decodes the
+ * same messages.
+ */
+#define MSG_SEED 0x5EED1234
+#define MSG_TEMPLATE_CNT 64
+#define MSG_CNT 10000
+#define PASS_CNT 20
+
+/* Large enough for the marshalled sensor data of all the properties. */
+#define MSG_MAXLEN 256
+
+/* Properties reported by the sensor nodes. */
+static const uint16_t props[] = {
+	BT_MESH_PROP_ID_DEV_OP_TEMP_STAT_VALUES,
+	BT_MESH_PROP_ID_MOTION_SENSED,
+	BT_MESH_PROP_ID_PEOPLE_COUNT,
+	BT_MESH_PROP_ID_PRESENCE_DETECTED,
+	BT_MESH_PROP_ID_PRESENT_AMB_LIGHT_LEVEL,
+	BT_MESH_PROP_ID_PRESENT_AMB_TEMP,
+	BT_MESH_PROP_ID_PRESENT_DEV_INPUT_POWER,
+	BT_MESH_PROP_ID_PRESENT_INPUT_CURRENT,
+	BT_MESH_PROP_ID_PRESENT_INPUT_VOLTAGE,
+	BT_MESH_PROP_ID_TOT_DEV_ENERGY_USE,
+	BT_MESH_PROP_ID_PRESENT_AMB_REL_HUMIDITY,
+	BT_MESH_PROP_ID_PRESENT_AMB_CO2_CONCENTRATION,
+	BT_MESH_PROP_ID_PRESENT_AMB_VOC_CONCENTRATION,
+	BT_MESH_PROP_ID_AIR_PRESSURE,
+};
+
+static const uint8_t props_per_msg[] = {1, 4, 10, ARRAY_SIZE(props)};
+
+static struct {
+	uint8_t data[MSG_MAXLEN];
+	uint8_t len;
+} msgs[MSG_TEMPLATE_CNT];
+
+static uint32_t rng_state;
+
+static uint32_t rng_next(void)
+{
+	/* xorshift32 */
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+
+	return rng_state;
+}
+
+/* Every message holds a random selection of the properties, in ascending
+ * order, with random sensor values.
+ */
+static void msgs_generate(uint8_t prop_cnt)
+{
+	for (size_t i = 0; i < MSG_TEMPLATE_CNT; i++) {
+		struct net_buf_simple buf;
+		uint8_t left = prop_cnt;
+
+		net_buf_simple_init_with_data(&buf, msgs[i].data, sizeof(msgs[i].data));
+		net_buf_simple_reset(&buf);
+
+		for (size_t j = 0; j < ARRAY_SIZE(props) && left; j++) {
+			const struct bt_mesh_sensor_type *type;
+			uint8_t len;
+
+			/* Pick the property with probability left / remaining. */
+			if (rng_next() % (ARRAY_SIZE(props) - j) >= left) {
+				continue;
+			}
+
+			type = bt_mesh_sensor_type_get(props[j]);
+			zassert_not_null(type, "Unknown property 0x%04x", props[j]);
+
+			len = sensor_value_len(type);
+			zassert_ok(sensor_status_id_encode(&buf, len, type->id));
+
+			for (uint8_t k = 0; k < len; k++) {
+				net_buf_simple_add_u8(&buf, rng_next());
+			}
+
+			left--;
+		}
+
+		msgs[i].len = buf.len;
+	}
+}
+
+/* Decodes a Sensor Status message the same way as the Sensor Client. */
+static uint32_t msg_decode(const uint8_t *data, uint8_t len)
+{
+	struct bt_mesh_sensor_value value[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+	struct net_buf_simple buf;
+	uint32_t count = 0;
+
+	net_buf_simple_init_with_data(&buf, (void *)data, len);
+
+	while (buf.len) {
+		const struct bt_mesh_sensor_type *type;
+		uint8_t length;
+		uint16_t id;
+
+		sensor_status_id_decode(&buf, &length, &id);
+		if (length == 0) {
+			continue;
+		}
+
+		type = bt_mesh_sensor_type_get(id);
+		if (!type || length != sensor_value_len(type) ||
+		    sensor_value_decode(&buf, type, value)) {
+			return 0;
+		}
+
+		count++;
+	}
+
+	return count;
+}
+
+static uint64_t msgs_decode_ns(uint32_t *prop_cnt)
+{
+#if defined(CONFIG_EXTERNAL_LIBC)
+	struct timespec start;
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+#else
+	uint32_t start = k_cycle_get_32();
+#endif
+
+	for (uint32_t i = 0; i < MSG_CNT; i++) {
+		uint32_t msg = i % MSG_TEMPLATE_CNT;
+
+		*prop_cnt += msg_decode(msgs[msg].data, msgs[msg].len);
+	}
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+#else
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+#endif
+}
+
+ZTEST(bt_mesh_sensor_decode_benchmark, test_status_decode)
+{
+	TC_PRINT("Type cache size %d, %d messages\n", CONFIG_BT_MESH_SENSOR_TYPE_CACHE_SIZE,
+		 MSG_CNT);
+
+	for (size_t i = 0; i < ARRAY_SIZE(props_per_msg); i++) {
+		uint64_t min = UINT64_MAX;
+		uint64_t max = 0;
+		uint64_t sum = 0;
+
+		rng_state = MSG_SEED;
+		msgs_generate(props_per_msg[i]);
+
+		for (size_t pass = 0; pass < PASS_CNT; pass++) {
+			uint32_t prop_cnt = 0;
+			uint64_t ns;
+
+			ns = msgs_decode_ns(&prop_cnt) / MSG_CNT;
+
+			zassert_equal(prop_cnt, MSG_CNT * props_per_msg[i],
+				      "%u properties decoded, expected %u", prop_cnt,
+				      MSG_CNT * props_per_msg[i]);
+
+			min = MIN(min, ns);
+			max = MAX(max, ns);
+			sum += ns;
+		}
+
+		TC_PRINT("%2u properties: min %u, avg %u, max %u ns, %u messages per second\n",
+			 props_per_msg[i], (uint32_t)min, (uint32_t)(sum / PASS_CNT),
+			 (uint32_t)max, (uint32_t)(NSEC_PER_SEC * PASS_CNT / MAX(1, sum)));
+	}
+}
+
+ZTEST(bt_mesh_sensor_decode_benchmark, test_type_get)
+{
+	/* Repeated lookups return the same type, also after a collision in
+	 * the cache.
+	 */
+	for (size_t pass = 0; pass < 2; pass++) {
+		for (size_t i = 0; i < ARRAY_SIZE(props); i++) {
+			const struct bt_mesh_sensor_type *type = bt_mesh_sensor_type_get(props[i]);
+
+			zassert_not_null(type, "Unknown property 0x%04x", props[i]);
+			zassert_equal(type->id, props[i], "Wrong type for 0x%04x", props[i]);
+		}
+	}
+
+	zassert_is_null(bt_mesh_sensor_type_get(BT_MESH_PROP_ID_PROHIBITED));
+	zassert_is_null(bt_mesh_sensor_type_get(0xffff));
+}
+
+ZTEST_SUITE(bt_mesh_sensor_decode_benchmark, NULL, NULL, NULL, NULL, NULL);
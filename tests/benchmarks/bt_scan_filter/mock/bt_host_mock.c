@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "bt_host_mock.h"
+
+/* Bluetooth Base UUID 00000000-0000-1000-8000-00805F9B34FB in little endian. */
+static const uint8_t uuid_base[16] = {
+	0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static struct bt_le_scan_cb *scan_cb;
+
+struct bt_le_scan_cb *bt_host_mock_scan_cb_get(void)
+{
+	return scan_cb;
+}
+
+int bt_le_scan_cb_register(struct bt_le_scan_cb *cb)
+{
+	scan_cb = cb;
+
+	return 0;
+}
+
+int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
+{
+	return 0;
+}
+
+int bt_le_scan_stop(void)
+{
+	return 0;
+}
+
+void bt_data_parse(struct net_buf_simple *ad,
+		   bool (*func)(struct bt_data *data, void *user_data),
+		   void *user_data)
+{
+	while (ad->len > 1) {
+		struct bt_data data;
+		uint8_t len = net_buf_simple_pull_u8(ad);
+
+		if ((len == 0) || (len > ad->len)) {
+			return;
+		}
+
+		data.type = net_buf_simple_pull_u8(ad);
+		data.data_len = len - 1;
+		data.data = ad->data;
+
+		if (!func(&data, user_data)) {
+			return;
+		}
+
+		net_buf_simple_pull(ad, len - 1);
+	}
+}
+
+static void uuid_to_128(const struct bt_uuid *uuid, uint8_t val[16])
+{
+	memcpy(val, uuid_base, sizeof(uuid_base));
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		sys_put_le16(BT_UUID_16(uuid)->val, &val[12]);
+		break;
+
+	case BT_UUID_TYPE_32:
+		sys_put_le32(BT_UUID_32(uuid)->val, &val[12]);
+		break;
+
+	case BT_UUID_TYPE_128:
+		memcpy(val, BT_UUID_128(uuid)->val, 16);
+		break;
+	}
+}
+
+int bt_uuid_cmp(const struct bt_uuid *u1, const struct bt_uuid *u2)
+{
+	uint8_t val1[16];
+	uint8_t val2[16];
+
+	uuid_to_128(u1, val1);
+	uuid_to_128(u2, val2);
+
+	return memcmp(val1, val2, sizeof(val1));
+}
+
+bool bt_uuid_create(struct bt_uuid *uuid, const uint8_t *data, uint8_t data_len)
+{
+	switch (data_len) {
+	case BT_UUID_SIZE_16:
+		uuid->type = BT_UUID_TYPE_16;
+		BT_UUID_16(uuid)->val = sys_get_le16(data);
+		return true;
+
+	case BT_UUID_SIZE_32:
+		uuid->type = BT_UUID_TYPE_32;
+		BT_UUID_32(uuid)->val = sys_get_le32(data);
+		return true;
+
+	case BT_UUID_SIZE_128:
+		uuid->type = BT_UUID_TYPE_128;
+		memcpy(BT_UUID_128(uuid)->val, data, BT_UUID_SIZE_128);
+		return true;
+
+	default:
+		return false;
+	}
+}
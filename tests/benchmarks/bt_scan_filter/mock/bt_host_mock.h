@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BT_HOST_MOCK_H_
+#define BT_HOST_MOCK_H_
+
+#include <zephyr/bluetooth/bluetooth.h>
+
+/** Get the scan callback registered by the scan library. */
+struct bt_le_scan_cb *bt_host_mock_scan_cb_get(void);
+
+#endif /* BT_HOST_MOCK_H_ */
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "adv_trace.h"
+
+/* The trace reproduces the mix of advertisers observed in a dense deployment:
+ * asset tags, iBeacons, Eddystone beacons and phones. It is generated from a
+ * fixed seed, so every run and every filter engine sees the same reports.
+ */
+#define TRACE_SEED 0x5EED1234
+
+#define TAG_NAME_LEN 9
+#define FLEET_UUID_BASE 0xF000
+
+enum device_kind {
+	DEVICE_TAG,
+	DEVICE_IBEACON,
+	DEVICE_EDDYSTONE,
+	DEVICE_PHONE,
+	DEVICE_KIND_CNT,
+};
+
+static bt_addr_le_t device_addr[ADV_TRACE_DEVICE_CNT];
+static char tag_name[ADV_TRACE_TAG_CNT][TAG_NAME_LEN + 1];
+static struct adv_trace_report reports[ADV_TRACE_REPORT_CNT];
+static uint32_t rng_state;
+
+static uint32_t rng_next(void)
+{
+	/* xorshift32 */
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+
+	return rng_state;
+}
+
+static uint8_t ad_put(uint8_t *buf, uint8_t len, uint8_t type, const void *data,
+		      uint8_t data_len)
+{
+	buf[len++] = data_len + 1;
+	buf[len++] = type;
+	memcpy(&buf[len], data, data_len);
+
+	return len + data_len;
+}
+
+static uint8_t ad_flags_put(uint8_t *buf, uint8_t len)
+{
+	uint8_t flags = BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR;
+
+	return ad_put(buf, len, BT_DATA_FLAGS, &flags, sizeof(flags));
+}
+
+static void tag_report_build(struct adv_trace_report *report, uint16_t tag)
+{
+	uint8_t uuids[2 * BT_UUID_SIZE_16];
+
+	sys_put_le16(BT_UUID_BAS_VAL, &uuids[0]);
+	sys_put_le16(adv_trace_tag_uuid_get(tag), &uuids[BT_UUID_SIZE_16]);
+
+	report->adv_props = BT_GAP_ADV_PROP_CONNECTABLE | BT_GAP_ADV_PROP_SCANNABLE;
+	report->len = ad_flags_put(report->data, 0);
+	report->len = ad_put(report->data, report->len, BT_DATA_UUID16_ALL, uuids,
+			     sizeof(uuids));
+	report->len = ad_put(report->data, report->len, BT_DATA_NAME_COMPLETE,
+			     tag_name[tag], TAG_NAME_LEN);
+}
+
+static void ibeacon_report_build(struct adv_trace_report *report, uint16_t device)
+{
+	uint8_t data[25] = {0x4C, 0x00, 0x02, 0x15};
+
+	/* Proximity UUID shared by the whole deployment, major and minor per beacon. */
+	memset(&data[4], 0xA5, 16);
+	sys_put_be16(device / 16, &data[20]);
+	sys_put_be16(device, &data[22]);
+	data[24] = 0xC5;
+
+	report->adv_props = 0;
+	report->len = ad_flags_put(report->data, 0);
+	report->len = ad_put(report->data, report->len, BT_DATA_MANUFACTURER_DATA, data,
+			     sizeof(data));
+}
+
+static void eddystone_report_build(struct adv_trace_report *report, uint16_t device)
+{
+	uint8_t uuid[BT_UUID_SIZE_16];
+	uint8_t svc_data[] = {0xAA, 0xFE, 0x10, 0xF8, 0x03, 'n', 'o', 'r', 'd', 'i', 'c',
+			      0x07, (uint8_t)device};
+
+	sys_put_le16(0xFEAA, uuid);
+
+	report->adv_props = 0;
+	report->len = ad_flags_put(report->data, 0);
+	report->len = ad_put(report->data, report->len, BT_DATA_UUID16_ALL, uuid,
+			     sizeof(uuid));
+	report->len = ad_put(report->data, report->len, BT_DATA_SVC_DATA16, svc_data,
+			     sizeof(svc_data));
+}
+
+static void phone_report_build(struct adv_trace_report *report, uint16_t device)
+{
+	uint8_t uuids[2 * BT_UUID_SIZE_16];
+	uint8_t data[] = {0x06, 0x00, 0x01, 0x09, 0x20, (uint8_t)device};
+
+	sys_put_le16(0xFE9F, &uuids[0]);
+	sys_put_le16(0xFD6F, &uuids[BT_UUID_SIZE_16]);
+
+	report->adv_props = BT_GAP_ADV_PROP_CONNECTABLE | BT_GAP_ADV_PROP_SCANNABLE;
+	report->len = ad_flags_put(report->data, 0);
+	report->len = ad_put(report->data, report->len, BT_DATA_UUID16_SOME, uuids,
+			     sizeof(uuids));
+	report->len = ad_put(report->data, report->len, BT_DATA_MANUFACTURER_DATA, data,
+			     sizeof(data));
+	report->len = ad_put(report->data, report->len, BT_DATA_NAME_SHORTENED, "Phone", 5);
+}
+
+void adv_trace_init(void)
+{
+	rng_state = TRACE_SEED;
+
+	for (size_t i = 0; i < ARRAY_SIZE(device_addr); i++) {
+		uint32_t rand = rng_next();
+
+		device_addr[i].type = BT_ADDR_LE_RANDOM;
+		sys_put_le32(rand, &device_addr[i].a.val[0]);
+		sys_put_le16(rng_next(), &device_addr[i].a.val[4]);
+		BT_ADDR_SET_STATIC(&device_addr[i].a);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(tag_name); i++) {
+		snprintf(tag_name[i], sizeof(tag_name[i]), "TAG-%05u", (unsigned int)i);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(reports); i++) {
+		struct adv_trace_report *report = &reports[i];
+		uint16_t device = rng_next() % ADV_TRACE_DEVICE_CNT;
+
+		report->device = device;
+
+		switch (device % DEVICE_KIND_CNT) {
+		case DEVICE_TAG:
+			tag_report_build(report, device / DEVICE_KIND_CNT);
+			break;
+		case DEVICE_IBEACON:
+			ibeacon_report_build(report, device);
+			break;
+		case DEVICE_EDDYSTONE:
+			eddystone_report_build(report, device);
+			break;
+		default:
+			phone_report_build(report, device);
+			break;
+		}
+	}
+}
+
+const struct adv_trace_report *adv_trace_reports_get(void)
+{
+	return reports;
+}
+
+const bt_addr_le_t *adv_trace_addr_get(uint16_t device)
+{
+	return &device_addr[device];
+}
+
+const char *adv_trace_tag_name_get(uint16_t tag)
+{
+	return tag_name[tag];
+}
+
+uint16_t adv_trace_tag_uuid_get(uint16_t tag)
+{
+	return FLEET_UUID_BASE + tag;
+}
+
+uint16_t adv_trace_tag_device_get(uint16_t tag)
+{
+	return tag * DEVICE_KIND_CNT;
+}
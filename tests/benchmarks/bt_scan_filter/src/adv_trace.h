@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef ADV_TRACE_H_
+#define ADV_TRACE_H_
+
+#include <zephyr/bluetooth/bluetooth.h>
+
+/* Number of advertising devices in the trace. */
+#define ADV_TRACE_DEVICE_CNT 1024
+
+/* Number of advertising reports in the trace. */
+#define ADV_TRACE_REPORT_CNT 2048
+
+/* Asset tags advertise their name and a fleet UUID, every fourth device is a tag. */
+#define ADV_TRACE_TAG_CNT (ADV_TRACE_DEVICE_CNT / 4)
+
+struct adv_trace_report {
+	/* Index of the advertising device. */
+	uint16_t device;
+
+	/* Advertising properties. */
+	uint8_t adv_props;
+
+	/* Advertising data length. */
+	uint8_t len;
+
+	/* Advertising data. */
+	uint8_t data[BT_GAP_ADV_MAX_ADV_DATA_LEN];
+};
+
+/** Build the advertising trace. */
+void adv_trace_init(void);
+
+/** Get the advertising reports of the trace. */
+const struct adv_trace_report *adv_trace_reports_get(void);
+
+/** Get the address of an advertising device. */
+const bt_addr_le_t *adv_trace_addr_get(uint16_t device);
+
+/** Get the name advertised by an asset tag. */
+const char *adv_trace_tag_name_get(uint16_t tag);
+
+/** Get the fleet UUID advertised by an asset tag. */
+uint16_t adv_trace_tag_uuid_get(uint16_t tag);
+
+/** Get the device index of an asset tag. */
+uint16_t adv_trace_tag_device_get(uint16_t tag);
+
+#endif /* ADV_TRACE_H_ */
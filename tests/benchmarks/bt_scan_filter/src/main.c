@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <bluetooth/scan.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#include "adv_trace.h"
+#include "bt_host_mock.h"
+
+#define PASS_CNT 20
+
+static const uint16_t filter_cnts[] = {16, 64, 256};
+
+static uint32_t match_cnt;
+
+static void scan_filter_match(struct bt_scan_device_info *device_info,
+			      struct bt_scan_filter_match *filter_match,
+			      bool connectable)
+{
+	match_cnt++;
+}
+
+BT_SCAN_CB_INIT(scan_cb, scan_filter_match, NULL, NULL, NULL);
+
+static void filters_add(enum bt_scan_filter_type type, uint16_t cnt)
+{
+	bt_scan_filter_remove_all();
+
+	for (uint16_t tag = 0; tag < cnt; tag++) {
+		struct bt_uuid_16 uuid = BT_UUID_INIT_16(adv_trace_tag_uuid_get(tag));
+		const void *data;
+		int err;
+
+		switch (type) {
+		case BT_SCAN_FILTER_TYPE_ADDR:
+			data = adv_trace_addr_get(adv_trace_tag_device_get(tag));
+			break;
+		case BT_SCAN_FILTER_TYPE_NAME:
+			data = adv_trace_tag_name_get(tag);
+			break;
+		default:
+			data = &uuid;
+			break;
+		}
+
+		err = bt_scan_filter_add(type, data);
+		zassert_ok(err, "Failed to add filter %u (%d)", tag, err);
+	}
+}
+
+static uint32_t expected_match_cnt_get(uint16_t cnt)
+{
+	const struct adv_trace_report *reports = adv_trace_reports_get();
+	uint32_t expected = 0;
+
+	for (size_t i = 0; i < ADV_TRACE_REPORT_CNT; i++) {
+		for (uint16_t tag = 0; tag < cnt; tag++) {
+			if (reports[i].device == adv_trace_tag_device_get(tag)) {
+				expected++;
+				break;
+			}
+		}
+	}
+
+	return expected;
+}
+
+static uint64_t trace_run_ns(struct bt_le_scan_cb *cb)
+{
+	const struct adv_trace_report *reports = adv_trace_reports_get();
+	struct bt_le_scan_recv_info info = {0};
+	struct net_buf_simple ad;
+#if defined(CONFIG_EXTERNAL_LIBC)
+	struct timespec start;
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+#else
+	uint32_t start = k_cycle_get_32();
+#endif
+
+	for (size_t i = 0; i < ADV_TRACE_REPORT_CNT; i++) {
+		info.addr = adv_trace_addr_get(reports[i].device);
+		info.adv_props = reports[i].adv_props;
+
+		net_buf_simple_init_with_data(&ad, (void *)reports[i].data, reports[i].len);
+
+		cb->recv(&info, &ad);
+	}
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+#else
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+#endif
+}
+
+static void filter_benchmark(const char *name, enum bt_scan_filter_type type,
+			     uint8_t mode)
+{
+	struct bt_le_scan_cb *cb = bt_host_mock_scan_cb_get();
+
+	zassert_not_null(cb, "Scan callback not registered");
+
+	TC_PRINT("%s filters, %s lookup, %d reports from %d devices\n", name,
+		 IS_ENABLED(CONFIG_BT_SCAN_FILTER_INDEX) ? "indexed" : "linear",
+		 ADV_TRACE_REPORT_CNT, ADV_TRACE_DEVICE_CNT);
+
+	for (size_t i = 0; i < ARRAY_SIZE(filter_cnts); i++) {
+		uint32_t expected = expected_match_cnt_get(filter_cnts[i]);
+		uint64_t min = UINT64_MAX;
+		uint64_t max = 0;
+		uint64_t sum = 0;
+
+		filters_add(type, filter_cnts[i]);
+		zassert_ok(bt_scan_filter_enable(mode, false), "Failed to enable filters");
+
+		for (size_t pass = 0; pass < PASS_CNT; pass++) {
+			uint64_t ns;
+
+			match_cnt = 0;
+			ns = trace_run_ns(cb) / ADV_TRACE_REPORT_CNT;
+
+			zassert_equal(match_cnt, expected, "%u matches, expected %u", match_cnt,
+				      expected);
+
+			min = MIN(min, ns);
+			max = MAX(max, ns);
+			sum += ns;
+		}
+
+		TC_PRINT("%4u filters: %u matches, min %u, avg %u, max %u ns per report\n",
+			 filter_cnts[i], expected, (uint32_t)min, (uint32_t)(sum / PASS_CNT),
+			 (uint32_t)max);
+	}
+}
+
+ZTEST(bt_scan_filter_benchmark, test_addr_filter)
+{
+	filter_benchmark("Address", BT_SCAN_FILTER_TYPE_ADDR, BT_SCAN_ADDR_FILTER);
+}
+
+ZTEST(bt_scan_filter_benchmark, test_name_filter)
+{
+	filter_benchmark("Name", BT_SCAN_FILTER_TYPE_NAME, BT_SCAN_NAME_FILTER);
+}
+
+ZTEST(bt_scan_filter_benchmark, test_uuid_filter)
+{
+	filter_benchmark("UUID", BT_SCAN_FILTER_TYPE_UUID, BT_SCAN_UUID_FILTER);
+}
+
+static void *setup(void)
+{
+	adv_trace_init();
+
+	bt_scan_init(NULL);
+	bt_scan_cb_register(&scan_cb);
+
+	return NULL;
+}
+
+ZTEST_SUITE(bt_scan_filter_benchmark, NULL, setup, NULL, NULL, NULL);
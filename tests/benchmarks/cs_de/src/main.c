@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <bluetooth/cs_de.h>
+#include <bluetooth/services/ras.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#include "procedure.h"
+
+#define DISTANCE_MIN_M	0.5f
+#define DISTANCE_STEP_M 0.5f
+#define PROCEDURE_CNT	80
+
+#if CONFIG_BT_CS_DE_IFFT_Q31
+#define IFFT_ARITHMETIC "q31"
+#elif CONFIG_BT_CS_DE_IFFT_Q15
+#define IFFT_ARITHMETIC "q15"
+#else
+#define IFFT_ARITHMETIC "f32"
+#endif
+
+NET_BUF_SIMPLE_DEFINE_STATIC(local_steps, PROCEDURE_LOCAL_STEPS_SIZE);
+NET_BUF_SIMPLE_DEFINE_STATIC(peer_steps, PROCEDURE_PEER_STEPS_SIZE);
+
+static cs_de_report_t report;
+static struct bt_conn_le_cs_config config;
+
+struct error_stats {
+	float sum;
+	float max;
+	uint32_t invalid;
+};
+
+struct time_stats {
+	uint64_t sum;
+	uint64_t max;
+};
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+typedef struct timespec timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now;
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	struct timespec end = timestamp();
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+}
+#else
+typedef uint32_t timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	return k_cycle_get_32();
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+}
+#endif
+
+static void time_add(struct time_stats *stats, uint64_t ns)
+{
+	stats->sum += ns;
+	stats->max = MAX(stats->max, ns);
+}
+
+static void time_print(const char *name, const struct time_stats *stats)
+{
+	TC_PRINT("%-12s avg %6u ns, max %6u ns\n", name, (uint32_t)(stats->sum / PROCEDURE_CNT),
+		 (uint32_t)stats->max);
+}
+
+static void error_add(struct error_stats *stats, float estimate, float distance)
+{
+	if (!isfinite(estimate)) {
+		stats->invalid++;
+		return;
+	}
+
+	stats->sum += fabsf(estimate - distance);
+	stats->max = fmaxf(stats->max, fabsf(estimate - distance));
+}
+
+static void error_print(const char *name, const struct error_stats *stats)
+{
+	uint32_t valid = PROCEDURE_CNT - stats->invalid;
+	uint32_t avg_mm = valid ? (uint32_t)(1000.0f * stats->sum / valid) : 0;
+
+	TC_PRINT("%-12s mean error %5u mm, max error %5u mm, %u invalid\n", name, avg_mm,
+		 (uint32_t)(1000.0f * stats->max), stats->invalid);
+}
+
+ZTEST(cs_de_benchmark, test_procedure)
+{
+	struct time_stats populate_time = {};
+	struct time_stats calc_time = {};
+	struct error_stats ifft_error = {};
+	struct error_stats phase_slope_error = {};
+
+	TC_PRINT("%s IFFT with %d samples, %d procedures of %d subevents\n", IFFT_ARITHMETIC,
+		 CONFIG_BT_CS_DE_NFFT_SIZE, PROCEDURE_CNT, PROCEDURE_SUBEVENTS);
+
+	for (int i = 0; i < PROCEDURE_CNT; i++) {
+		float distance = DISTANCE_MIN_M + i * DISTANCE_STEP_M;
+		cs_de_quality_t quality;
+		timestamp_t start;
+
+		procedure_generate(distance, i + 1, &local_steps, &peer_steps, &config);
+
+		start = timestamp();
+		cs_de_populate_report(&local_steps, &peer_steps, &config, &report);
+		time_add(&populate_time, elapsed_ns(start));
+
+		zassert_equal(report.n_ap, 1);
+		zassert_equal(report.tone_quality[0], CS_DE_TONE_QUALITY_OK);
+
+		start = timestamp();
+		quality = cs_de_calc(&report);
+		time_add(&calc_time, elapsed_ns(start));
+
+		zassert_equal(quality, CS_DE_QUALITY_OK, "No estimate at %u mm",
+			      (uint32_t)(distance * 1000));
+
+		error_add(&ifft_error, report.distance_estimates[0].ifft, distance);
+		error_add(&phase_slope_error, report.distance_estimates[0].phase_slope, distance);
+	}
+
+	time_print("populate", &populate_time);
+	time_print("calc", &calc_time);
+	error_print("ifft", &ifft_error);
+	error_print("phase slope", &phase_slope_error);
+}
+
+ZTEST(cs_de_benchmark, test_incremental)
+{
+	struct time_stats subevent_time = {};
+	struct time_stats finalize_time = {};
+	struct net_buf_simple_state local_state;
+	struct net_buf_simple_state peer_state;
+	static cs_de_report_t whole_report;
+
+	TC_PRINT("Steps added as every subevent arrives\n");
+
+	for (int i = 0; i < PROCEDURE_CNT; i++) {
+		float distance = DISTANCE_MIN_M + i * DISTANCE_STEP_M;
+		timestamp_t start;
+		uint64_t ns = 0;
+
+		procedure_generate(distance, i + 1, &local_steps, &peer_steps, &config);
+
+		net_buf_simple_save(&local_steps, &local_state);
+		net_buf_simple_save(&peer_steps, &peer_state);
+		cs_de_populate_report(&local_steps, &peer_steps, &config, &whole_report);
+		net_buf_simple_restore(&local_steps, &local_state);
+		net_buf_simple_restore(&peer_steps, &peer_state);
+
+		/* Skip the ranging header, every subevent has the same number of steps. */
+		net_buf_simple_pull(&peer_steps, sizeof(struct ras_ranging_header));
+		cs_de_report_init(&report, config.role, 1);
+
+		for (int subevent = 0; subevent < PROCEDURE_SUBEVENTS; subevent++) {
+			struct ras_subevent_header *header =
+				net_buf_simple_pull_mem(&peer_steps, sizeof(*header));
+
+			start = timestamp();
+
+			for (uint8_t step = 0; step < header->num_steps_reported; step++) {
+				struct bt_le_cs_subevent_step local_step;
+				struct bt_le_cs_subevent_step peer_step;
+
+				local_step.mode = net_buf_simple_pull_u8(&local_steps);
+				local_step.channel = net_buf_simple_pull_u8(&local_steps);
+				local_step.data_len = net_buf_simple_pull_u8(&local_steps);
+				local_step.data = net_buf_simple_pull_mem(&local_steps,
+									  local_step.data_len);
+
+				peer_step.mode = net_buf_simple_pull_u8(&peer_steps);
+				peer_step.channel = local_step.channel;
+				peer_step.data_len = local_step.data_len;
+				peer_step.data = net_buf_simple_pull_mem(&peer_steps,
+									 peer_step.data_len);
+
+				cs_de_report_step_add(&report, &local_step, &peer_step);
+			}
+
+			ns = MAX(ns, elapsed_ns(start));
+		}
+
+		time_add(&subevent_time, ns);
+
+		start = timestamp();
+		cs_de_report_finalize(&report, config.channel_map);
+		time_add(&finalize_time, elapsed_ns(start));
+
+		zassert_mem_equal(report.iq_tones, whole_report.iq_tones, sizeof(report.iq_tones),
+				  "Incremental report differs at %u mm", (uint32_t)(distance * 1000));
+		zassert_equal(report.tone_quality[0], whole_report.tone_quality[0]);
+	}
+
+	time_print("subevent", &subevent_time);
+	time_print("finalize", &finalize_time);
+}
+
+ZTEST_SUITE(cs_de_benchmark, NULL, NULL, NULL, NULL, NULL);
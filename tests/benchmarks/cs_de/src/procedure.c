@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/bluetooth/cs.h>
+#include <zephyr/bluetooth/hci_types.h>
+#include <zephyr/sys/byteorder.h>
+#include <bluetooth/services/ras.h>
+
+#include "procedure.h"
+
+#define PI		       3.14159265358979
+#define SPEED_OF_LIGHT_M_PER_S 299792458.0
+
+#define CHANNEL_FIRST 2
+#define CHANNEL_LAST  76
+#define CHANNEL_FREQ_HZ(channel) (2402e6 + (channel) * 1e6)
+
+/* Antenna path and the tone extension slot */
+#define STEP_DATA_MODE_2_LEN                                                                       \
+	(sizeof(struct bt_hci_le_cs_step_data_mode_2) +                                            \
+	 2 * sizeof(struct bt_hci_le_cs_step_data_tone_info))
+
+#define TONE_AMPLITUDE 600.0
+#define TONE_NOISE     20.0
+
+struct path {
+	/* Extra length compared to the direct path, in meters */
+	double excess;
+	double attenuation;
+};
+
+static const struct path paths[] = {
+	{ .excess = 0.0, .attenuation = 1.0 },
+	{ .excess = 3.1, .attenuation = 0.5 },
+	{ .excess = 7.4, .attenuation = 0.3 },
+};
+
+static uint32_t rand_state;
+
+static uint32_t rand_next(void)
+{
+	/* xorshift32 */
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static double rand_uniform(void)
+{
+	return (double)rand_next() / UINT32_MAX;
+}
+
+static double noise(void)
+{
+	/* Triangular distribution, close enough to Gaussian noise for the benchmark */
+	return TONE_NOISE * (rand_uniform() + rand_uniform() - 1.0);
+}
+
+static bool channel_valid(uint8_t channel)
+{
+	return channel < 23 || channel > 25;
+}
+
+static void tone_encode(struct bt_hci_le_cs_step_data_tone_info *tone_info, double i, double q)
+{
+	int16_t i_s = (int16_t)CLAMP(lround(i), -2048, 2047);
+	int16_t q_s = (int16_t)CLAMP(lround(q), -2048, 2047);
+
+	sys_put_le24((i_s & 0xFFF) | ((q_s & 0xFFF) << 12), tone_info->phase_correction_term);
+	tone_info->quality_indicator = BT_HCI_LE_CS_TONE_QUALITY_HIGH;
+}
+
+static struct bt_hci_le_cs_step_data_mode_2 *local_step_add(struct net_buf_simple *local_steps,
+							     uint8_t channel)
+{
+	net_buf_simple_add_u8(local_steps, BT_HCI_OP_LE_CS_MAIN_MODE_2);
+	net_buf_simple_add_u8(local_steps, channel);
+	net_buf_simple_add_u8(local_steps, STEP_DATA_MODE_2_LEN);
+
+	return memset(net_buf_simple_add(local_steps, STEP_DATA_MODE_2_LEN), 0,
+		      STEP_DATA_MODE_2_LEN);
+}
+
+static struct bt_hci_le_cs_step_data_mode_2 *peer_step_add(struct net_buf_simple *peer_steps)
+{
+	net_buf_simple_add_u8(peer_steps, BT_HCI_OP_LE_CS_MAIN_MODE_2);
+
+	return memset(net_buf_simple_add(peer_steps, STEP_DATA_MODE_2_LEN), 0,
+		      STEP_DATA_MODE_2_LEN);
+}
+
+void procedure_generate(float distance, uint32_t seed, struct net_buf_simple *local_steps,
+			struct net_buf_simple *peer_steps, struct bt_conn_le_cs_config *config)
+{
+	struct ras_ranging_header *ranging_header;
+	double path_phase[ARRAY_SIZE(paths)];
+	uint8_t steps = 0;
+
+	rand_state = seed ? seed : 1;
+
+	for (size_t p = 0; p < ARRAY_SIZE(paths); p++) {
+		/* Reflections change phase depending on the surface */
+		path_phase[p] = (p == 0) ? 0.0 : 2.0 * PI * rand_uniform();
+	}
+
+	for (uint8_t channel = CHANNEL_FIRST; channel <= CHANNEL_LAST; channel++) {
+		steps += channel_valid(channel) ? 1 : 0;
+	}
+
+	memset(config, 0, sizeof(*config));
+	config->role = BT_CONN_LE_CS_ROLE_INITIATOR;
+	bt_le_cs_set_valid_chmap_bits(config->channel_map);
+
+	net_buf_simple_reset(local_steps);
+	net_buf_simple_reset(peer_steps);
+
+	ranging_header = memset(net_buf_simple_add(peer_steps, sizeof(*ranging_header)), 0,
+				sizeof(*ranging_header));
+	ranging_header->antenna_paths_mask = BIT(0);
+
+	for (int subevent = 0; subevent < PROCEDURE_SUBEVENTS; subevent++) {
+		struct ras_subevent_header *subevent_header =
+			memset(net_buf_simple_add(peer_steps, sizeof(*subevent_header)), 0,
+			       sizeof(*subevent_header));
+
+		subevent_header->ranging_done_status =
+			(subevent == PROCEDURE_SUBEVENTS - 1) ? 0x0 : 0x1;
+		subevent_header->num_steps_reported = steps;
+
+		for (uint8_t channel = CHANNEL_FIRST; channel <= CHANNEL_LAST; channel++) {
+			double h_i = 0.0;
+			double h_q = 0.0;
+
+			if (!channel_valid(channel)) {
+				continue;
+			}
+
+			/* One way channel response of all paths */
+			for (size_t p = 0; p < ARRAY_SIZE(paths); p++) {
+				double phase = path_phase[p] - 2.0 * PI * CHANNEL_FREQ_HZ(channel) *
+								       (distance + paths[p].excess) /
+								       SPEED_OF_LIGHT_M_PER_S;
+
+				h_i += paths[p].attenuation * cos(phase);
+				h_q += paths[p].attenuation * sin(phase);
+			}
+
+			/* The local oscillator phase offset cancels out between the two sides */
+			double lo_phase = 2.0 * PI * rand_uniform();
+			double lo_i = cos(lo_phase);
+			double lo_q = sin(lo_phase);
+
+			struct bt_hci_le_cs_step_data_mode_2 *local = local_step_add(local_steps,
+										     channel);
+			struct bt_hci_le_cs_step_data_mode_2 *peer = peer_step_add(peer_steps);
+
+			tone_encode(&local->tone_info[0],
+				    TONE_AMPLITUDE * (h_i * lo_i - h_q * lo_q) + noise(),
+				    TONE_AMPLITUDE * (h_i * lo_q + h_q * lo_i) + noise());
+			tone_encode(&peer->tone_info[0],
+				    TONE_AMPLITUDE * (h_i * lo_i + h_q * lo_q) + noise(),
+				    TONE_AMPLITUDE * (h_q * lo_i - h_i * lo_q) + noise());
+		}
+	}
+}
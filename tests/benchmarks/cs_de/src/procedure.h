@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef PROCEDURE_H_
+#define PROCEDURE_H_
+
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/net_buf.h>
+
+/* Every procedure visits each channel once per subevent */
+#define PROCEDURE_SUBEVENTS 2
+
+#define PROCEDURE_LOCAL_STEPS_SIZE 2048
+#define PROCEDURE_PEER_STEPS_SIZE  2048
+
+/**
+ * @brief Generate the step data of a CS procedure, as received by the initiator.
+ *
+ * The local steps are laid out as reported by the controller and the peer steps as received
+ * through the Ranging Service, so they can be fed to cs_de_populate_report(). The tones follow
+ * a multipath channel with the direct path at the given distance, two weaker reflections and
+ * noise, quantized to the 12-bit phase correction terms. The data only depends on the distance
+ * and the seed.
+ *
+ * @param[in] distance Length of the direct path in meters.
+ * @param[in] seed Seed of the reflection phases and the noise.
+ * @param[out] local_steps Local step data.
+ * @param[out] peer_steps Peer ranging data.
+ * @param[out] config CS config matching the generated data.
+ */
+void procedure_generate(float distance, uint32_t seed, struct net_buf_simple *local_steps,
+			struct net_buf_simple *peer_steps, struct bt_conn_le_cs_config *config);
+
+#endif /* PROCEDURE_H_ */
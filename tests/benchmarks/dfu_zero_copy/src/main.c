@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/flash.h>
+#include <dfu/dfu_target_stream.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#define FLASH_BASE (64 * 1024)
+#define IMAGE_SIZE (16 * 1024)
+#define ROUNDS 20
+
+/* Flash write buffer, as CONFIG_FOTA_DOWNLOAD_MCUBOOT_FLASH_BUF_SZ */
+#define FLASH_BUF_SZ 512
+/* Downloader buffer, as CONFIG_FOTA_DOWNLOAD_BUF_SZ */
+#define DL_BUF_SZ 2048
+/* Largest amount of data that a receive returns, as one TLS record */
+#define RECV_MAX 1024
+
+static const struct device *fdev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+static uint8_t flash_buf[FLASH_BUF_SZ] __aligned(4);
+static uint8_t dl_buf[DL_BUF_SZ];
+static uint8_t image[IMAGE_SIZE];
+static uint8_t read_buf[IMAGE_SIZE];
+
+/* The socket, which hands out the image in pieces */
+static struct {
+	size_t pos;
+	size_t calls;
+} sock;
+
+static size_t sock_recv(void *buf, size_t len)
+{
+	len = MIN(MIN(len, RECV_MAX), IMAGE_SIZE - sock.pos);
+
+	memcpy(buf, image + sock.pos, len);
+	sock.pos += len;
+	sock.calls++;
+
+	return len;
+}
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+typedef struct timespec timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now;
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	struct timespec end = timestamp();
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+}
+#else
+typedef uint32_t timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	return k_cycle_get_32();
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+}
+#endif
+
+static void stream_start(void)
+{
+	struct dfu_target_stream_init init = {
+		.id = "bench",
+		.fdev = fdev,
+		.buf = flash_buf,
+		.len = sizeof(flash_buf),
+		.offset = FLASH_BASE,
+		.size = IMAGE_SIZE,
+	};
+
+	zassert_ok(dfu_target_stream_init(&init));
+	/* Start over, without progress from an earlier round */
+	zassert_ok(dfu_target_stream_reset());
+	zassert_ok(dfu_target_stream_init(&init));
+
+	memset(&sock, 0, sizeof(sock));
+}
+
+/* Receive the image and write it to flash, the way fota_download does */
+static uint64_t download(bool zero_copy)
+{
+	timestamp_t start;
+	uint64_t ns;
+	void *buf;
+	size_t len;
+
+	stream_start();
+	start = timestamp();
+
+	while (sock.pos < IMAGE_SIZE) {
+		if (zero_copy && dfu_target_stream_buf_get(&buf, &len) == 0 && len) {
+			len = sock_recv(buf, len);
+		} else {
+			buf = dl_buf;
+			len = sock_recv(dl_buf, sizeof(dl_buf));
+		}
+
+		zassert_ok(dfu_target_stream_write(buf, len));
+	}
+
+	zassert_ok(dfu_target_stream_done(true));
+	ns = elapsed_ns(start);
+
+	zassert_ok(flash_read(fdev, FLASH_BASE, read_buf, sizeof(read_buf)));
+	zassert_mem_equal(read_buf, image, sizeof(image), "Image differs");
+
+	return ns;
+}
+
+ZTEST(dfu_zero_copy_benchmark, test_download)
+{
+	uint64_t ns_copy = 0;
+	uint64_t ns_zero_copy = 0;
+	size_t calls_copy;
+	size_t calls_zero_copy;
+
+	(void)download(false);
+	calls_copy = sock.calls;
+	(void)download(true);
+	calls_zero_copy = sock.calls;
+
+	for (int round = 0; round < ROUNDS; round++) {
+		ns_copy += download(false);
+		ns_zero_copy += download(true);
+	}
+
+	ns_copy /= ROUNDS;
+	ns_zero_copy /= ROUNDS;
+
+	TC_PRINT("%u byte image, %u byte flash buffer\n", IMAGE_SIZE, FLASH_BUF_SZ);
+	TC_PRINT("copy:      %7u ns %6u kB/s, %3zu receives, %u bytes copied\n",
+		 (uint32_t)ns_copy, (uint32_t)((uint64_t)IMAGE_SIZE * NSEC_PER_SEC / 1024 / ns_copy),
+		 calls_copy, 2 * IMAGE_SIZE);
+	TC_PRINT("zero-copy: %7u ns %6u kB/s, %3zu receives, %u bytes copied\n",
+		 (uint32_t)ns_zero_copy,
+		 (uint32_t)((uint64_t)IMAGE_SIZE * NSEC_PER_SEC / 1024 / ns_zero_copy),
+		 calls_zero_copy, IMAGE_SIZE);
+}
+
+static void *setup(void)
+{
+	__ASSERT_NO_MSG(device_is_ready(fdev));
+
+	for (size_t i = 0; i < sizeof(image); i++) {
+		image[i] = i % 251;
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(dfu_zero_copy_benchmark, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <emds/emds.h>
+
+/* Every pass writes two snapshots, keep the flash wear of a run low. */
+#define PASS_CNT 5
+
+#define ENTRY_SIZE 16
+#define ENTRY_ID_BASE 0x1000
+
+/* Entries registered in turn. All entries fit twice in the default partition size. */
+static const uint8_t entry_cnts[] = {1, 4, 16, 64};
+
+#define ENTRY_CNT_MAX 64
+
+static uint8_t data[ENTRY_CNT_MAX][ENTRY_SIZE];
+static uint8_t stored[ENTRY_CNT_MAX][ENTRY_SIZE];
+static struct emds_dynamic_entry entries[ENTRY_CNT_MAX];
+static size_t entry_cnt;
+
+static void entries_add(size_t cnt)
+{
+	for (; entry_cnt < cnt; entry_cnt++) {
+		entries[entry_cnt].entry.id = ENTRY_ID_BASE + entry_cnt;
+		entries[entry_cnt].entry.data = data[entry_cnt];
+		entries[entry_cnt].entry.len = ENTRY_SIZE;
+		zassert_ok(emds_entry_add(&entries[entry_cnt]));
+	}
+}
+
+/* Loads the last snapshot, checks that it holds the last stored data, and
+ * prepares the next one.
+ */
+static void load_and_prepare(void)
+{
+	int err = emds_load();
+
+	zassert_true(err == 0 || err == -ENOENT, "Load failed: %d", err);
+	if (err == 0) {
+		zassert_mem_equal(data, stored, sizeof(data[0]) * entry_cnt);
+	}
+
+	zassert_ok(emds_prepare());
+	zassert_true(emds_is_ready());
+}
+
+/* Changes the given number of entries and measures the time to store them. */
+static uint32_t store_us(size_t changed_cnt)
+{
+	uint32_t start;
+	uint32_t cycles;
+
+	for (size_t i = 0; i < changed_cnt; i++) {
+		data[i][0]++;
+	}
+
+	start = k_cycle_get_32();
+	zassert_ok(emds_store());
+	cycles = k_cycle_get_32() - start;
+
+	memcpy(stored, data, sizeof(data[0]) * entry_cnt);
+
+	return k_cyc_to_us_ceil32(cycles);
+}
+
+static void result_print(const char *name, size_t cnt, uint32_t min, uint32_t sum, uint32_t max)
+{
+	TC_PRINT("%-11s %2zu entries: min %u, avg %u, max %u us\n", name, cnt, min,
+		 sum / PASS_CNT, max);
+}
+
+ZTEST(emds_store_benchmark, test_store_time)
+{
+	TC_PRINT("Incremental snapshots %s, %d byte entries\n",
+		 IS_ENABLED(CONFIG_EMDS_INCREMENTAL) ? "enabled" : "disabled", ENTRY_SIZE);
+
+	for (size_t i = 0; i < ARRAY_SIZE(entry_cnts); i++) {
+		uint32_t min[2] = {UINT32_MAX, UINT32_MAX};
+		uint32_t max[2] = {};
+		uint32_t sum[2] = {};
+		uint32_t estimate;
+
+		/* Entries can only be added before the data is loaded. */
+		entries_add(entry_cnts[i]);
+
+		for (size_t pass = 0; pass < PASS_CNT; pass++) {
+			uint32_t us[2];
+
+			load_and_prepare();
+			us[0] = store_us(entry_cnt);
+
+			load_and_prepare();
+			us[1] = store_us(1);
+
+			for (size_t j = 0; j < ARRAY_SIZE(us); j++) {
+				min[j] = MIN(min[j], us[j]);
+				max[j] = MAX(max[j], us[j]);
+				sum[j] += us[j];
+			}
+		}
+
+		zassert_ok(emds_store_time_get(&estimate));
+		zassert_true(max[0] < estimate, "Store took %u us, estimated %u us", max[0],
+			     estimate);
+
+		result_print("all changed", entry_cnt, min[0], sum[0], max[0]);
+		result_print("one changed", entry_cnt, min[1], sum[1], max[1]);
+		TC_PRINT("%-11s %2zu entries: %u us\n", "estimated", entry_cnt, estimate);
+	}
+
+	/* The last stored data is loaded. */
+	memset(data, 0, sizeof(data));
+	zassert_ok(emds_load());
+	zassert_mem_equal(data, stored, sizeof(data));
+}
+
+static void *emds_store_benchmark_setup(void)
+{
+	zassert_ok(emds_init(NULL));
+	zassert_ok(emds_clear());
+
+	return NULL;
+}
+
+ZTEST_SUITE(emds_store_benchmark, NULL, emds_store_benchmark_setup, NULL, NULL, NULL);
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_defs.h>
+#include <cJSON.h>
+#include "nrf_cloud_json_stream.h"
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#define ROUNDS 100
+
+/* Allocations made through the cJSON hooks, which the streaming encoder also uses */
+static struct {
+	size_t count;
+	size_t used;
+	size_t peak;
+} heap;
+
+static void *counting_malloc(size_t size)
+{
+	size_t *block = k_malloc(sizeof(size_t) + size);
+
+	if (!block) {
+		return NULL;
+	}
+
+	*block = size;
+	heap.count++;
+	heap.used += size;
+	heap.peak = MAX(heap.peak, heap.used);
+
+	return block + 1;
+}
+
+static void counting_free(void *ptr)
+{
+	size_t *block = ptr;
+
+	if (!block) {
+		return;
+	}
+
+	heap.used -= block[-1];
+	k_free(block - 1);
+}
+
+static void heap_reset(void)
+{
+	heap.count = 0;
+	heap.peak = heap.used;
+}
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+typedef struct timespec timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now;
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	struct timespec end = timestamp();
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+}
+#else
+typedef uint32_t timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	return k_cycle_get_32();
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+}
+#endif
+
+/* The messages as the library built them with cJSON before the streaming encoder */
+static int tree_message_encode(const char *app_id, double value, const char *str_val,
+			       const char *topic, int64_t ts, struct nrf_cloud_data *output)
+{
+	cJSON *root_obj = cJSON_CreateObject();
+	cJSON *msg_obj;
+	int ret = 0;
+
+	if (!root_obj) {
+		return -ENOMEM;
+	}
+
+	if (topic) {
+		ret += !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_REST_TOPIC_KEY, topic);
+	}
+
+	msg_obj = cJSON_AddObjectToObjectCS(root_obj, NRF_CLOUD_REST_MSG_KEY);
+	ret += !msg_obj;
+	ret += !cJSON_AddStringToObjectCS(msg_obj, NRF_CLOUD_JSON_APPID_KEY, app_id);
+	ret += !cJSON_AddStringToObjectCS(msg_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+					  NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	ret += !cJSON_AddNumberToObjectCS(msg_obj, NRF_CLOUD_MSG_TIMESTAMP_KEY, ts);
+
+	if (str_val) {
+		ret += !cJSON_AddStringToObjectCS(msg_obj, NRF_CLOUD_JSON_DATA_KEY, str_val);
+	} else {
+		ret += !cJSON_AddNumberToObjectCS(msg_obj, NRF_CLOUD_JSON_DATA_KEY, value);
+	}
+
+	if (!ret) {
+		output->ptr = cJSON_PrintUnformatted(root_obj);
+		ret = output->ptr ? 0 : -ENOMEM;
+	}
+
+	cJSON_Delete(root_obj);
+
+	if (!ret) {
+		output->len = strlen(output->ptr);
+	}
+
+	return ret ? -ENOMEM : 0;
+}
+
+static int tree_sensor_data_encode(const char *app_id, const char *data, int64_t ts_ms,
+				   struct nrf_cloud_data *output)
+{
+	cJSON *root_obj = cJSON_CreateObject();
+	int ret;
+
+	if (!root_obj) {
+		return -ENOMEM;
+	}
+
+	ret = !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_APPID_KEY, app_id);
+	ret += !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_DATA_KEY, data);
+	ret += !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+					  NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+		ret += !cJSON_AddNumberToObjectCS(root_obj, NRF_CLOUD_MSG_TIMESTAMP_KEY, ts_ms);
+	}
+
+	if (!ret) {
+		output->ptr = cJSON_PrintUnformatted(root_obj);
+		ret = output->ptr ? 0 : -ENOMEM;
+	}
+
+	cJSON_Delete(root_obj);
+
+	if (!ret) {
+		output->len = strlen(output->ptr);
+	}
+
+	return ret ? -ENOMEM : 0;
+}
+
+struct message {
+	const char *name;
+	const char *app_id;
+	double value;
+	const char *str_val;
+	const char *topic;
+	int64_t ts;
+	bool sensor;
+};
+
+/* Messages a tracker sends most often */
+static const struct message messages[] = {
+	{ .name = "TEMP", .app_id = "TEMP", .value = 21.5, .topic = "d2c",
+	  .ts = 1700000000123 },
+	{ .name = "HUMID", .app_id = "HUMID", .value = 1.0 / 3, .ts = 1700000000456 },
+	{ .name = "RSRP", .app_id = "RSRP", .value = -97, .topic = "d2c",
+	  .ts = 1700000000789 },
+	{ .name = "GNSS string", .app_id = "GNSS",
+	  .str_val = "$GPGGA,092750.000,5321.6802,N,00630.3372,W,1,8,1.03,61.7,M,55.2,M,,*76",
+	  .ts = 1700000001000 },
+	{ .name = "AIR_PRESS sensor", .app_id = "AIR_PRESS", .str_val = "101.325",
+	  .ts = 1700000001234, .sensor = true },
+	{ .name = "BUTTON sensor", .app_id = "BUTTON", .str_val = "1",
+	  .ts = NRF_CLOUD_NO_TIMESTAMP, .sensor = true },
+};
+
+static int message_encode(const struct message *m, bool stream, struct nrf_cloud_data *output)
+{
+	if (m->sensor) {
+		return stream ? nrf_cloud_json_stream_sensor_data_encode(m->app_id, m->str_val,
+									 m->ts, output)
+			      : tree_sensor_data_encode(m->app_id, m->str_val, m->ts, output);
+	}
+
+	return stream ? nrf_cloud_json_stream_message_encode(m->app_id, m->value, m->str_val,
+							     m->topic, m->ts, output)
+		      : tree_message_encode(m->app_id, m->value, m->str_val, m->topic, m->ts,
+					    output);
+}
+
+ZTEST(nrf_cloud_json_benchmark, test_encode)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(messages); i++) {
+		const struct message *m = &messages[i];
+		struct nrf_cloud_data tree = {0};
+		struct nrf_cloud_data stream = {0};
+		uint64_t ns_tree = 0;
+		uint64_t ns_stream = 0;
+		size_t allocs_tree;
+		size_t allocs_stream;
+		size_t peak_tree;
+		size_t peak_stream;
+
+		heap_reset();
+		zassert_ok(message_encode(m, false, &tree));
+		allocs_tree = heap.count;
+		peak_tree = heap.peak;
+
+		heap_reset();
+		zassert_ok(message_encode(m, true, &stream));
+		allocs_stream = heap.count;
+		peak_stream = heap.peak;
+
+		zassert_equal(tree.len, stream.len, "%s lengths differ", m->name);
+		zassert_mem_equal(tree.ptr, stream.ptr, tree.len + 1, "%s differs: %s", m->name,
+				  (const char *)stream.ptr);
+		cJSON_free((void *)tree.ptr);
+		cJSON_free((void *)stream.ptr);
+
+		for (int round = 0; round < ROUNDS; round++) {
+			timestamp_t start;
+
+			start = timestamp();
+			zassert_ok(message_encode(m, false, &tree));
+			cJSON_free((void *)tree.ptr);
+			ns_tree += elapsed_ns(start);
+
+			start = timestamp();
+			zassert_ok(message_encode(m, true, &stream));
+			cJSON_free((void *)stream.ptr);
+			ns_stream += elapsed_ns(start);
+		}
+
+		TC_PRINT("%-16s %3zu bytes: cJSON %6u ns %2zu allocs %4zu peak, "
+			 "stream %5u ns %zu alloc %3zu peak\n",
+			 m->name, stream.len, (uint32_t)(ns_tree / ROUNDS), allocs_tree, peak_tree,
+			 (uint32_t)(ns_stream / ROUNDS), allocs_stream, peak_stream);
+	}
+
+	zassert_equal(heap.used, 0, "Leaked %zu bytes", heap.used);
+}
+
+ZTEST(nrf_cloud_json_benchmark, test_escape)
+{
+	const char *str = "\"quoted\" back\\slash\ttab\r\nctrl\x01\x1f";
+	struct nrf_cloud_data tree;
+	struct nrf_cloud_data stream;
+
+	zassert_ok(tree_message_encode("LOG", 0, str, NULL, 0, &tree));
+	zassert_ok(nrf_cloud_json_stream_message_encode("LOG", 0, str, NULL, 0, &stream));
+	zassert_str_equal(tree.ptr, stream.ptr);
+
+	cJSON_free((void *)tree.ptr);
+	cJSON_free((void *)stream.ptr);
+}
+
+ZTEST(nrf_cloud_json_benchmark, test_numbers)
+{
+	const double values[] = { 0, -0.0, 1e15, -1e15, 1e300, 3e-5, 0.1, 1.0 / 3,
+				  123456789012.5, 4294967296.0, -2147483648.0, 2147483648.0 };
+
+	for (size_t i = 0; i < ARRAY_SIZE(values); i++) {
+		struct nrf_cloud_data tree;
+		struct nrf_cloud_data stream;
+
+		zassert_ok(tree_message_encode("NUM", values[i], NULL, NULL, 0, &tree));
+		zassert_ok(nrf_cloud_json_stream_message_encode("NUM", values[i], NULL, NULL, 0,
+								&stream));
+		zassert_str_equal(tree.ptr, stream.ptr, "Value %zu differs", i);
+
+		cJSON_free((void *)tree.ptr);
+		cJSON_free((void *)stream.ptr);
+	}
+}
+
+static void *setup(void)
+{
+	cJSON_Hooks hooks = {
+		.malloc_fn = counting_malloc,
+		.free_fn = counting_free,
+	};
+
+	cJSON_InitHooks(&hooks);
+
+	return NULL;
+}
+
+ZTEST_SUITE(nrf_cloud_json_benchmark, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <nrf_compress/implementation.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#define ROUNDS 20
+
+static const uint8_t source_image[] = {
+#include "delta_source.inc"
+};
+
+static const uint8_t target_image[] = {
+#include "delta_target.inc"
+};
+
+static const uint8_t patch[] = {
+#include "delta_patch.inc"
+};
+
+static uint8_t output_image[sizeof(target_image)];
+static size_t read_cnt;
+
+static size_t read_source(size_t pos, uint8_t *data, size_t len)
+{
+	memcpy(data, &source_image[pos], len);
+	read_cnt++;
+
+	return len;
+}
+
+static const delta_codec delta_inst = {
+	.read = read_source,
+	.source_size = sizeof(source_image),
+};
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+typedef struct timespec timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now;
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	struct timespec end = timestamp();
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+}
+#else
+typedef uint32_t timestamp_t;
+
+static timestamp_t timestamp(void)
+{
+	return k_cycle_get_32();
+}
+
+static uint64_t elapsed_ns(timestamp_t start)
+{
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+}
+#endif
+
+/* Apply the patch the way MCUboot decompresses an image, in chunks the library asks for */
+static uint64_t apply(struct nrf_compress_implementation *impl)
+{
+	size_t output_image_size = 0;
+	uint32_t pos = 0;
+	timestamp_t start;
+	uint64_t ns;
+
+	start = timestamp();
+	zassert_ok(impl->init((void *)&delta_inst, sizeof(target_image)));
+
+	while (pos < sizeof(patch)) {
+		size_t len = MIN(impl->decompress_bytes_needed((void *)&delta_inst),
+				 sizeof(patch) - pos);
+		uint32_t offset;
+		uint8_t *output;
+		size_t output_size;
+
+		zassert_ok(impl->decompress((void *)&delta_inst, &patch[pos], len,
+					    pos + len == sizeof(patch), &offset, &output,
+					    &output_size));
+
+		memcpy(&output_image[output_image_size], output, output_size);
+		output_image_size += output_size;
+		pos += offset;
+	}
+
+	zassert_ok(impl->deinit((void *)&delta_inst));
+	ns = elapsed_ns(start);
+
+	zassert_equal(output_image_size, sizeof(target_image));
+	zassert_mem_equal(output_image, target_image, sizeof(target_image), "Image differs");
+
+	return ns;
+}
+
+ZTEST(nrf_compress_delta_benchmark, test_apply)
+{
+	struct nrf_compress_implementation *impl;
+	uint64_t ns = 0;
+	size_t reads;
+
+	impl = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+	zassert_not_null(impl);
+
+	read_cnt = 0;
+	(void)apply(impl);
+	reads = read_cnt;
+
+	for (int round = 0; round < ROUNDS; round++) {
+		ns += apply(impl);
+	}
+
+	ns /= ROUNDS;
+
+	TC_PRINT("%zu byte image from a %zu byte patch, %u%% of the image\n",
+		 sizeof(target_image), sizeof(patch),
+		 (uint32_t)(sizeof(patch) * 100 / sizeof(target_image)));
+	TC_PRINT("apply: %8u ns %6u kB/s, %zu source reads, %u byte chunks\n", (uint32_t)ns,
+		 (uint32_t)((uint64_t)sizeof(target_image) * NSEC_PER_SEC / 1024 / ns), reads,
+		 CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+}
+
+ZTEST_SUITE(nrf_compress_delta_benchmark, NULL, NULL, NULL, NULL, NULL);
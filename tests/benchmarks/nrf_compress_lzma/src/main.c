@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <nrf_compress/implementation.h>
+#include <mbedtls/sha256.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#define SHA256_SIZE 32
+#define DICT_SIZE (128 * 1024)
+
+/* Emulated external flash that holds the dictionary, with the typical timing of the MX25R64
+ * QSPI flash of the nRF52840 DK. The internal NVMC stalls the CPU while it erases and writes, so
+ * the writes cannot overlap with the decoding there.
+ */
+#define FLASH_SECTOR_SIZE 4096
+#define FLASH_SECTOR_ERASE_US 40000
+#define FLASH_PAGE_SIZE 256
+#define FLASH_PAGE_PROGRAM_US 850
+
+/* How much slower than the host the target decodes, as a 64 MHz Cortex-M4 */
+#define DECODE_SLOWDOWN 50
+
+/* Input valid lzma2 compressed data whereby the output is larger than the dictionary size */
+static const uint8_t input[] = {
+#include "dummy_data_input_large.inc"
+};
+
+/* File size and sha256 hash of decompressed data */
+static const uint32_t output_size_expected = 134061;
+static const uint8_t output_sha256[] = {
+	0xc0, 0xc4, 0xac, 0xc7, 0xac, 0x69, 0x37, 0x4b,
+	0x60, 0xb4, 0x87, 0xe9, 0x3d, 0x65, 0xcf, 0xa2,
+	0x4b, 0x2b, 0xef, 0xd0, 0xb9, 0xbf, 0xf9, 0xc9,
+	0x2f, 0x61, 0x52, 0x17, 0xca, 0x55, 0x03, 0x77
+};
+
+static uint8_t flash[DICT_SIZE];
+
+static struct {
+	uint32_t writes;
+	uint32_t erases;
+	uint64_t write_us;
+	uint64_t decode_us;
+} stats;
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+static uint64_t host_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * NSEC_PER_SEC + now.tv_nsec;
+}
+#else
+static uint64_t host_ns(void)
+{
+	return k_cyc_to_ns_floor64(k_cycle_get_64());
+}
+#endif
+
+static int flash_open(size_t dict_size, size_t *buff_size)
+{
+	*buff_size = DICT_SIZE;
+
+	return dict_size > DICT_SIZE ? -ENOMEM : 0;
+}
+
+static int flash_close(void)
+{
+	return 0;
+}
+
+/* Sleep for as long as the erase and write take. The CPU is free meanwhile, as the QSPI driver
+ * waits for the flash to be ready.
+ */
+static size_t flash_write(size_t pos, const uint8_t *data, size_t len)
+{
+	uint32_t us = DIV_ROUND_UP(len, FLASH_PAGE_SIZE) * FLASH_PAGE_PROGRAM_US;
+
+	for (size_t sector = ROUND_UP(pos, FLASH_SECTOR_SIZE); sector < pos + len;
+	     sector += FLASH_SECTOR_SIZE) {
+		us += FLASH_SECTOR_ERASE_US;
+		stats.erases++;
+	}
+
+	k_sleep(K_USEC(us));
+	memcpy(flash + pos, data, len);
+
+	stats.writes++;
+	stats.write_us += us;
+
+	return len;
+}
+
+/* Reading is memory mapped, so its time is left out */
+static size_t flash_read(size_t pos, uint8_t *data, size_t len)
+{
+	memcpy(data, flash + pos, len);
+
+	return len;
+}
+
+static lzma_codec lzma_inst = {
+	.dict_if = {
+		.open = flash_open,
+		.close = flash_close,
+		.write = flash_write,
+		.read = flash_read,
+	},
+};
+
+/* The simulated time does not advance while the host CPU decodes, so pass the decoding time
+ * of the target as well, with the dictionary writes running in the background.
+ */
+static int decompress(struct nrf_compress_implementation *impl, const uint8_t *buf, size_t len,
+		      bool last_part, uint32_t *offset, uint8_t **output, size_t *output_size)
+{
+	uint64_t start = host_ns();
+	uint32_t us;
+	int rc;
+
+	rc = impl->decompress(&lzma_inst, buf, len, last_part, offset, output, output_size);
+
+	us = (host_ns() - start) * DECODE_SLOWDOWN / NSEC_PER_USEC;
+	stats.decode_us += us;
+	k_busy_wait(us);
+
+	return rc;
+}
+
+ZTEST(nrf_compress_lzma_benchmark, test_decompress_to_flash)
+{
+	struct nrf_compress_implementation *impl;
+	uint8_t sha[SHA256_SIZE];
+	mbedtls_sha256_context ctx;
+	uint32_t total = 0;
+	uint32_t pos = 0;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	uint32_t start;
+	uint32_t us;
+	int rc;
+
+	impl = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+	zassert_not_null(impl);
+
+	mbedtls_sha256_init(&ctx);
+	zassert_ok(mbedtls_sha256_starts(&ctx, false));
+
+	start = k_cycle_get_32();
+
+	zassert_ok(impl->init(&lzma_inst, output_size_expected));
+
+	while (pos < sizeof(input)) {
+		rc = impl->decompress_bytes_needed(&lzma_inst);
+		zassert_true(rc > 0);
+
+		rc = MIN(rc, sizeof(input) - pos);
+		rc = decompress(impl, &input[pos], rc, pos + rc == sizeof(input), &offset,
+				&output, &output_size);
+		zassert_ok(rc, "Decompression failed at %u", pos);
+
+		if (output_size > 0) {
+			zassert_ok(mbedtls_sha256_update(&ctx, flash, output_size));
+			total += output_size;
+		}
+
+		pos += offset;
+	}
+
+	zassert_ok(impl->deinit(&lzma_inst));
+
+	us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	zassert_ok(mbedtls_sha256_finish(&ctx, sha));
+	mbedtls_sha256_free(&ctx);
+	zassert_equal(total, output_size_expected);
+	zassert_mem_equal(sha, output_sha256, SHA256_SIZE, "Output differs");
+
+	TC_PRINT("%s write, %u byte cache\n",
+		 IS_ENABLED(CONFIG_NRF_COMPRESS_DICTIONARY_BACKGROUND_WRITE) ? "background" : "sync",
+		 CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE);
+	TC_PRINT("decode %7u us, flash %7u us in %u writes and %u erases\n",
+		 (uint32_t)stats.decode_us, (uint32_t)stats.write_us, stats.writes, stats.erases);
+	TC_PRINT("total  %7u us, %u kB/s\n", us,
+		 (uint32_t)((uint64_t)total * USEC_PER_SEC / 1024 / us));
+}
+
+ZTEST_SUITE(nrf_compress_lzma_benchmark, NULL, NULL, NULL, NULL, NULL);
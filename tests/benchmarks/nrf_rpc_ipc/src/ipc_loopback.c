@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ipc_loopback.h"
+
+#include <zephyr/ipc/ipc_service_backend.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include <string.h>
+
+#define BUF_CNT 4
+
+struct ipc_loopback_data {
+	const struct ipc_ept_cfg *cfg;
+	uint8_t bufs[BUF_CNT][IPC_LOOPBACK_BUF_SIZE] __aligned(sizeof(void *));
+	ATOMIC_DEFINE(bufs_used, BUF_CNT);
+	size_t copied;
+};
+
+static struct ipc_loopback_data loopback_data;
+
+static void *buf_alloc(struct ipc_loopback_data *data)
+{
+	for (size_t i = 0; i < BUF_CNT; i++) {
+		if (!atomic_test_and_set_bit(data->bufs_used, i)) {
+			return data->bufs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void buf_free(struct ipc_loopback_data *data, const void *buf)
+{
+	size_t i = ((const uint8_t *)buf - data->bufs[0]) / IPC_LOOPBACK_BUF_SIZE;
+
+	__ASSERT_NO_MSG(i < BUF_CNT);
+	atomic_clear_bit(data->bufs_used, i);
+}
+
+/* The remote side decodes the packet in place and then releases the shared buffer */
+static void deliver(struct ipc_loopback_data *data, const void *buf, size_t len)
+{
+	data->cfg->cb.received(buf, len, data->cfg->priv);
+	buf_free(data, buf);
+}
+
+static int register_endpoint(const struct device *instance, void **token,
+			     const struct ipc_ept_cfg *cfg)
+{
+	struct ipc_loopback_data *data = instance->data;
+
+	data->cfg = cfg;
+	*token = data;
+
+	if (cfg->cb.bound) {
+		cfg->cb.bound(cfg->priv);
+	}
+
+	return 0;
+}
+
+static int send(const struct device *instance, void *token, const void *msg, size_t len)
+{
+	struct ipc_loopback_data *data = token;
+	void *buf;
+
+	if (len > IPC_LOOPBACK_BUF_SIZE) {
+		return -EBADMSG;
+	}
+
+	buf = buf_alloc(data);
+	if (!buf) {
+		return -ENOMEM;
+	}
+
+	memcpy(buf, msg, len);
+	data->copied += len;
+	deliver(data, buf, len);
+
+	return len;
+}
+
+static int get_tx_buffer_size(const struct device *instance, void *token)
+{
+	return IPC_LOOPBACK_BUF_SIZE;
+}
+
+static int get_tx_buffer(const struct device *instance, void *token, void **buf, uint32_t *len,
+			 k_timeout_t wait)
+{
+	struct ipc_loopback_data *data = token;
+
+	if (*len > IPC_LOOPBACK_BUF_SIZE) {
+		*len = IPC_LOOPBACK_BUF_SIZE;
+		return -ENOMEM;
+	}
+
+	*buf = buf_alloc(data);
+	if (!*buf) {
+		return -ENOBUFS;
+	}
+
+	*len = IPC_LOOPBACK_BUF_SIZE;
+
+	return 0;
+}
+
+static int drop_tx_buffer(const struct device *instance, void *token, const void *buf)
+{
+	buf_free(token, buf);
+
+	return 0;
+}
+
+static int send_nocopy(const struct device *instance, void *token, const void *buf, size_t len)
+{
+	deliver(token, buf, len);
+
+	return len;
+}
+
+static const struct ipc_service_backend loopback_backend = {
+	.register_endpoint = register_endpoint,
+	.send = send,
+	.get_tx_buffer_size = get_tx_buffer_size,
+	.get_tx_buffer = get_tx_buffer,
+	.drop_tx_buffer = drop_tx_buffer,
+	.send_nocopy = send_nocopy,
+};
+
+size_t ipc_loopback_copied_get(void)
+{
+	return loopback_data.copied;
+}
+
+void ipc_loopback_copied_reset(void)
+{
+	loopback_data.copied = 0;
+}
+
+DEVICE_DEFINE(ipc_loopback, "ipc_loopback", NULL, NULL, &loopback_data, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &loopback_backend);
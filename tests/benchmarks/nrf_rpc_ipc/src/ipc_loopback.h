@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef IPC_LOOPBACK_H_
+#define IPC_LOOPBACK_H_
+
+#include <zephyr/device.h>
+
+/* Size of a single shared memory buffer of the emulated backend */
+#define IPC_LOOPBACK_BUF_SIZE 1024
+
+/* Emulated IPC Service backend that delivers every sent packet back to the sending endpoint */
+DEVICE_DECLARE(ipc_loopback);
+
+/* Number of bytes copied into the shared memory since the last reset */
+size_t ipc_loopback_copied_get(void);
+
+void ipc_loopback_copied_reset(void);
+
+#endif /* IPC_LOOPBACK_H_ */
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <nrf_rpc/nrf_rpc_ipc.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#include "ipc_loopback.h"
+
+#define PACKET_CNT 10000
+
+NRF_RPC_IPC_TRANSPORT(rpc_tr, DEVICE_GET(ipc_loopback), "rpc_ept");
+
+static const size_t packet_sizes[] = {16, 64, 256, 1024};
+
+static size_t rx_cnt;
+static size_t rx_bytes;
+static size_t rx_invalid;
+
+static void receive_cb(const struct nrf_rpc_tr *transport, const uint8_t *packet, size_t len,
+		       void *context)
+{
+	/* Decode in place, the way nRF RPC does */
+	if (packet[0] != (uint8_t)len || packet[len - 1] != (uint8_t)(len - 1)) {
+		rx_invalid++;
+	}
+
+	rx_cnt++;
+	rx_bytes += len;
+}
+
+/* Stands in for the serializer encoding a packet directly into the TX buffer */
+static void packet_encode(uint8_t *buf, size_t len)
+{
+	buf[0] = (uint8_t)len;
+
+	for (size_t i = 1; i < len; i++) {
+		buf[i] = (uint8_t)i;
+	}
+}
+
+static void packet_send(size_t len)
+{
+	size_t size = len;
+	uint8_t *buf = rpc_tr.api->tx_buf_alloc(&rpc_tr, &size);
+
+	zassert_not_null(buf);
+	packet_encode(buf, len);
+	zassert_ok(rpc_tr.api->send(&rpc_tr, buf, len));
+}
+
+static uint64_t packets_send_ns(size_t len)
+{
+#if defined(CONFIG_EXTERNAL_LIBC)
+	struct timespec start;
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+#else
+	uint32_t start = k_cycle_get_32();
+#endif
+
+	for (size_t i = 0; i < PACKET_CNT; i++) {
+		packet_send(len);
+	}
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC + end.tv_nsec - start.tv_nsec;
+#else
+	return k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+#endif
+}
+
+static void *setup(void)
+{
+	zassert_ok(rpc_tr.api->init(&rpc_tr, receive_cb, NULL));
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	rx_cnt = 0;
+	rx_bytes = 0;
+	rx_invalid = 0;
+	ipc_loopback_copied_reset();
+}
+
+ZTEST(nrf_rpc_ipc_benchmark, test_throughput)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(packet_sizes); i++) {
+		size_t len = packet_sizes[i];
+		uint64_t ns;
+
+		before(NULL);
+		ns = packets_send_ns(len);
+
+		zassert_equal(rx_cnt, PACKET_CNT);
+		zassert_equal(rx_invalid, 0);
+
+		if (IS_ENABLED(CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY)) {
+			zassert_equal(ipc_loopback_copied_get(), 0, "Packets copied");
+		} else {
+			zassert_equal(ipc_loopback_copied_get(), rx_bytes);
+		}
+
+		TC_PRINT("%4zu byte packets: %u ns per packet, %u kB/s, %zu bytes copied\n", len,
+			 (uint32_t)(ns / PACKET_CNT),
+			 (uint32_t)((uint64_t)rx_bytes * NSEC_PER_SEC / 1024 / MAX(ns, 1)),
+			 ipc_loopback_copied_get());
+	}
+}
+
+#if CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY
+ZTEST(nrf_rpc_ipc_benchmark, test_fallback_to_copy)
+{
+	uint8_t *bufs[CONFIG_NRF_RPC_IPC_SERVICE_ZERO_COPY_BUFS + 1];
+	size_t size = 64;
+
+	/* Hold more buffers than are available, the last one comes from the heap */
+	for (size_t i = 0; i < ARRAY_SIZE(bufs); i++) {
+		bufs[i] = rpc_tr.api->tx_buf_alloc(&rpc_tr, &size);
+		zassert_not_null(bufs[i]);
+		packet_encode(bufs[i], size);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(bufs); i++) {
+		zassert_ok(rpc_tr.api->send(&rpc_tr, bufs[i], size));
+	}
+
+	zassert_equal(rx_cnt, ARRAY_SIZE(bufs));
+	zassert_equal(rx_invalid, 0);
+	zassert_equal(ipc_loopback_copied_get(), size, "Only the heap buffer should be copied");
+}
+#endif
+
+ZTEST_SUITE(nrf_rpc_ipc_benchmark, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <sample_rate_converter.h>
+
+/* Every conversion is fed 10 ms frames */
+#define FRAME_DURATION_US  10000
+#define FRAME_CNT	   100
+#define OUTPUT_SAMPLES_MAX (CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX + 1)
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef int16_t sample_t;
+#define SAMPLE_AMPLITUDE 16000
+#else
+typedef int32_t sample_t;
+#define SAMPLE_AMPLITUDE 1000000000
+#endif
+
+struct conversion {
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+	const char *path;
+};
+
+static const struct conversion conversions[] = {
+	{ 48000, 24000, "fir decimate" },
+	{ 48000, 16000, "fir decimate" },
+	{ 24000, 48000, "fir interpolate" },
+	{ 16000, 48000, "fir interpolate" },
+	{ 44100, 48000, "polyphase" },
+	{ 48000, 44100, "polyphase" },
+	{ 32000, 48000, "polyphase" },
+	{ 48000, 32000, "polyphase" },
+};
+
+static struct sample_rate_converter_ctx conv_ctx;
+static sample_t input[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX];
+static sample_t output[OUTPUT_SAMPLES_MAX];
+
+static void input_fill(size_t samples)
+{
+	/* Triangle wave, cheap to generate and covers the full amplitude range */
+	int32_t step = SAMPLE_AMPLITUDE / (samples / 4);
+	int32_t value = 0;
+
+	for (size_t i = 0; i < samples; i++) {
+		input[i] = (sample_t)value;
+		value += step;
+		if (value >= SAMPLE_AMPLITUDE || value <= -SAMPLE_AMPLITUDE) {
+			step = -step;
+		}
+	}
+}
+
+ZTEST(sample_rate_converter_benchmark, test_cpu_per_frame)
+{
+	TC_PRINT("%u-bit samples, %d frames of 10 ms\n", (uint32_t)(sizeof(sample_t) * 8),
+		 FRAME_CNT);
+
+	for (size_t i = 0; i < ARRAY_SIZE(conversions); i++) {
+		const struct conversion *conv = &conversions[i];
+		size_t samples_in = conv->sample_rate_input / (USEC_PER_SEC / FRAME_DURATION_US);
+		uint32_t min = UINT32_MAX;
+		uint32_t max = 0;
+		uint64_t sum = 0;
+		size_t output_written;
+		int ret;
+
+		input_fill(samples_in);
+		sample_rate_converter_open(&conv_ctx);
+
+		for (size_t frame = 0; frame < FRAME_CNT; frame++) {
+			uint32_t start = k_cycle_get_32();
+
+			ret = sample_rate_converter_process(
+				&conv_ctx, SAMPLE_RATE_FILTER_SIMPLE, input,
+				samples_in * sizeof(sample_t), conv->sample_rate_input, output,
+				sizeof(output), &output_written, conv->sample_rate_output);
+
+			uint32_t cycles = k_cycle_get_32() - start;
+
+			zassert_ok(ret, "Conversion %u -> %u failed (%d)", conv->sample_rate_input,
+				   conv->sample_rate_output, ret);
+
+			/* The first frame includes the filter initialization */
+			if (frame == 0) {
+				continue;
+			}
+
+			min = MIN(min, cycles);
+			max = MAX(max, cycles);
+			sum += cycles;
+		}
+
+		uint32_t avg = (uint32_t)(sum / (FRAME_CNT - 1));
+		uint32_t avg_us = (uint32_t)k_cyc_to_us_floor64(avg);
+
+		TC_PRINT("%5u -> %5u (%s): min %u, avg %u, max %u cycles, %u us, %u.%02u %% CPU\n",
+			 conv->sample_rate_input, conv->sample_rate_output, conv->path, min, avg,
+			 max, avg_us, (avg_us * 100) / FRAME_DURATION_US,
+			 ((avg_us * 10000) / FRAME_DURATION_US) % 100);
+	}
+}
+
+ZTEST_SUITE(sample_rate_converter_benchmark, NULL, NULL, NULL, NULL, NULL);
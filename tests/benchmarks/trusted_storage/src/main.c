@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <psa/crypto.h>
+#include <psa/internal_trusted_storage.h>
+
+#if defined(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+#endif
+
+#define OP_CNT 2000
+#define PASS_CNT 20
+
+#define ASSET_SIZE 128
+#define PARTIAL_OFFSET 64
+#define PARTIAL_SIZE 16
+
+/* Assets read in turn. Up to four assets fit in the default cache size. */
+static const uint8_t asset_cnts[] = {1, 4, 8};
+
+#define ASSET_CNT_MAX 8
+#define ASSET_UID_BASE 0x1000
+#define WRITE_ONCE_UID 0x2000
+
+static uint8_t asset[ASSET_SIZE];
+
+static void assets_write(uint8_t cnt)
+{
+	for (uint8_t i = 0; i < cnt; i++) {
+		asset[0] = i;
+		zassert_equal(psa_its_set(ASSET_UID_BASE + i, sizeof(asset), asset,
+					  PSA_STORAGE_FLAG_NONE),
+			      PSA_SUCCESS);
+	}
+}
+
+static void assets_remove(void)
+{
+	for (uint8_t i = 0; i < ASSET_CNT_MAX; i++) {
+		(void)psa_its_remove(ASSET_UID_BASE + i);
+	}
+}
+
+static uint64_t now_ns(void)
+{
+#if defined(CONFIG_EXTERNAL_LIBC)
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+#else
+	return k_cyc_to_ns_floor64(k_cycle_get_64());
+#endif
+}
+
+static uint64_t assets_read_ns(uint8_t cnt, size_t offset, size_t size)
+{
+	uint8_t buf[ASSET_SIZE];
+	uint64_t start = now_ns();
+
+	for (uint32_t i = 0; i < OP_CNT; i++) {
+		size_t len;
+
+		zassert_equal(psa_its_get(ASSET_UID_BASE + i % cnt, offset, size, buf, &len),
+			      PSA_SUCCESS);
+		zassert_equal(len, size);
+	}
+
+	return now_ns() - start;
+}
+
+static uint64_t assets_write_ns(uint8_t cnt)
+{
+	uint64_t start = now_ns();
+
+	for (uint32_t i = 0; i < OP_CNT; i++) {
+		zassert_equal(psa_its_set(ASSET_UID_BASE + i % cnt, sizeof(asset), asset,
+					  PSA_STORAGE_FLAG_NONE),
+			      PSA_SUCCESS);
+	}
+
+	return now_ns() - start;
+}
+
+static void result_print(const char *name, uint8_t cnt, uint64_t min, uint64_t sum, uint64_t max)
+{
+	TC_PRINT("%-8s %u assets: min %u, avg %u, max %u ns, %u operations per second\n", name,
+		 cnt, (uint32_t)min, (uint32_t)(sum / PASS_CNT), (uint32_t)max,
+		 (uint32_t)(NSEC_PER_SEC * PASS_CNT / MAX(1, sum)));
+}
+
+ZTEST(trusted_storage_benchmark, test_get_set)
+{
+	TC_PRINT("Cache %s, %d operations, %d byte assets\n",
+		 IS_ENABLED(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CACHE) ? "enabled" : "disabled",
+		 OP_CNT, ASSET_SIZE);
+
+	for (size_t i = 0; i < ARRAY_SIZE(asset_cnts); i++) {
+		uint64_t min[3] = {UINT64_MAX, UINT64_MAX, UINT64_MAX};
+		uint64_t max[3] = {};
+		uint64_t sum[3] = {};
+
+		assets_remove();
+		assets_write(asset_cnts[i]);
+
+		for (size_t pass = 0; pass < PASS_CNT; pass++) {
+			uint64_t ns[3] = {
+				assets_read_ns(asset_cnts[i], 0, ASSET_SIZE) / OP_CNT,
+				assets_read_ns(asset_cnts[i], PARTIAL_OFFSET, PARTIAL_SIZE) / OP_CNT,
+				assets_write_ns(asset_cnts[i]) / OP_CNT,
+			};
+
+			for (size_t j = 0; j < ARRAY_SIZE(ns); j++) {
+				min[j] = MIN(min[j], ns[j]);
+				max[j] = MAX(max[j], ns[j]);
+				sum[j] += ns[j];
+			}
+		}
+
+		result_print("get", asset_cnts[i], min[0], sum[0], max[0]);
+		result_print("get part", asset_cnts[i], min[1], sum[1], max[1]);
+		result_print("set", asset_cnts[i], min[2], sum[2], max[2]);
+	}
+
+	assets_remove();
+}
+
+ZTEST(trusted_storage_benchmark, test_consistency)
+{
+	struct psa_storage_info_t info;
+	uint8_t buf[ASSET_SIZE];
+	size_t len;
+
+	/* Read back after every write, also after the assets have been evicted
+	 * from the cache.
+	 */
+	for (uint8_t round = 0; round < 3; round++) {
+		for (uint8_t i = 0; i < ASSET_CNT_MAX; i++) {
+			memset(asset, round * ASSET_CNT_MAX + i, sizeof(asset));
+			zassert_equal(psa_its_set(ASSET_UID_BASE + i, sizeof(asset) - i, asset,
+						  PSA_STORAGE_FLAG_NONE),
+				      PSA_SUCCESS);
+		}
+
+		for (uint8_t i = 0; i < ASSET_CNT_MAX; i++) {
+			zassert_equal(psa_its_get_info(ASSET_UID_BASE + i, &info), PSA_SUCCESS);
+			zassert_equal(info.size, sizeof(asset) - i);
+
+			zassert_equal(psa_its_get(ASSET_UID_BASE + i, 0, sizeof(buf), buf, &len),
+				      PSA_SUCCESS);
+			zassert_equal(len, sizeof(asset) - i);
+			zassert_equal(buf[len - 1], round * ASSET_CNT_MAX + i);
+		}
+	}
+
+	assets_remove();
+
+	zassert_equal(psa_its_get(ASSET_UID_BASE, 0, sizeof(buf), buf, &len),
+		      PSA_ERROR_DOES_NOT_EXIST);
+	zassert_equal(psa_its_get_info(ASSET_UID_BASE, &info), PSA_ERROR_DOES_NOT_EXIST);
+
+	/* Write once assets can not be changed or removed. */
+	zassert_equal(psa_its_set(WRITE_ONCE_UID, sizeof(asset), asset,
+				  PSA_STORAGE_FLAG_WRITE_ONCE),
+		      PSA_SUCCESS);
+	zassert_equal(psa_its_set(WRITE_ONCE_UID, sizeof(asset), asset, PSA_STORAGE_FLAG_NONE),
+		      PSA_ERROR_NOT_PERMITTED);
+	zassert_equal(psa_its_remove(WRITE_ONCE_UID), PSA_ERROR_NOT_PERMITTED);
+}
+
+static void *trusted_storage_benchmark_setup(void)
+{
+	zassert_equal(psa_crypto_init(), PSA_SUCCESS);
+
+	return NULL;
+}
+
+ZTEST_SUITE(trusted_storage_benchmark, NULL, trusted_storage_benchmark_setup, NULL, NULL, NULL);
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#include "storage_backend.h"
+
+/* Custom storage backend keeping the stored objects in RAM. */
+
+#define OBJECT_CNT 16
+#define OBJECT_SIZE_MAX 512
+#define PREFIX_LEN_MAX 8
+
+static struct ram_object {
+	psa_storage_uid_t uid;
+	char prefix[PREFIX_LEN_MAX];
+	size_t size;
+	uint8_t data[OBJECT_SIZE_MAX];
+} objects[OBJECT_CNT];
+
+static struct ram_object *object_find(const psa_storage_uid_t uid, const char *prefix)
+{
+	for (size_t i = 0; i < OBJECT_CNT; i++) {
+		if (objects[i].uid == uid && strcmp(objects[i].prefix, prefix) == 0) {
+			return &objects[i];
+		}
+	}
+
+	return NULL;
+}
+
+psa_status_t storage_get_object(const psa_storage_uid_t uid, const char *prefix, void *object_data,
+				const size_t object_size, size_t *object_length)
+{
+	struct ram_object *object = object_find(uid, prefix);
+
+	if (!object) {
+		return PSA_ERROR_DOES_NOT_EXIST;
+	}
+
+	*object_length = MIN(object_size, object->size);
+	memcpy(object_data, object->data, *object_length);
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t storage_set_object(const psa_storage_uid_t uid, const char *prefix,
+				const void *object_data, const size_t object_size)
+{
+	struct ram_object *object = object_find(uid, prefix);
+
+	if (object_size > OBJECT_SIZE_MAX || strlen(prefix) >= PREFIX_LEN_MAX) {
+		return PSA_ERROR_INSUFFICIENT_STORAGE;
+	}
+
+	if (!object) {
+		/* UID 0 is invalid, and marks a free object. */
+		object = object_find(0, "");
+		if (!object) {
+			return PSA_ERROR_INSUFFICIENT_STORAGE;
+		}
+	}
+
+	object->uid = uid;
+	strcpy(object->prefix, prefix);
+	object->size = object_size;
+	memcpy(object->data, object_data, object_size);
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t storage_remove_object(const psa_storage_uid_t uid, const char *prefix)
+{
+	struct ram_object *object = object_find(uid, prefix);
+
+	if (!object) {
+		return PSA_ERROR_DOES_NOT_EXIST;
+	}
+
+	memset(object, 0, sizeof(*object));
+
+	return PSA_SUCCESS;
+}
@@ -2190,4 +2190,152 @@ ZTEST(at_parser, test_at_parser_cmd_next)
 	zassert_equal(num, 6);
 }
 
+ZTEST(at_parser, test_at_parser_cmd_next_rewind_empty)
+{
+	int ret;
+	struct at_parser parser;
+	int32_t num = 0;
+
+	const char *str1 = "+NOTIF: 1,2,,\r\n+NOTIF2: 4,5\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	/* The value at index 3 is followed by an empty value. */
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -ENODATA);
+
+	/* Rewind the parser. */
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 1);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 5);
+}
+
+ZTEST(at_parser, test_at_parser_indexed_init_einval)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[4];
+
+	const char *str1 = "+NOTIF: 1,2,3\r\nOK\r\n";
+
+	ret = at_parser_indexed_init(NULL, str1, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_indexed_init(&parser, NULL, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_indexed_init(&parser, str1, NULL, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_indexed_init(&parser, str1, tokens, 0);
+	zassert_equal(ret, -EINVAL);
+}
+
+ZTEST(at_parser, test_at_parser_indexed)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[8];
+	int32_t num = 0;
+	size_t count = 0;
+	char buffer[16];
+	size_t len;
+
+	const char *str1 = "+NOTIF: 1,\"abc\",,4\r\n"
+			   "+NOTIF2: 5,6\r\n"
+			   "OK\r\n";
+
+	ret = at_parser_indexed_init(&parser, str1, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 4, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 4);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 1);
+
+	len = sizeof(buffer);
+	ret = at_parser_string_get(&parser, 2, buffer, &len);
+	zassert_ok(ret);
+	zassert_str_equal(buffer, "abc");
+
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_equal(ret, -EOPNOTSUPP);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -ENODATA);
+
+	ret = at_parser_num_get(&parser, 5, &num);
+	zassert_equal(ret, -EAGAIN);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_ok(ret);
+	zassert_equal(count, 5);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_ok(ret);
+
+	len = sizeof(buffer);
+	ret = at_parser_string_get(&parser, 0, buffer, &len);
+	zassert_ok(ret);
+	zassert_str_equal(buffer, "+NOTIF2");
+
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 6);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -EIO);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_equal(ret, -EOPNOTSUPP);
+}
+
+ZTEST(at_parser, test_at_parser_indexed_tokens_full)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[2];
+	int32_t num = 0;
+	size_t count = 0;
+
+	const char *str1 = "+NOTIF: 1,2,3,4\r\n"
+			   "+NOTIF2: 5,6,7\r\n";
+
+	ret = at_parser_indexed_init(&parser, str1, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+
+	/* The values that do not fit in the array are still available. */
+	for (int32_t i = 4; i > 0; i--) {
+		ret = at_parser_num_get(&parser, i, &num);
+		zassert_ok(ret);
+		zassert_equal(num, i);
+	}
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_ok(ret);
+	zassert_equal(count, 5);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 7);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 5);
+}
+
 ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
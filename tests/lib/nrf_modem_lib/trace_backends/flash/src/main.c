@@ -12,9 +12,16 @@
 #include <zephyr/drivers/flash.h>
 
 #include <modem/trace_backend.h>
+#include <modem/nrf_modem_lib_trace.h>
 
 extern int unity_main(void);
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WRITE_THREAD)
+#define RAM_BUF_SIZE (2 * CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE)
+#else
+#define RAM_BUF_SIZE CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE
+#endif
+
 extern struct nrf_modem_lib_trace_backend trace_backend;
 
 /* The flash backend expects this semaphore to exist */
@@ -105,7 +112,8 @@ void test_basic_write_and_size(void)
 void test_write_more_than_flash_partition_size(void)
 {
 	int ret;
-	static uint8_t data[CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_PARTITION_SIZE + 400];
+	static uint8_t data[CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_PARTITION_SIZE +
+			    4 * RAM_BUF_SIZE];
 	uint8_t read_buffer[1024];
 	size_t data_available;
 
@@ -123,11 +131,13 @@ void test_write_more_than_flash_partition_size(void)
 
 	data_available = trace_backend.data_size();
 	TEST_ASSERT_EQUAL(ret, data_available); /* Available should match what was written */
-	TEST_ASSERT_TRUE(data_available <= CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_PARTITION_SIZE);
-	/* Should retain at least 70% of partition size to be useful */
+	/* The traces in the RAM buffer come on top of the partition */
+	TEST_ASSERT_TRUE(data_available <
+			 CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_PARTITION_SIZE + RAM_BUF_SIZE);
+	/* Sectors are filled to the end, so nearly all of the partition is used */
 	TEST_ASSERT_TRUE(
 		data_available >=
-		(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_PARTITION_SIZE * 7) / 10);
+		(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_PARTITION_SIZE * 9) / 10);
 
 	/* Verify we can actually read the data back */
 	ret = trace_backend.read(read_buffer, sizeof(read_buffer));
@@ -612,6 +622,96 @@ void test_read_small_amount_of_data_multiple_times(void)
 	TEST_ASSERT_EQUAL(-EFAULT, ret);
 }
 
+/* Test that traces split to fill the end of each sector are read back in order */
+void test_read_back_full_partition(void)
+{
+	int ret;
+	uint8_t data[100];
+	uint8_t read_buf[256];
+	size_t written = 0;
+	size_t read_total = 0;
+
+	ret = trace_backend.init(processed_cb);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	/* Odd sized fragments, until the partition is full */
+	do {
+		for (size_t i = 0; i < sizeof(data); i++) {
+			data[i] = (uint8_t)((written + i) % 251);
+		}
+
+		ret = trace_backend.write(data, sizeof(data));
+		TEST_ASSERT_TRUE(ret >= 0 || ret == -ENOSPC);
+
+		if (ret > 0) {
+			written += ret;
+		}
+	} while (ret == sizeof(data));
+
+	TEST_ASSERT_TRUE(written >
+			 CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_PARTITION_SIZE * 9 / 10);
+	TEST_ASSERT_EQUAL(written, trace_backend.data_size());
+
+	while (read_total < written) {
+		ret = trace_backend.read(read_buf, sizeof(read_buf));
+		TEST_ASSERT_TRUE(ret > 0);
+
+		for (size_t j = 0; j < (size_t)ret; j++) {
+			TEST_ASSERT_EQUAL_HEX8((read_total + j) % 251, read_buf[j]);
+		}
+
+		read_total += ret;
+	}
+
+	TEST_ASSERT_EQUAL(written, read_total);
+	TEST_ASSERT_EQUAL(0, trace_backend.data_size());
+}
+
+/* Test that the statistics account for the traces written to flash */
+void test_stats(void)
+{
+	int ret;
+	static uint8_t data[4 * CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE + 100];
+	struct nrf_modem_lib_trace_flash_stats before;
+	struct nrf_modem_lib_trace_flash_stats after;
+	uint32_t stored;
+
+	ret = nrf_modem_lib_trace_flash_stats_get(NULL);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+
+	ret = trace_backend.init(processed_cb);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ret = nrf_modem_lib_trace_flash_stats_get(&before);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	memset(data, 0x5A, sizeof(data));
+
+	ret = trace_backend.write(data, sizeof(data));
+	TEST_ASSERT_EQUAL(sizeof(data), ret);
+
+	/* Write the rest of the RAM buffer */
+	ret = trace_backend.deinit();
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ret = nrf_modem_lib_trace_flash_stats_get(&after);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	stored = after.bytes_stored - before.bytes_stored;
+	TEST_ASSERT_EQUAL(sizeof(data), stored);
+
+	/* A few bytes of headers for each entry of up to a buffer size */
+	TEST_ASSERT_TRUE(after.flash_bytes_written - before.flash_bytes_written > stored);
+	TEST_ASSERT_TRUE((after.flash_bytes_written - before.flash_bytes_written) * 100 <
+			 stored * 101);
+
+	TEST_ASSERT_EQUAL(before.sectors_erased, after.sectors_erased);
+	TEST_ASSERT_EQUAL(before.bytes_dropped, after.bytes_dropped);
+
+	ret = trace_backend.init(processed_cb);
+	TEST_ASSERT_EQUAL(0, ret);
+}
+
 int main(void)
 {
 	(void)unity_main();
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <pcm_mix.h>
+
+#include "pcm_mix_ref.h"
+
+/* 10 ms of 48 kHz stereo audio, 32-bit samples at most */
+#define FRAMES		480
+#define BUF_SIZE	(FRAMES * 2 * sizeof(int32_t))
+#define ITERATIONS	20
+
+static uint8_t buf_a[BUF_SIZE];
+static uint8_t buf_a_ref[BUF_SIZE];
+static uint8_t buf_b[BUF_SIZE];
+static uint32_t rand_state = 1;
+
+static const char *const mode_names[] = {
+	[B_STEREO_INTO_A_STEREO] = "stereo->stereo",
+	[B_MONO_INTO_A_MONO] = "mono->mono",
+	[B_MONO_INTO_A_STEREO_LR] = "mono->stereo LR",
+	[B_MONO_INTO_A_STEREO_L] = "mono->stereo L",
+	[B_MONO_INTO_A_STEREO_R] = "mono->stereo R",
+};
+
+static void buf_fill_random(uint8_t *buf, size_t size)
+{
+	for (size_t i = 0; i < size; i++) {
+		/* Simple LCG, loud enough to clip frequently */
+		rand_state = rand_state * 1103515245 + 12345;
+		buf[i] = rand_state >> 16;
+	}
+}
+
+static size_t size_b_get(enum pcm_mix_mode mode, uint8_t bit_depth)
+{
+	size_t frames_size = FRAMES * (bit_depth / 8);
+
+	return (mode == B_STEREO_INTO_A_STEREO) ? frames_size * 2 : frames_size;
+}
+
+static size_t size_a_get(enum pcm_mix_mode mode, uint8_t bit_depth)
+{
+	size_t frames_size = FRAMES * (bit_depth / 8);
+
+	return (mode == B_MONO_INTO_A_MONO) ? frames_size : frames_size * 2;
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_match_reference)
+{
+	static const uint8_t bit_depths[] = { 16, 24, 32 };
+
+	for (size_t i = 0; i < ARRAY_SIZE(bit_depths); i++) {
+		for (int mode = 0; mode < ARRAY_SIZE(mode_names); mode++) {
+			size_t size_a = size_a_get(mode, bit_depths[i]);
+			size_t size_b = size_b_get(mode, bit_depths[i]);
+
+			buf_fill_random(buf_a, size_a);
+			buf_fill_random(buf_b, size_b);
+			memcpy(buf_a_ref, buf_a, size_a);
+
+			zassert_ok(pcm_mix_ext(buf_a, size_a, buf_b, size_b, mode,
+					       bit_depths[i]));
+			pcm_mix_ref(buf_a_ref, buf_b, size_b, mode, bit_depths[i]);
+
+			zassert_mem_equal(buf_a, buf_a_ref, size_a,
+					  "Mismatch for %u-bit %s", bit_depths[i],
+					  mode_names[mode]);
+		}
+	}
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_throughput)
+{
+	static const uint8_t bit_depths[] = { 16, 24, 32 };
+
+	TC_PRINT("Cycles per 10 ms block (%d frames), reference vs library:\n", FRAMES);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bit_depths); i++) {
+		for (int mode = 0; mode < ARRAY_SIZE(mode_names); mode++) {
+			size_t size_a = size_a_get(mode, bit_depths[i]);
+			size_t size_b = size_b_get(mode, bit_depths[i]);
+			uint64_t ref_cycles = 0;
+			uint64_t lib_cycles = 0;
+
+			buf_fill_random(buf_b, size_b);
+
+			for (int iter = 0; iter < ITERATIONS; iter++) {
+				uint32_t start;
+
+				buf_fill_random(buf_a, size_a);
+				start = k_cycle_get_32();
+				pcm_mix_ref(buf_a, buf_b, size_b, mode, bit_depths[i]);
+				ref_cycles += k_cycle_get_32() - start;
+
+				buf_fill_random(buf_a, size_a);
+				start = k_cycle_get_32();
+				(void)pcm_mix_ext(buf_a, size_a, buf_b, size_b, mode,
+						  bit_depths[i]);
+				lib_cycles += k_cycle_get_32() - start;
+			}
+
+			TC_PRINT("%2u-bit %-16s ref %8u lib %8u\n", bit_depths[i],
+				 mode_names[mode], (uint32_t)(ref_cycles / ITERATIONS),
+				 (uint32_t)(lib_cycles / ITERATIONS));
+		}
+	}
+}
+
+ZTEST_SUITE(suite_pcm_mix_benchmark, NULL, NULL, NULL, NULL, NULL);
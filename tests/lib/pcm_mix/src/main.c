@@ -127,4 +127,63 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_mix_24_bit)
+{
+	int ret;
+	/* Packed 24-bit samples: 0x7FFFFF + 1, -0x800000 - 1, 0x000010 + -0x000001 */
+	uint8_t sample_a[] = { 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00 };
+	uint8_t sample_b[] = { 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+	uint8_t sample_r[] = { 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00 };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_MONO, 24);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_32_bit)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX, INT32_MIN, 100, 100 };
+	int32_t sample_b[] = { 1, -1 };
+	int32_t sample_r[] = { INT32_MAX, INT32_MIN + 1, 99, 99 };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_STEREO_LR, 32);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_illegal_bit_depth)
+{
+	int ret;
+	int16_t sample_a[] = { 0, 1, 2 };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_a, sizeof(sample_a),
+			  B_MONO_INTO_A_MONO, 8);
+	ZEQ(ret, -EINVAL);
+
+	/* Size not a multiple of the 32-bit sample size */
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_a, sizeof(sample_a),
+			  B_MONO_INTO_A_MONO, 32);
+	ZEQ(ret, -EINVAL);
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_size_check)
+{
+	int ret;
+	int16_t sample_a[] = { 10, 10, 10, 10 };
+	int16_t sample_b[] = { -5, 5, 5 };
+	int16_t sample_r[] = { 10, 10, 10, 10 };
+
+	/* Buffer A must not be modified if it is too small */
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_L);
+	ZEQ(ret, -EPERM);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "pcm_mix_ref.h"
+
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+static int32_t sample_get(const uint8_t *p, uint8_t bit_depth)
+{
+	int32_t v = 0;
+
+	memcpy(&v, p, bit_depth / 8);
+
+	/* Sign extend */
+	return (int32_t)((uint32_t)v << (32 - bit_depth)) >> (32 - bit_depth);
+}
+
+static void sample_set(uint8_t *p, uint8_t bit_depth, int32_t v)
+{
+	memcpy(p, &v, bit_depth / 8);
+}
+
+static int32_t hard_limiter(int64_t v, uint8_t bit_depth)
+{
+	int64_t max = (int64_t)BIT64(bit_depth - 1) - 1;
+	int64_t min = -max - 1;
+
+	if (v < min) {
+		return (int32_t)min;
+	} else if (v > max) {
+		return (int32_t)max;
+	}
+
+	return (int32_t)v;
+}
+
+static void mix_sample(uint8_t *pcm_a, size_t idx_a, int32_t b, uint8_t bit_depth)
+{
+	uint8_t *a = &pcm_a[idx_a * (bit_depth / 8)];
+
+	sample_set(a, bit_depth, hard_limiter((int64_t)sample_get(a, bit_depth) + b, bit_depth));
+}
+
+void pcm_mix_ref(void *pcm_a, void const *pcm_b, size_t size_b, enum pcm_mix_mode mix_mode,
+		 uint8_t pcm_bit_depth)
+{
+	size_t samples = size_b / (pcm_bit_depth / 8);
+
+	for (size_t i = 0; i < samples; i++) {
+		int32_t b = sample_get(&((const uint8_t *)pcm_b)[i * (pcm_bit_depth / 8)],
+				       pcm_bit_depth);
+
+		switch (mix_mode) {
+		case B_STEREO_INTO_A_STEREO:
+		case B_MONO_INTO_A_MONO:
+			mix_sample(pcm_a, i, b, pcm_bit_depth);
+			break;
+		case B_MONO_INTO_A_STEREO_LR:
+			mix_sample(pcm_a, i * 2, b, pcm_bit_depth);
+			mix_sample(pcm_a, i * 2 + 1, b, pcm_bit_depth);
+			break;
+		case B_MONO_INTO_A_STEREO_L:
+			mix_sample(pcm_a, i * 2, b, pcm_bit_depth);
+			break;
+		case B_MONO_INTO_A_STEREO_R:
+			mix_sample(pcm_a, i * 2 + 1, b, pcm_bit_depth);
+			break;
+		}
+	}
+}
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PCM_MIX_REF_H_
+#define _PCM_MIX_REF_H_
+
+#include <pcm_mix.h>
+
+/**
+ * @brief Sample by sample reference implementation of @ref pcm_mix_ext.
+ *
+ * Buffer sizes are not validated.
+ */
+void pcm_mix_ref(void *pcm_a, void const *pcm_b, size_t size_b, enum pcm_mix_mode mix_mode,
+		 uint8_t pcm_bit_depth);
+
+#endif /* _PCM_MIX_REF_H_ */
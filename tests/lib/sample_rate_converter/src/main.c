@@ -441,6 +441,109 @@ ZTEST(suite_sample_rate_converter, test_valid_process_input_two_samples_decimate
 
 	zassert_within(output_samples[0], input_samples[0] / 2, 1);
 }
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+#define POLYPHASE_DC_VALUE  10000
+#define POLYPHASE_FRAME_CNT 10
+
+static void polyphase_dc_frames_process(uint32_t input_sample_rate, uint32_t output_sample_rate)
+{
+	int ret;
+
+	/* 10 ms frames */
+	size_t num_samples = input_sample_rate / 100;
+	size_t expected_output_samples = output_sample_rate / 100;
+	int16_t input_samples[num_samples];
+	int16_t output_samples[expected_output_samples];
+	size_t output_written;
+
+	for (int i = 0; i < num_samples; i++) {
+		input_samples[i] = POLYPHASE_DC_VALUE;
+	}
+
+	for (int frame = 0; frame < POLYPHASE_FRAME_CNT; frame++) {
+		ret = sample_rate_converter_process(
+			&conv_ctx, SAMPLE_RATE_FILTER_SIMPLE, input_samples,
+			num_samples * sizeof(int16_t), input_sample_rate, output_samples,
+			sizeof(output_samples), &output_written, output_sample_rate);
+
+		zassert_equal(ret, 0, "Sample rate conversion process failed");
+		zassert_equal(conv_ctx.conversion_ratio, 0, "Polyphase filter not used");
+		zassert_equal(output_written, expected_output_samples * sizeof(int16_t),
+			      "Output size was not as expected (%d)", output_written);
+	}
+
+	/* Filter has settled, DC should pass with unity gain */
+	for (int i = 0; i < expected_output_samples; i++) {
+		zassert_within(output_samples[i], POLYPHASE_DC_VALUE, 10,
+			       "Sample %d not as expected (%d)", i, output_samples[i]);
+	}
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_44100_to_48000_16bit)
+{
+	polyphase_dc_frames_process(44100, 48000);
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_48000_to_44100_16bit)
+{
+	polyphase_dc_frames_process(48000, 44100);
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_32000_to_48000_16bit)
+{
+	polyphase_dc_frames_process(32000, 48000);
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_48000_to_32000_16bit)
+{
+	polyphase_dc_frames_process(48000, 32000);
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_uneven_frames_16bit)
+{
+	int ret;
+
+	uint32_t input_sample_rate = 44100;
+	uint32_t output_sample_rate = 48000;
+
+	/* 441 input samples will be given in uneven chunks, and must give 480 output samples */
+	size_t chunk_sizes[] = {100, 1, 7, 200, 133};
+	int16_t input_samples[200] = {0};
+	int16_t output_samples[220];
+	size_t output_written;
+	size_t output_total = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(chunk_sizes); i++) {
+		ret = sample_rate_converter_process(
+			&conv_ctx, SAMPLE_RATE_FILTER_SIMPLE, input_samples,
+			chunk_sizes[i] * sizeof(int16_t), input_sample_rate, output_samples,
+			sizeof(output_samples), &output_written, output_sample_rate);
+
+		zassert_equal(ret, 0, "Sample rate conversion process failed");
+		output_total += output_written;
+	}
+
+	zassert_equal(output_total, 480 * sizeof(int16_t), "Output size was not as expected (%d)",
+		      output_total);
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_output_buf_too_small_16bit)
+{
+	int ret;
+
+	int16_t input_samples[441] = {0};
+	/* 441 samples at 44.1 kHz gives 480 samples at 48 kHz */
+	int16_t output_samples[479];
+	size_t output_written;
+
+	ret = sample_rate_converter_process(
+		&conv_ctx, SAMPLE_RATE_FILTER_SIMPLE, input_samples, sizeof(input_samples), 44100,
+		output_samples, sizeof(output_samples), &output_written, 48000);
+
+	zassert_equal(ret, -EINVAL,
+		      "Sample rate conversion process did not fail when output buffer is to small");
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
 
 #if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
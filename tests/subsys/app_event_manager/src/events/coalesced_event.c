@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "coalesced_event.h"
+
+static uint32_t coalesced_event_key(const struct app_event_header *aeh)
+{
+	return cast_coalesced_event(aeh)->key;
+}
+
+APP_EVENT_TYPE_DEFINE_COALESCED(coalesced_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(),
+		  coalesced_event_key);
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _COALESCED_EVENT_H_
+#define _COALESCED_EVENT_H_
+
+/**
+ * @brief Coalesced Event
+ * @defgroup coalesced_event Coalesced Event
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct coalesced_event {
+	struct app_event_header header;
+
+	uint8_t key;
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(coalesced_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _COALESCED_EVENT_H_ */
@@ -6,6 +6,7 @@
 
 #include <zephyr/ztest.h>
 #include <app_event_manager.h>
+#include <app_event_manager_mem_pool.h>
 
 #include "sized_events.h"
 #include "test_events.h"
@@ -63,6 +64,21 @@ ZTEST(suite0, test_event_order)
 	test_start(TEST_EVENT_ORDER);
 }
 
+ZTEST(suite0, test_event_priority)
+{
+	test_start(TEST_EVENT_PRIORITY);
+}
+
+ZTEST(suite0, test_event_coalesce)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE)) {
+		ztest_test_skip();
+		return;
+	}
+
+	test_start(TEST_EVENT_COALESCE);
+}
+
 ZTEST(suite0, test_subs_order)
 {
 	test_start(TEST_SUBSCRIBER_ORDER);
@@ -179,6 +195,62 @@ ZTEST(suite0, test_event_size_disabled)
 	app_event_manager_free(ev_s1);
 }
 
+ZTEST(suite0, test_mem_pool)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL)) {
+		ztest_test_skip();
+		return;
+	}
+
+	struct app_event_manager_mem_pool_stats stats0;
+	struct app_event_manager_mem_pool_stats stats1;
+	struct app_event_manager_mem_pool_stats stats;
+	void *blocks[CONFIG_APP_EVENT_MANAGER_MEM_POOL_CLASS0_COUNT];
+	void *borrowed;
+	uint32_t fail_cnt = app_event_manager_mem_pool_fail_cnt();
+
+	zassert_ok(app_event_manager_mem_pool_stats_get(0, &stats0));
+	zassert_ok(app_event_manager_mem_pool_stats_get(1, &stats1));
+	zassert_equal(stats0.used_cnt, 0, "Memory pool not empty");
+
+	/* Exhaust the smallest size class. */
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		blocks[i] = app_event_manager_mem_pool_alloc(stats0.block_size);
+		zassert_not_null(blocks[i], "Allocation failed");
+	}
+
+	zassert_ok(app_event_manager_mem_pool_stats_get(0, &stats));
+	zassert_equal(stats.used_cnt, ARRAY_SIZE(blocks), "Unexpected number of used blocks");
+	zassert_equal(stats.max_used_cnt, ARRAY_SIZE(blocks), "Unexpected high-water mark");
+
+	/* Next allocation is served by the larger size class. */
+	borrowed = app_event_manager_mem_pool_alloc(stats0.block_size);
+	zassert_not_null(borrowed, "Allocation failed");
+	zassert_ok(app_event_manager_mem_pool_stats_get(0, &stats));
+	zassert_equal(stats.borrow_cnt, stats0.borrow_cnt + 1, "Borrow not recorded");
+	zassert_ok(app_event_manager_mem_pool_stats_get(1, &stats));
+	zassert_equal(stats.used_cnt, stats1.used_cnt + 1, "Larger size class not used");
+
+	app_event_manager_mem_pool_free(borrowed);
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		app_event_manager_mem_pool_free(blocks[i]);
+	}
+
+	zassert_ok(app_event_manager_mem_pool_stats_get(0, &stats));
+	zassert_equal(stats.used_cnt, 0, "Blocks not freed");
+	zassert_equal(stats.max_used_cnt, ARRAY_SIZE(blocks), "High-water mark not kept");
+	zassert_ok(app_event_manager_mem_pool_stats_get(1, &stats));
+	zassert_equal(stats.used_cnt, stats1.used_cnt, "Blocks not freed");
+
+	/* Request exceeding the largest size class. */
+	zassert_ok(app_event_manager_mem_pool_stats_get(
+		app_event_manager_mem_pool_class_cnt() - 1, &stats));
+	zassert_is_null(app_event_manager_mem_pool_alloc(stats.block_size + 1),
+			"Allocation unexpectedly succeeded");
+	zassert_equal(app_event_manager_mem_pool_fail_cnt(), fail_cnt + 1,
+		      "Failure not recorded");
+}
+
 ZTEST(suite0, test_name_style_events_sorting)
 {
 	test_start(TEST_NAME_STYLE_SORTING);
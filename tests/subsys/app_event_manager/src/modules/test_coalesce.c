@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "coalesced_event.h"
+
+#include "test_config.h"
+
+#define MODULE test_coalesce
+
+static uint32_t coalesced_cnt_start;
+static int received_cnt[TEST_COALESCE_KEY_CNT];
+
+
+static void submit_coalesced_event(uint8_t key, int val)
+{
+	struct coalesced_event *event = new_coalesced_event();
+
+	event->key = key;
+	event->val = val;
+	APP_EVENT_SUBMIT(event);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id != TEST_EVENT_COALESCE) {
+			return false;
+		}
+
+		memset(received_cnt, 0, sizeof(received_cnt));
+		coalesced_cnt_start =
+			app_event_manager_coalesced_cnt_get(APP_EVENT_ID(coalesced_event));
+
+		/* Events are not processed until this handler returns,
+		 * so only the last value of every key is delivered.
+		 */
+		for (int i = 0; i < TEST_COALESCE_EVENT_CNT; i++) {
+			for (uint8_t key = 0; key < TEST_COALESCE_KEY_CNT; key++) {
+				submit_coalesced_event(key, i);
+			}
+		}
+
+		return false;
+	}
+
+	if (is_coalesced_event(aeh)) {
+		struct coalesced_event *event = cast_coalesced_event(aeh);
+
+		zassert_true(event->key < TEST_COALESCE_KEY_CNT, "Invalid key");
+		zassert_equal(event->val, TEST_COALESCE_EVENT_CNT - 1, "Event not coalesced");
+		zassert_equal(received_cnt[event->key], 0, "Duplicated event");
+		received_cnt[event->key]++;
+
+		for (size_t i = 0; i < ARRAY_SIZE(received_cnt); i++) {
+			if (received_cnt[i] == 0) {
+				return false;
+			}
+		}
+
+		zassert_equal(app_event_manager_coalesced_cnt_get(APP_EVENT_ID(coalesced_event)) -
+			      coalesced_cnt_start,
+			      (TEST_COALESCE_EVENT_CNT - 1) * TEST_COALESCE_KEY_CNT,
+			      "Invalid number of coalesced events");
+
+		struct test_end_event *te = new_test_end_event();
+
+		te->test_id = TEST_EVENT_COALESCE;
+		APP_EVENT_SUBMIT(te);
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, coalesced_event);
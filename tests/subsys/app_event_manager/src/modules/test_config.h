@@ -23,6 +23,11 @@ extern "C" {
 
 #define TEST_EVENT_ORDER_CNT 20
 
+#define TEST_EVENT_PRIORITY_CNT 5
+
+#define TEST_COALESCE_EVENT_CNT 5
+#define TEST_COALESCE_KEY_CNT 3
+
 #ifdef __cplusplus
 }
 #endif
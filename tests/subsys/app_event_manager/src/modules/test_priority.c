@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "priority_events.h"
+
+#include "test_config.h"
+
+#define MODULE test_priority
+
+static int normal_cnt;
+static int high_cnt;
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id != TEST_EVENT_PRIORITY) {
+			return false;
+		}
+
+		normal_cnt = 0;
+		high_cnt = 0;
+
+		/* Normal priority events are submitted first, but must be
+		 * processed after the high priority events.
+		 */
+		for (size_t i = 0; i < TEST_EVENT_PRIORITY_CNT; i++) {
+			struct priority_normal_event *event = new_priority_normal_event();
+
+			event->val = i;
+			APP_EVENT_SUBMIT(event);
+		}
+
+		for (size_t i = 0; i < TEST_EVENT_PRIORITY_CNT; i++) {
+			struct priority_high_event *event = new_priority_high_event();
+
+			event->val = i;
+			APP_EVENT_SUBMIT(event);
+		}
+
+		return false;
+	}
+
+	if (is_priority_high_event(aeh)) {
+		struct priority_high_event *event = cast_priority_high_event(aeh);
+
+		zassert_equal(normal_cnt, 0, "Normal priority event processed first");
+		zassert_equal(event->val, high_cnt, "Incorrect high priority event order");
+		high_cnt++;
+
+		return false;
+	}
+
+	if (is_priority_normal_event(aeh)) {
+		struct priority_normal_event *event = cast_priority_normal_event(aeh);
+
+		zassert_equal(high_cnt, TEST_EVENT_PRIORITY_CNT,
+			      "High priority events not processed first");
+		zassert_equal(event->val, normal_cnt, "Incorrect normal priority event order");
+		normal_cnt++;
+
+		if (normal_cnt == TEST_EVENT_PRIORITY_CNT) {
+			struct test_end_event *te = new_test_end_event();
+
+			te->test_id = TEST_EVENT_PRIORITY;
+			APP_EVENT_SUBMIT(te);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, priority_normal_event);
+APP_EVENT_SUBSCRIBE(MODULE, priority_high_event);
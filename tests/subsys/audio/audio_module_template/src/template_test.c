@@ -61,6 +61,22 @@ DATA_FIFO_DEFINE(msg_fifo_tx3, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
 DATA_FIFO_DEFINE(msg_fifo_rx3, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
 K_MEM_SLAB_DEFINE(mod_data_slab, TEST_MOD_DATA_SIZE, TEST_MSG_QUEUE_SIZE, 4);
 
+#define TEST_FAN_OUT_MODULES_NUM (3)
+
+K_THREAD_STACK_ARRAY_DEFINE(mod_fan_out_stack, TEST_FAN_OUT_MODULES_NUM,
+			    TEST_MOD_THREAD_STACK_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_fan_out_tx0, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_fan_out_rx0, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_fan_out_tx1, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_fan_out_rx1, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_fan_out_tx2, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_fan_out_rx2, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+
+struct data_fifo *msg_fifo_fan_out_tx_array[TEST_FAN_OUT_MODULES_NUM] = {
+	&msg_fifo_fan_out_tx0, &msg_fifo_fan_out_tx1, &msg_fifo_fan_out_tx2};
+struct data_fifo *msg_fifo_fan_out_rx_array[TEST_FAN_OUT_MODULES_NUM] = {
+	&msg_fifo_fan_out_rx0, &msg_fifo_fan_out_rx1, &msg_fifo_fan_out_rx2};
+
 struct data_fifo *msg_fifo_tx_array[TEST_MODULES_NUM] = {&msg_fifo_tx0, &msg_fifo_tx1,
 							 &msg_fifo_tx2, &msg_fifo_tx3};
 struct data_fifo *msg_fifo_rx_array[TEST_MODULES_NUM] = {&msg_fifo_rx0, &msg_fifo_rx1,
@@ -309,3 +325,132 @@ ZTEST(suite_audio_module_template, test_module_template_stream)
 			      ret);
 	}
 }
+
+ZTEST(suite_audio_module_template, test_module_template_fan_out)
+{
+	int ret;
+	int i;
+	uint32_t slab_used;
+	char inst_name[CONFIG_AUDIO_MODULE_NAME_SIZE];
+
+	struct audio_data audio_data_tx;
+	struct audio_data audio_data_rx;
+
+	struct audio_module_parameters mod_parameters;
+
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = ORIGINAL_TEXT};
+
+	struct audio_module_template_context context = {0};
+
+	uint8_t test_data_in[TEST_MOD_DATA_SIZE];
+	uint8_t test_data_out[TEST_MOD_DATA_SIZE];
+
+	struct audio_module_handle handle[TEST_FAN_OUT_MODULES_NUM];
+
+	slab_used = k_mem_slab_num_used_get(&mod_data_slab);
+
+	for (i = 0; i < TEST_FAN_OUT_MODULES_NUM; i++) {
+		memset(&handle[i], 0, sizeof(struct audio_module_handle));
+
+		mod_parameters.description = audio_module_template_description;
+		mod_parameters.thread.stack = mod_fan_out_stack[i];
+		mod_parameters.thread.stack_size = TEST_MOD_THREAD_STACK_SIZE;
+		mod_parameters.thread.priority = TEST_MOD_THREAD_PRIORITY;
+		mod_parameters.thread.data_slab = &mod_data_slab;
+		mod_parameters.thread.data_size = TEST_MOD_DATA_SIZE;
+		mod_parameters.thread.msg_rx = msg_fifo_fan_out_rx_array[i];
+		mod_parameters.thread.msg_tx = msg_fifo_fan_out_tx_array[i];
+
+		ret = audio_module_open(
+			&mod_parameters,
+			(const struct audio_module_configuration *const)&configuration,
+			&inst_name[0], (struct audio_module_context *)&context, &handle[i]);
+		zassert_equal(ret, 0, "Open function did not return successfully (0): ret %d", ret);
+	}
+
+	/* The output of the first module is shared by the two other modules. */
+	for (i = 1; i < TEST_FAN_OUT_MODULES_NUM; i++) {
+		ret = audio_module_connect(&handle[0], &handle[i], false);
+		zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d",
+			      ret);
+
+		ret = audio_module_connect(&handle[i], NULL, true);
+		zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	for (i = 0; i < TEST_FAN_OUT_MODULES_NUM; i++) {
+		ret = audio_module_start(&handle[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	for (i = 0; i < TEST_AUDIO_DATA_ITEMS_NUM; i++) {
+		memset(test_data_in, i, sizeof(test_data_in));
+
+		audio_data_tx.data = (void *)test_data_in;
+		audio_data_tx.data_size = TEST_MOD_DATA_SIZE;
+		memcpy(&audio_data_tx.meta, &test_metadata, sizeof(struct audio_metadata));
+
+		ret = audio_module_data_tx(&handle[0], &audio_data_tx, NULL);
+		zassert_equal(ret, 0, "Data TX function did not return successfully (0): ret %d",
+			      ret);
+
+		for (int j = 1; j < TEST_FAN_OUT_MODULES_NUM; j++) {
+			memset(test_data_out, 0, sizeof(test_data_out));
+
+			audio_data_rx.data = (void *)test_data_out;
+			audio_data_rx.data_size = TEST_MOD_DATA_SIZE;
+
+			ret = audio_module_data_rx(&handle[j], &audio_data_rx,
+						   TEST_TX_RX_TIMEOUT_US);
+			zassert_equal(ret, 0,
+				      "Data RX function did not return successfully (0): ret %d",
+				      ret);
+			zassert_mem_equal(test_data_in, test_data_out, TEST_MOD_DATA_SIZE,
+					  "Failed to process data in module %d", j);
+		}
+
+		/* All data buffers must be returned once every module has consumed them. */
+		zassert_true(WAIT_FOR(k_mem_slab_num_used_get(&mod_data_slab) == slab_used,
+				      USEC_PER_SEC, k_msleep(1)),
+			     "Data buffers not released, %u in use",
+			     k_mem_slab_num_used_get(&mod_data_slab) - slab_used);
+	}
+
+#if CONFIG_AUDIO_MODULE_STATS
+	for (i = 0; i < TEST_FAN_OUT_MODULES_NUM; i++) {
+		struct audio_module_stats stats;
+
+		ret = audio_module_stats_get(&handle[i], &stats);
+		zassert_equal(ret, 0, "Stats get function did not return successfully (0): ret %d",
+			      ret);
+		zassert_equal(stats.data_count, TEST_AUDIO_DATA_ITEMS_NUM,
+			      "Module %d processed %u audio data items, expected %d", i,
+			      stats.data_count, TEST_AUDIO_DATA_ITEMS_NUM);
+		zassert_true(stats.process_cycles_max >= stats.process_cycles_last,
+			     "Maximum processing time less than the last");
+		zassert_true(stats.latency_cycles_max >= stats.latency_cycles_last,
+			     "Maximum latency less than the last");
+
+		ret = audio_module_stats_reset(&handle[i]);
+		zassert_equal(ret, 0,
+			      "Stats reset function did not return successfully (0): ret %d", ret);
+
+		ret = audio_module_stats_get(&handle[i], &stats);
+		zassert_equal(ret, 0, "Stats get function did not return successfully (0): ret %d",
+			      ret);
+		zassert_equal(stats.data_count, 0, "Stats not reset");
+	}
+#endif /* CONFIG_AUDIO_MODULE_STATS */
+
+	for (i = 0; i < TEST_FAN_OUT_MODULES_NUM; i++) {
+		ret = audio_module_stop(&handle[i]);
+		zassert_equal(ret, 0, "Stop function did not return successfully (0): ret %d", ret);
+
+		ret = audio_module_close(&handle[i]);
+		zassert_equal(ret, 0, "Close function did not return successfully (0): ret %d",
+			      ret);
+	}
+}
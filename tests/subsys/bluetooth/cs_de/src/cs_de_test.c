@@ -9,12 +9,27 @@
 #include <string.h>
 #include <math.h>
 
+#include <zephyr/bluetooth/hci_types.h>
+#include <zephyr/sys/byteorder.h>
 #include <bluetooth/cs_de.h>
 
 #define NUM_CHANNELS (75)
 #define CHANNEL_SPACING_HZ  (1e6f)
 #define PI (3.14159265358979f)
 #define SPEED_OF_LIGHT_M_PER_S (299792458.0f)
+#define CHANNEL_INDEX_OFFSET (2)
+
+/* The fixed-point IFFT loses some accuracy in the peak interpolation. */
+#if CONFIG_BT_CS_DE_IFFT_Q15
+#define IFFT_TOLERANCE_M (0.02f)
+#else
+#define IFFT_TOLERANCE_M (0.01f)
+#endif
+
+/* Mode 2 step data with one antenna path and the tone extension slot. */
+#define STEP_DATA_MODE_2_LEN                                                                       \
+	(sizeof(struct bt_hci_le_cs_step_data_mode_2) +                                            \
+	 2 * sizeof(struct bt_hci_le_cs_step_data_tone_info))
 
 /* The unity_main is not declared in any header file. It is only defined in the generated test
  * runner because of ncs' unity configuration. It is therefore declared here to avoid a compiler
@@ -35,6 +50,39 @@ static void generate_ideal_iq_data(float distance, cs_de_iq_tones_t *iq_tones)
 	}
 }
 
+static void encode_tone(struct bt_hci_le_cs_step_data_tone_info *tone_info, int16_t i, int16_t q)
+{
+	sys_put_le24((i & 0xFFF) | ((q & 0xFFF) << 12), tone_info->phase_correction_term);
+	tone_info->quality_indicator = BT_HCI_LE_CS_TONE_QUALITY_HIGH;
+}
+
+/* Add a mode 2 step where the local and remote tones are offset by -offset and +offset. */
+static void add_mode_2_step(cs_de_report_t *report, uint8_t channel, int16_t i, int16_t q,
+			    int16_t offset)
+{
+	uint8_t local_data[STEP_DATA_MODE_2_LEN] = {};
+	uint8_t peer_data[STEP_DATA_MODE_2_LEN] = {};
+	struct bt_le_cs_subevent_step local_step = {
+		.mode = BT_HCI_OP_LE_CS_MAIN_MODE_2,
+		.channel = channel,
+		.data_len = sizeof(local_data),
+		.data = local_data,
+	};
+	struct bt_le_cs_subevent_step peer_step = {
+		.mode = BT_HCI_OP_LE_CS_MAIN_MODE_2,
+		.channel = channel,
+		.data_len = sizeof(peer_data),
+		.data = peer_data,
+	};
+
+	encode_tone(&((struct bt_hci_le_cs_step_data_mode_2 *)local_data)->tone_info[0],
+		    i - offset, q - offset);
+	encode_tone(&((struct bt_hci_le_cs_step_data_mode_2 *)peer_data)->tone_info[0],
+		    i + offset, q + offset);
+
+	cs_de_report_step_add(report, &local_step, &peer_step);
+}
+
 void test_cs_de_calc_empty_report(void)
 {
 	cs_de_report_t test_report;
@@ -86,7 +134,7 @@ void test_cs_de_calc_with_ideal_iq_data(void)
 				/* Verify that the estimated distance is within 1 cm of the distance
 				 * used to generate the ideal IQ data.
 				 */
-				TEST_ASSERT_FLOAT_WITHIN(0.01f,
+				TEST_ASSERT_FLOAT_WITHIN(IFFT_TOLERANCE_M,
 					distance,
 					test_report.distance_estimates[ap].ifft);
 				TEST_ASSERT_FLOAT_WITHIN(0.01f,
@@ -99,6 +147,61 @@ void test_cs_de_calc_with_ideal_iq_data(void)
 	}
 }
 
+void test_cs_de_report_incremental(void)
+{
+	static cs_de_report_t test_report;
+	uint8_t channel_map[10];
+
+	memset(channel_map, 0xFF, sizeof(channel_map));
+
+	cs_de_report_init(&test_report, BT_CONN_LE_CS_ROLE_INITIATOR, 1);
+
+	/* Two subevents covering every channel, the tones average to (10 * i, -5 * i). */
+	for (int subevent = 0; subevent < 2; subevent++) {
+		int16_t offset = (subevent == 0) ? 7 : -7;
+
+		for (uint8_t i = 0; i < NUM_CHANNELS; i++) {
+			add_mode_2_step(&test_report, i + CHANNEL_INDEX_OFFSET, 10 * i, -5 * i,
+					offset + i % 3);
+			add_mode_2_step(&test_report, i + CHANNEL_INDEX_OFFSET, 10 * i, -5 * i,
+					-offset - i % 3);
+		}
+	}
+
+	cs_de_report_finalize(&test_report, channel_map);
+
+	TEST_ASSERT_EQUAL(1, test_report.n_ap);
+	TEST_ASSERT_EQUAL(CS_DE_TONE_QUALITY_OK, test_report.tone_quality[0]);
+	TEST_ASSERT_TRUE(isnan(test_report.distance_estimates[0].best));
+
+	for (uint8_t i = 0; i < NUM_CHANNELS; i++) {
+		TEST_ASSERT_EQUAL(4, test_report.n_iqs[0][i]);
+		TEST_ASSERT_EQUAL_FLOAT(10.0f * i, test_report.iq_tones[0].i_local[i]);
+		TEST_ASSERT_EQUAL_FLOAT(-5.0f * i, test_report.iq_tones[0].q_local[i]);
+		TEST_ASSERT_EQUAL_FLOAT(10.0f * i, test_report.iq_tones[0].i_remote[i]);
+		TEST_ASSERT_EQUAL_FLOAT(-5.0f * i, test_report.iq_tones[0].q_remote[i]);
+	}
+}
+
+void test_cs_de_report_incremental_too_few_tones(void)
+{
+	static cs_de_report_t test_report;
+	uint8_t channel_map[10];
+
+	memset(channel_map, 0xFF, sizeof(channel_map));
+
+	cs_de_report_init(&test_report, BT_CONN_LE_CS_ROLE_REFLECTOR, 1);
+
+	for (uint8_t i = 0; i < 10; i++) {
+		add_mode_2_step(&test_report, i + CHANNEL_INDEX_OFFSET, 100, 100, 0);
+	}
+
+	cs_de_report_finalize(&test_report, channel_map);
+
+	TEST_ASSERT_EQUAL(CS_DE_TONE_QUALITY_BAD, test_report.tone_quality[0]);
+	TEST_ASSERT_EQUAL(CS_DE_QUALITY_DO_NOT_USE, cs_de_calc(&test_report));
+}
+
 /* Main test entry point */
 int main(void)
 {
@@ -101,6 +101,65 @@ ZTEST(dfu_target_stream_test, test_dfu_target_stream)
 	zassert_mem_equal(read_buf, write_buf, BUF_LEN, "Incorrect value");
 }
 
+ZTEST(dfu_target_stream_test, test_dfu_target_stream_buf_get)
+{
+	int err;
+	void *buf;
+	size_t len;
+	size_t chunk;
+	size_t written = 0;
+
+	for (size_t i = 0; i < BUF_LEN; i++) {
+		write_buf[i] = i % 251;
+	}
+
+	/* Start from an empty stream, with no progress stored */
+	(void)dfu_target_stream_reset();
+
+	err = dfu_target_stream_buf_get(&buf, &len);
+	zassert_equal(err, -EACCES, "Unexpected result: %d", err);
+
+	err = DFU_TARGET_STREAM_INIT(TEST_ID_1, fdev, sbuf, sizeof(sbuf),
+				     FLASH_BASE, FLASH_AVAILABLE, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	err = dfu_target_stream_reset();
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	err = DFU_TARGET_STREAM_INIT(TEST_ID_1, fdev, sbuf, sizeof(sbuf),
+				     FLASH_BASE, FLASH_AVAILABLE, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_buf_get(NULL, &len);
+	zassert_equal(err, -EINVAL, "Unexpected result: %d", err);
+
+	while (written < BUF_LEN) {
+		err = dfu_target_stream_buf_get(&buf, &len);
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+		zassert_true(len > 0 && len <= sizeof(sbuf), "Invalid length %zu", len);
+
+		/* Odd sizes, so that the lent buffer is often partly filled */
+		chunk = MIN(MIN(len, 37), BUF_LEN - written);
+
+		if ((written / 37) % 4 == 3) {
+			/* Mix in writes that are copied */
+			err = dfu_target_stream_write(write_buf + written, chunk);
+		} else {
+			memcpy(buf, write_buf + written, chunk);
+			err = dfu_target_stream_write(buf, chunk);
+		}
+		zassert_equal(err, 0, "Unexpected failure: %d", err);
+		written += chunk;
+	}
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = flash_read(fdev, FLASH_BASE, read_buf, BUF_LEN);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_mem_equal(read_buf, write_buf, BUF_LEN, "Incorrect value");
+
+	memset(write_buf, 0xaa, sizeof(write_buf));
+}
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 ZTEST(dfu_target_stream_test, test_dfu_target_stream_save_progress)
 {
@@ -23,7 +23,8 @@ enum test_states {
 	EMDS_TS_STORE_DATA,
 	EMDS_TS_CLEAR_FLASH,
 	EMDS_TS_NO_STORE,
-	EMDS_TS_SEVERAL_STORE
+	EMDS_TS_SEVERAL_STORE,
+	EMDS_TS_PREPARE_NO_STORE
 };
 
 static int iteration;
@@ -35,6 +36,9 @@ static enum test_states state[] = {
 	EMDS_TS_SEVERAL_STORE,
 	EMDS_TS_CLEAR_FLASH,
 	EMDS_TS_EMPTY_FLASH,
+	EMDS_TS_PREPARE_NO_STORE,
+	EMDS_TS_PREPARE_NO_STORE,
+	EMDS_TS_STORE_DATA,
 	EMDS_TS_NO_STORE,
 	EMDS_TS_EMPTY_FLASH,
 	EMDS_TS_CLEAR_FLASH,
@@ -75,6 +79,8 @@ static char *print_state(enum test_states s)
 		return "SEVERAL_STORE";
 	case EMDS_TS_NO_STORE:
 		return "NO_STORE";
+	case EMDS_TS_PREPARE_NO_STORE:
+		return "PREPARE_NO_STORE";
 	default:
 		return "UNKNOWN";
 	}
@@ -249,6 +255,13 @@ static bool pragma_several_store(const void *s)
 	return *state == EMDS_TS_SEVERAL_STORE;
 }
 
+static bool pragma_prepare_no_store(const void *s)
+{
+	const enum test_states *state = s;
+
+	return *state == EMDS_TS_PREPARE_NO_STORE;
+}
+
 #if CONFIG_SETTINGS
 static int emds_test_settings_set(const char *name, size_t len,
 				  settings_read_cb read_cb, void *cb_arg)
@@ -326,12 +339,20 @@ ZTEST(several_store, test_several_store)
 	load_flash(0);
 }
 
+/* The device reboots after the prepare, so the data staged by the prepare is never stored. */
+ZTEST(prepare_no_store, test_prepare_no_store)
+{
+	load_flash(0);
+	prepare();
+}
+
 ZTEST_SUITE(_setup, pragma_always, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(empty_flash, pragma_empty_flash, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(store_data, pragma_store_data, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(clear_flash, pragma_clear_flash, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(no_store, pragma_no_store, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(several_store, pragma_several_store, NULL, NULL, NULL, NULL);
+ZTEST_SUITE(prepare_no_store, pragma_prepare_no_store, NULL, NULL, NULL, NULL);
 
 void test_main(void)
 {
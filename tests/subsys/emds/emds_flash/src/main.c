@@ -569,6 +569,75 @@ ZTEST(emds_flash, test_allocation_if_data_garbaged)
 		      "Metadata CRC is not equal to calculated one");
 }
 
+/* Test checks that the data staged for a snapshot that is never stored is skipped by the
+ * allocation and ignored by the scanning.
+ */
+ZTEST(emds_flash, test_allocation_after_staged)
+{
+	struct emds_snapshot_candidate candidate;
+	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
+	const struct flash_area *fa = partition[partition_index].fa;
+	size_t write_block_size = partition[partition_index].fp->write_block_size;
+	struct emds_snapshot_candidate allocated_snapshot = {
+		.partition_index = partition_index,
+		.metadata.fresh_cnt = 2
+	};
+	struct emds_snapshot_metadata *metadata = NULL;
+	off_t metadata_off = fa->fa_size - sizeof(struct emds_snapshot_metadata);
+	uint8_t data[100];
+	off_t data_off;
+
+	metadata = snapshot_make(&partition[partition_index], metadata, metadata_off, true, true,
+				 1);
+	zassert_not_null(metadata, "Failed to create snapshot on partition %d", partition_index);
+	data_off = ROUND_UP(metadata->data_instance_len, write_block_size);
+
+	zassert_ok(emds_flash_scan_partition(&partition[partition_index], &candidate),
+		   "Failed to scan partition %d", partition_index);
+
+	/* Stage more snapshots than the scanning tolerates failures, as if the device rebooted
+	 * every time before storing.
+	 */
+	for (int i = 0; i <= CONFIG_EMDS_SCANNING_FAILURES; i++) {
+		zassert_ok(emds_flash_allocate_snapshot(&partition[partition_index], &candidate,
+							&allocated_snapshot, sizeof(data)),
+			   "Failed to allocate snapshot after staged data %d", i);
+		zassert_ok(emds_flash_stage_snapshot(&partition[partition_index],
+						     &allocated_snapshot),
+			   "Failed to stage snapshot %d", i);
+
+		metadata_off -= 2 * sizeof(struct emds_snapshot_metadata);
+		zassert_equal(allocated_snapshot.metadata_off, metadata_off,
+			      "Metadata offset is not equal to expected");
+		zassert_equal(allocated_snapshot.metadata.data_instance_off, data_off,
+			      "Data instance offset is not equal to expected");
+
+		for (int j = 0; j < sizeof(data); j++) {
+			data[j] = sys_rand32_get() % 256;
+		}
+
+		zassert_ok(flash_area_write(fa, data_off, data, sizeof(data)),
+			   "Failed to write staged data to flash area");
+		data_off += ROUND_UP(sizeof(data), write_block_size);
+
+		zassert_ok(emds_flash_scan_partition(&partition[partition_index], &candidate),
+			   "Failed to scan partition %d", partition_index);
+		zassert_equal(candidate.metadata.fresh_cnt, 1, "Fresh count mismatch");
+	}
+
+	/* Store the last staged snapshot. */
+	allocated_snapshot.metadata.snapshot_crc = crc32_k_4_2_update(0, data, sizeof(data));
+	zassert_ok(flash_area_write(fa, allocated_snapshot.metadata_off,
+				    &allocated_snapshot.metadata,
+				    sizeof(allocated_snapshot.metadata)),
+		   "Failed to write metadata to flash area");
+
+	zassert_ok(emds_flash_scan_partition(&partition[partition_index], &candidate),
+		   "Failed to scan partition %d", partition_index);
+	zassert_equal(candidate.metadata.fresh_cnt, 2, "Fresh count mismatch");
+	zassert_equal(candidate.metadata_off, metadata_off, "Metadata offset mismatch");
+}
+
 /* Test measures write timings. */
 ZTEST(emds_flash, test_write_speed)
 {
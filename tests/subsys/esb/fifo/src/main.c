@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+
+#include "esb_fifo.h"
+
+#define SIZE_MAX_TESTED 8
+
+#define STRESS_VALUE_CNT 100000
+#define STRESS_STACK_SIZE 1024
+
+static const uint32_t sizes[] = {1, 3, SIZE_MAX_TESTED};
+
+/* Queue of sequence numbers, used the same way as the ESB payload queues. */
+struct fifo {
+	uint32_t back;
+	uint32_t front;
+	uint32_t size;
+	uint32_t slot[SIZE_MAX_TESTED];
+};
+
+static void fifo_init(struct fifo *fifo, uint32_t size)
+{
+	memset(fifo, 0, sizeof(*fifo));
+	fifo->size = size;
+}
+
+/* Push until the queue is full, as esb_write_payloads() does. */
+static size_t fifo_write(struct fifo *fifo, const uint32_t *values, size_t count)
+{
+	size_t written;
+
+	for (written = 0; written < count; written++) {
+		if (esb_fifo_count(fifo->back, fifo->front, fifo->size) >= fifo->size) {
+			break;
+		}
+
+		fifo->slot[esb_fifo_slot(fifo->back, fifo->size)] = values[written];
+		fifo->back = esb_fifo_index_next(fifo->back, fifo->size);
+	}
+
+	return written;
+}
+
+/* Read what is available and release it at once, as esb_read_rx_payloads() does. */
+static int fifo_read(struct fifo *fifo, uint32_t *values, size_t count)
+{
+	uint32_t front = fifo->front;
+	size_t available = esb_fifo_count(fifo->back, front, fifo->size);
+	size_t read;
+
+	if (available == 0) {
+		return -ENODATA;
+	}
+
+	count = MIN(count, available);
+
+	for (read = 0; read < count; read++) {
+		values[read] = fifo->slot[esb_fifo_slot(front, fifo->size)];
+		front = esb_fifo_index_next(front, fifo->size);
+	}
+
+	fifo->front = front;
+
+	return read;
+}
+
+ZTEST(esb_fifo, test_index)
+{
+	ARRAY_FOR_EACH(sizes, i) {
+		uint32_t size = sizes[i];
+
+		for (uint32_t index = 0; index < 2 * size; index++) {
+			zassert_equal(esb_fifo_slot(index, size), index % size);
+			zassert_equal(esb_fifo_index_next(index, size), (index + 1) % (2 * size));
+		}
+	}
+}
+
+ZTEST(esb_fifo, test_empty)
+{
+	struct fifo fifo;
+	uint32_t value;
+
+	ARRAY_FOR_EACH(sizes, i) {
+		uint32_t size = sizes[i];
+
+		for (uint32_t index = 0; index < 2 * size; index++) {
+			zassert_equal(esb_fifo_count(index, index, size), 0);
+		}
+
+		fifo_init(&fifo, size);
+		zassert_equal(fifo_read(&fifo, &value, 1), -ENODATA);
+	}
+}
+
+ZTEST(esb_fifo, test_full)
+{
+	uint32_t values[SIZE_MAX_TESTED + 1] = {0};
+	struct fifo fifo;
+
+	ARRAY_FOR_EACH(sizes, i) {
+		uint32_t size = sizes[i];
+
+		/* A full queue has its back and front in the same slot, but is not empty. */
+		for (uint32_t front = 0; front < 2 * size; front++) {
+			uint32_t back = (front + size) % (2 * size);
+
+			zassert_equal(esb_fifo_slot(back, size), esb_fifo_slot(front, size));
+			zassert_equal(esb_fifo_count(back, front, size), size);
+		}
+
+		fifo_init(&fifo, size);
+		zassert_equal(fifo_write(&fifo, values, size), size);
+		zassert_equal(esb_fifo_count(fifo.back, fifo.front, fifo.size), size);
+		zassert_equal(fifo_write(&fifo, values, 1), 0);
+	}
+}
+
+ZTEST(esb_fifo, test_wrap_around)
+{
+	uint32_t values[SIZE_MAX_TESTED];
+	struct fifo fifo;
+
+	ARRAY_FOR_EACH(sizes, i) {
+		uint32_t size = sizes[i];
+		uint32_t next_write = 0;
+		uint32_t next_read = 0;
+
+		fifo_init(&fifo, size);
+
+		/* Go round the 2 * size indices several times, with varying batch sizes and fill
+		 * levels.
+		 */
+		for (uint32_t round = 0; round < 10 * size; round++) {
+			size_t count = round % size + 1;
+			size_t written;
+			int read;
+
+			for (size_t j = 0; j < count; j++) {
+				values[j] = next_write + j;
+			}
+
+			written = fifo_write(&fifo, values, count);
+			next_write += written;
+			zassert_equal(esb_fifo_count(fifo.back, fifo.front, fifo.size),
+				      next_write - next_read);
+
+			read = fifo_read(&fifo, values, (round + 1) % size + 1);
+			zassert_true(read > 0);
+
+			for (int j = 0; j < read; j++) {
+				zassert_equal(values[j], next_read + j, "Out of order at %u",
+					      next_read + j);
+			}
+
+			next_read += read;
+			zassert_true(fifo.back < 2 * size && fifo.front < 2 * size);
+		}
+	}
+}
+
+ZTEST(esb_fifo, test_partial_batch)
+{
+	uint32_t values[SIZE_MAX_TESTED] = {0, 1, 2, 3, 4, 5, 6, 7};
+	uint32_t out[SIZE_MAX_TESTED];
+	struct fifo fifo;
+
+	fifo_init(&fifo, SIZE_MAX_TESTED);
+
+	/* Only the part of a batch that fits is written, in order. */
+	zassert_equal(fifo_write(&fifo, values, 6), 6);
+	zassert_equal(fifo_write(&fifo, &values[6], 5), 2);
+	zassert_equal(fifo_read(&fifo, out, SIZE_MAX_TESTED), SIZE_MAX_TESTED);
+	zassert_mem_equal(out, values, sizeof(values));
+
+	/* A read returns no more than what is available. */
+	zassert_equal(fifo_write(&fifo, values, 3), 3);
+	zassert_equal(fifo_read(&fifo, out, SIZE_MAX_TESTED), 3);
+	zassert_mem_equal(out, values, 3 * sizeof(values[0]));
+	zassert_equal(esb_fifo_count(fifo.back, fifo.front, fifo.size), 0);
+}
+
+ZTEST(esb_fifo, test_zero_count)
+{
+	uint32_t values[1] = {0};
+	struct fifo fifo;
+
+	fifo_init(&fifo, SIZE_MAX_TESTED);
+
+	zassert_equal(fifo_write(&fifo, values, 0), 0);
+	zassert_equal(fifo.back, 0);
+
+	zassert_equal(fifo_write(&fifo, values, 1), 1);
+	zassert_equal(fifo_read(&fifo, values, 0), 0);
+	zassert_equal(fifo.front, 0);
+	zassert_equal(esb_fifo_count(fifo.back, fifo.front, fifo.size), 1);
+}
+
+/* The producer and the consumer only share the published indices, as the application and
+ * the radio interrupt do.
+ */
+static struct {
+	atomic_t back;
+	atomic_t front;
+	uint32_t slot[SIZE_MAX_TESTED];
+} stress_fifo;
+
+K_THREAD_STACK_DEFINE(producer_stack, STRESS_STACK_SIZE);
+static struct k_thread producer_thread;
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	uint32_t value = 0;
+
+	while (value < STRESS_VALUE_CNT) {
+		uint32_t back = atomic_get(&stress_fifo.back);
+
+		if (esb_fifo_count(back, atomic_get(&stress_fifo.front), SIZE_MAX_TESTED) >=
+		    SIZE_MAX_TESTED) {
+			k_yield();
+			continue;
+		}
+
+		stress_fifo.slot[esb_fifo_slot(back, SIZE_MAX_TESTED)] = value++;
+		atomic_set(&stress_fifo.back, esb_fifo_index_next(back, SIZE_MAX_TESTED));
+	}
+}
+
+ZTEST(esb_fifo, test_producer_consumer)
+{
+	uint32_t expected = 0;
+
+	atomic_clear(&stress_fifo.back);
+	atomic_clear(&stress_fifo.front);
+
+	k_thread_create(&producer_thread, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			producer, NULL, NULL, NULL, k_thread_priority_get(k_current_get()), 0,
+			K_NO_WAIT);
+
+	while (expected < STRESS_VALUE_CNT) {
+		uint32_t front = atomic_get(&stress_fifo.front);
+		uint32_t available =
+			esb_fifo_count(atomic_get(&stress_fifo.back), front, SIZE_MAX_TESTED);
+
+		if (available == 0) {
+			k_yield();
+			continue;
+		}
+
+		/* Read in batches of varying size, releasing each batch at once. */
+		available = MIN(available, expected % SIZE_MAX_TESTED + 1);
+
+		for (uint32_t i = 0; i < available; i++) {
+			zassert_equal(stress_fifo.slot[esb_fifo_slot(front, SIZE_MAX_TESTED)],
+				      expected, "Out of order at %u", expected);
+			front = esb_fifo_index_next(front, SIZE_MAX_TESTED);
+			expected++;
+		}
+
+		atomic_set(&stress_fifo.front, front);
+	}
+
+	zassert_ok(k_thread_join(&producer_thread, K_SECONDS(1)));
+}
+
+ZTEST_SUITE(esb_fifo, NULL, NULL, NULL, NULL, NULL);
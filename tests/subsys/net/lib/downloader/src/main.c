@@ -15,6 +15,8 @@
 #include <zephyr/fff.h>
 #include <sys/types.h>
 #include <errno.h>
+#include <stdio.h>
+#include <string.h>
 
 #define HOSTNAME "server.com"
 #define HOSTNAME2 "server2.com"
@@ -158,6 +160,13 @@
 "Location: https://server.com/path/to/file.end\r\n" \
 "\r\n\r\n"
 
+/* Responses to pipelined range requests for a file of four ranges */
+#define HTTPS_HDR_PIPELINED(range) \
+"HTTP/1.1 206 Partial Content\r\n" \
+"Content-Length: 32\r\n" \
+"Connection: keep-alive\r\n" \
+"Content-Range: bytes " range "/128\r\n\r\n"
+
 #define PAYLOAD "This is the payload!"
 
 #define FD 0
@@ -967,6 +976,140 @@ static ssize_t z_impl_zsock_recvfrom_partial_then_econnreset(
 	return -ECONNRESET;
 }
 
+static char pipelined_ranges[8][32];
+
+ssize_t z_impl_zsock_sendto_pipelined(int sock, const void *buf, size_t len, int flags,
+				      const struct sockaddr *dest_addr, socklen_t addrlen)
+{
+	/* The request is formatted in the download buffer, so it is NUL-terminated */
+	const char *range = strstr(buf, "Range: ");
+	int i = z_impl_zsock_sendto_fake.call_count - 1;
+
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(i < ARRAY_SIZE(pipelined_ranges));
+	TEST_ASSERT_NOT_NULL(range);
+
+	sscanf(range, "Range: %31[^\r]", pipelined_ranges[i]);
+
+	return len;
+}
+
+/* Copy a response with a body of the given character */
+static size_t pipelined_response_put(char *buf, const char *hdr, char c, size_t body_len)
+{
+	memcpy(buf, hdr, strlen(hdr));
+	memset(buf + strlen(hdr), c, body_len);
+
+	return strlen(hdr) + body_len;
+}
+
+static ssize_t z_impl_zsock_recvfrom_https_pipelined(
+	int sock, void *buf, size_t max_len, int flags, struct sockaddr *src_addr,
+	socklen_t *addrlen)
+{
+	size_t len = 0;
+
+	TEST_ASSERT_EQUAL(FD, sock);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		/* Only the first range is requested before the file size is known */
+		TEST_ASSERT_EQUAL(1, z_impl_zsock_sendto_fake.call_count);
+		return pipelined_response_put(buf, HTTPS_HDR_PIPELINED("0-31"), 'a', 32);
+	case 2:
+		/* Two responses and the start of the third come in one read */
+		TEST_ASSERT_EQUAL(4, z_impl_zsock_sendto_fake.call_count);
+		len += pipelined_response_put(buf, HTTPS_HDR_PIPELINED("32-63"), 'b', 32);
+		len += pipelined_response_put((char *)buf + len, HTTPS_HDR_PIPELINED("64-95"),
+					      'c', 32);
+		len += pipelined_response_put((char *)buf + len, HTTPS_HDR_PIPELINED("96-127"),
+					      'd', 16);
+		TEST_ASSERT(len <= max_len);
+		return len;
+	case 3:
+		memset(buf, 'd', 16);
+		return 16;
+	}
+
+	return 0;
+}
+
+static size_t pipelined_progress;
+
+static int dl_callback_pipelined(const struct downloader_evt *event)
+{
+	if (event->id == DOWNLOADER_EVT_FRAGMENT) {
+		const char *data = event->fragment.buf;
+
+		/* The fragments are in order and do not hold any of the headers */
+		for (size_t i = 0; i < event->fragment.len; i++) {
+			TEST_ASSERT_EQUAL('a' + (pipelined_progress + i) / 32, data[i]);
+		}
+
+		pipelined_progress += event->fragment.len;
+	}
+
+	return dl_callback(event);
+}
+
+static char lent_buf[20];
+static size_t lent_fragments;
+
+static int dl_buf_get_lent(void **buf, size_t *len)
+{
+	*buf = lent_buf;
+	*len = sizeof(lent_buf);
+
+	return 0;
+}
+
+static int dl_callback_lent(const struct downloader_evt *event)
+{
+	if (event->id == DOWNLOADER_EVT_FRAGMENT && event->fragment.buf == lent_buf) {
+		lent_fragments++;
+	}
+
+	return dl_callback_pipelined(event);
+}
+
+static ssize_t z_impl_zsock_recvfrom_https_lent(
+	int sock, void *buf, size_t max_len, int flags, struct sockaddr *src_addr,
+	socklen_t *addrlen)
+{
+	TEST_ASSERT_EQUAL(FD, sock);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		return pipelined_response_put(buf, HTTPS_HDR_PIPELINED("0-31"), 'a', 32);
+	case 2:
+		/* Less than the first fragment after the header, kept in the downloader buffer */
+		return pipelined_response_put(buf, HTTPS_HDR_PIPELINED("32-63"), 'b', 8);
+	case 3:
+		TEST_ASSERT(buf != lent_buf);
+		memset(buf, 'b', 24);
+		return 24;
+	case 4:
+		return pipelined_response_put(buf, HTTPS_HDR_PIPELINED("64-95"), 'c', 0);
+	case 5:
+		/* The payload goes into the lent buffer, bounded by the end of the range */
+		TEST_ASSERT_EQUAL_PTR(lent_buf, buf);
+		TEST_ASSERT_EQUAL(sizeof(lent_buf), max_len);
+		memset(buf, 'c', max_len);
+		return max_len;
+	case 6:
+		TEST_ASSERT_EQUAL_PTR(lent_buf, buf);
+		TEST_ASSERT_EQUAL(32 - sizeof(lent_buf), max_len);
+		memset(buf, 'c', max_len);
+		return max_len;
+	case 7:
+		/* The next header is received into the downloader buffer again */
+		TEST_ASSERT(buf != lent_buf);
+		return pipelined_response_put(buf, HTTPS_HDR_PIPELINED("96-127"), 'd', 32);
+	}
+
+	return 0;
+}
+
 static ssize_t z_impl_zsock_recvfrom_http_redirect_and_close(
 	int sock, void *buf, size_t max_len, int flags, struct sockaddr *src_addr,
 	socklen_t *addrlen)
@@ -1481,6 +1624,87 @@ void test_downloader_get_https_partial_content_partial_2nd_header(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+void test_downloader_get_https_pipelined(void)
+{
+	int err;
+	struct downloader_cfg cfg = {
+		.callback = dl_callback_pipelined,
+		.buf = dl_buf,
+		.buf_size = sizeof(dl_buf),
+	};
+
+#if CONFIG_DOWNLOADER_TRANSPORT_HTTP_PIPELINE_DEPTH < 4
+	TEST_IGNORE();
+#endif
+
+	pipelined_progress = 0;
+	memset(pipelined_ranges, 0, sizeof(pipelined_ranges));
+
+	err = downloader_init(&dl, &cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_https_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_https_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_pipelined;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_https_pipelined;
+
+	err = downloader_get(&dl, &dl_host_conf_w_sec_tags_range_override_32, HTTPS_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	TEST_ASSERT_EQUAL(128, pipelined_progress);
+	TEST_ASSERT_EQUAL(4, z_impl_zsock_sendto_fake.call_count);
+	TEST_ASSERT_EQUAL(3, z_impl_zsock_recvfrom_fake.call_count);
+	TEST_ASSERT_EQUAL_STRING("bytes=0-31", pipelined_ranges[0]);
+	TEST_ASSERT_EQUAL_STRING("bytes=32-63", pipelined_ranges[1]);
+	TEST_ASSERT_EQUAL_STRING("bytes=64-95", pipelined_ranges[2]);
+	TEST_ASSERT_EQUAL_STRING("bytes=96-127", pipelined_ranges[3]);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
+void test_downloader_get_https_lent_buf(void)
+{
+	int err;
+	struct downloader_cfg cfg = {
+		.callback = dl_callback_lent,
+		.buf = dl_buf,
+		.buf_size = sizeof(dl_buf),
+		.buf_get = dl_buf_get_lent,
+	};
+
+	pipelined_progress = 0;
+	lent_fragments = 0;
+
+	err = downloader_init(&dl, &cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_https_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_https_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_pipelined;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_https_lent;
+
+	err = downloader_get(&dl, &dl_host_conf_w_sec_tags_range_override_32, HTTPS_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	TEST_ASSERT_EQUAL(128, pipelined_progress);
+	TEST_ASSERT_EQUAL(2, lent_fragments);
+	TEST_ASSERT_EQUAL(7, z_impl_zsock_recvfrom_fake.call_count);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_https_unlimited_redirect(void)
 {
 	int err;
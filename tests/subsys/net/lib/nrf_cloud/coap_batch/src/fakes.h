@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_codec.h>
+#include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_coap_transport.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(bool, nrf_cloud_coap_is_connected);
+FAKE_VALUE_FUNC(int, nrf_cloud_coap_post, const char *, const char *, const uint8_t *, size_t,
+		enum coap_content_format, bool, coap_client_response_cb_t, void *);
+FAKE_VALUE_FUNC(int, date_time_now, int64_t *);
+FAKE_VALUE_FUNC(int, nrf_cloud_encode_message, const char *, double, const char *, const char *,
+		int64_t, struct nrf_cloud_data *);
+FAKE_VALUE_FUNC(int, nrf_cloud_error_msg_decode, const char *const, const char *const,
+		const char *const, enum nrf_cloud_error *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_rest_fota_execution_decode, const char *const,
+		struct nrf_cloud_fota_job_info *const);
+FAKE_VOID_FUNC(cJSON_free, void *);
+
+#define POST_PAYLOAD_MAX 256
+#define TIME_NOW_MS	 1700000000000LL
+
+struct post {
+	char resource[32];
+	enum coap_content_format fmt;
+	bool confirmable;
+	uint8_t payload[POST_PAYLOAD_MAX];
+	size_t len;
+	k_tid_t thread;
+};
+
+/* Stand-in for the cloud, which keeps the last request */
+static struct post last_post;
+
+int fake_nrf_cloud_coap_post__stores(const char *resource, const char *query,
+				     const uint8_t *buf, size_t len,
+				     enum coap_content_format fmt, bool reliable,
+				     coap_client_response_cb_t cb, void *user)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user);
+
+	zassert_true(len <= sizeof(last_post.payload));
+
+	strncpy(last_post.resource, resource, sizeof(last_post.resource) - 1);
+	last_post.fmt = fmt;
+	last_post.confirmable = reliable;
+	memcpy(last_post.payload, buf, len);
+	last_post.len = len;
+	last_post.thread = k_current_get();
+
+	return 0;
+}
+
+int fake_date_time_now__succeeds(int64_t *unix_time_ms)
+{
+	*unix_time_ms = TIME_NOW_MS;
+
+	return 0;
+}
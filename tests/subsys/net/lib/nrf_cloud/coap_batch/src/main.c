@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zcbor_decode.h>
+#include <net/nrf_cloud_coap.h>
+#include "fakes.h"
+
+#define APP_ID	    "TEMP"
+/* Three messages with this app ID fill the batch buffer */
+#define APP_ID_LONG "TEMPERATURE_LONG"
+#define MAX_READINGS 8
+
+struct reading {
+	char app_id[sizeof(APP_ID_LONG)];
+	double value;
+	uint64_t ts;
+};
+
+static struct reading readings[MAX_READINGS];
+
+/* Decode the last request the way the cloud does, as an array of sensor messages */
+static size_t last_post_decode(void)
+{
+	ZCBOR_STATE_D(states, 2, last_post.payload, last_post.len, 1, 0);
+	size_t count = 0;
+	bool ok;
+
+	zassert_str_equal(last_post.resource, "msg/d2c/bulk");
+	zassert_equal(last_post.fmt, COAP_CONTENT_FORMAT_APP_CBOR);
+	zassert_true(last_post.confirmable);
+
+	ok = zcbor_list_start_decode(states);
+
+	while (ok && !zcbor_array_at_end(states)) {
+		struct reading *r = &readings[count];
+		struct zcbor_string app_id;
+
+		zassert_true(count < MAX_READINGS);
+
+		ok = zcbor_map_start_decode(states) &&
+		     zcbor_uint32_expect(states, 1) &&
+		     zcbor_tstr_decode(states, &app_id) &&
+		     zcbor_uint32_expect(states, 2) &&
+		     zcbor_float64_decode(states, &r->value) &&
+		     zcbor_uint32_expect(states, 3) &&
+		     zcbor_uint64_decode(states, &r->ts) &&
+		     zcbor_map_end_decode(states);
+		if (ok) {
+			zassert_true(app_id.len < sizeof(r->app_id));
+			memcpy(r->app_id, app_id.value, app_id.len);
+			r->app_id[app_id.len] = '\0';
+			count++;
+		}
+	}
+
+	ok = ok && zcbor_list_end_decode(states);
+	zassert_true(ok, "Invalid batch: %d", zcbor_peek_error(states));
+
+	return count;
+}
+
+static void readings_check(size_t count, const char *app_id, int first)
+{
+	zassert_equal(last_post_decode(), count);
+
+	for (size_t i = 0; i < count; i++) {
+		zassert_str_equal(readings[i].app_id, app_id);
+		zassert_equal(readings[i].value, first + i);
+		zassert_equal(readings[i].ts, 1000 + first + i);
+	}
+}
+
+ZTEST(nrf_cloud_coap_batch, test_flush_on_count)
+{
+	struct nrf_cloud_coap_batch_stats before;
+	struct nrf_cloud_coap_batch_stats after;
+
+	nrf_cloud_coap_batch_stats_get(&before);
+
+	for (int i = 0; i < CONFIG_NRF_CLOUD_COAP_BATCH_MAX_MESSAGES; i++) {
+		zassert_equal(nrf_cloud_coap_post_fake.call_count, 0);
+		zassert_ok(nrf_cloud_coap_batch_sensor_add(APP_ID, i, 1000 + i));
+	}
+
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 1);
+	readings_check(CONFIG_NRF_CLOUD_COAP_BATCH_MAX_MESSAGES, APP_ID, 0);
+
+	nrf_cloud_coap_batch_stats_get(&after);
+	zassert_equal(after.batches - before.batches, 1);
+	zassert_equal(after.messages - before.messages, CONFIG_NRF_CLOUD_COAP_BATCH_MAX_MESSAGES);
+	zassert_equal(after.bytes_sent - before.bytes_sent, last_post.len);
+	/* Three requests saved, at the cost of the array header and the bulk path option */
+	zassert_equal(after.bytes_saved - before.bytes_saved,
+		      3 * CONFIG_NRF_CLOUD_COAP_BATCH_REQUEST_OVERHEAD - 1 - 5);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_flush_on_size)
+{
+	for (int i = 0; i < 3; i++) {
+		zassert_ok(nrf_cloud_coap_batch_sensor_add(APP_ID_LONG, i, 1000 + i));
+	}
+
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 0);
+
+	/* The fourth message does not fit, so the first three are sent without it */
+	zassert_ok(nrf_cloud_coap_batch_sensor_add(APP_ID_LONG, 3, 1003));
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 1);
+	readings_check(3, APP_ID_LONG, 0);
+
+	zassert_ok(nrf_cloud_coap_batch_flush());
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 2);
+	readings_check(1, APP_ID_LONG, 3);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_flush_on_age)
+{
+	zassert_ok(nrf_cloud_coap_batch_sensor_add(APP_ID, 0, 1000));
+	zassert_ok(nrf_cloud_coap_batch_sensor_add(APP_ID, 1, 1001));
+
+	k_sleep(K_MSEC(CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE * MSEC_PER_SEC / 2));
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 0);
+
+	k_sleep(K_MSEC(CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE * MSEC_PER_SEC));
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 1);
+	readings_check(2, APP_ID, 0);
+
+	/* The blocking request is not sent from the system workqueue */
+	zassert_not_equal(last_post.thread, k_work_queue_thread_get(&k_sys_work_q));
+}
+
+ZTEST(nrf_cloud_coap_batch, test_flush_on_age_retry)
+{
+	nrf_cloud_coap_is_connected_fake.return_val = false;
+
+	zassert_ok(nrf_cloud_coap_batch_sensor_add(APP_ID, 0, 1000));
+
+	k_sleep(K_MSEC(CONFIG_NRF_CLOUD_COAP_BATCH_MAX_AGE * MSEC_PER_SEC * 3 / 2));
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 0);
+
+	/* The expired batch is sent again without waiting for another message */
+	nrf_cloud_coap_is_connected_fake.return_val = true;
+	k_sleep(K_MSEC(CONFIG_NRF_CLOUD_COAP_BATCH_RETRY_INTERVAL * MSEC_PER_SEC));
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 1);
+	readings_check(1, APP_ID, 0);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_flush_empty)
+{
+	zassert_ok(nrf_cloud_coap_batch_flush());
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 0);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_timestamp_now)
+{
+	zassert_ok(nrf_cloud_coap_batch_sensor_add(APP_ID, 0, NRF_CLOUD_NO_TIMESTAMP));
+	zassert_ok(nrf_cloud_coap_batch_flush());
+
+	zassert_equal(last_post_decode(), 1);
+	zassert_equal(readings[0].ts, TIME_NOW_MS);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_disconnected_drops_oldest)
+{
+	struct nrf_cloud_coap_batch_stats before;
+	struct nrf_cloud_coap_batch_stats after;
+
+	nrf_cloud_coap_batch_stats_get(&before);
+	nrf_cloud_coap_is_connected_fake.return_val = false;
+
+	for (int i = 0; i < 5; i++) {
+		zassert_ok(nrf_cloud_coap_batch_sensor_add(APP_ID_LONG, i, 1000 + i));
+	}
+
+	zassert_equal(nrf_cloud_coap_batch_flush(), -EACCES);
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 0);
+
+	nrf_cloud_coap_is_connected_fake.return_val = true;
+	zassert_ok(nrf_cloud_coap_batch_flush());
+	readings_check(3, APP_ID_LONG, 2);
+
+	nrf_cloud_coap_batch_stats_get(&after);
+	zassert_equal(after.dropped - before.dropped, 2);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_rejected)
+{
+	struct nrf_cloud_coap_batch_stats before;
+	struct nrf_cloud_coap_batch_stats after;
+
+	nrf_cloud_coap_batch_stats_get(&before);
+
+	zassert_ok(nrf_cloud_coap_batch_sensor_add(APP_ID, 0, 1000));
+
+	nrf_cloud_coap_post_fake.custom_fake = NULL;
+	nrf_cloud_coap_post_fake.return_val = COAP_RESPONSE_CODE_BAD_REQUEST;
+	zassert_equal(nrf_cloud_coap_batch_flush(), COAP_RESPONSE_CODE_BAD_REQUEST);
+
+	/* The rejected messages are not sent again */
+	zassert_ok(nrf_cloud_coap_batch_flush());
+	zassert_equal(nrf_cloud_coap_post_fake.call_count, 1);
+
+	nrf_cloud_coap_batch_stats_get(&after);
+	zassert_equal(after.dropped - before.dropped, 1);
+	zassert_equal(after.batches, before.batches);
+}
+
+ZTEST(nrf_cloud_coap_batch, test_einval)
+{
+	zassert_equal(nrf_cloud_coap_batch_sensor_add(NULL, 0, 1000), -EINVAL);
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Send what an earlier test left behind */
+	nrf_cloud_coap_is_connected_fake.return_val = true;
+	nrf_cloud_coap_post_fake.custom_fake = fake_nrf_cloud_coap_post__stores;
+	(void)nrf_cloud_coap_batch_flush();
+
+	RESET_FAKE(nrf_cloud_coap_post);
+	RESET_FAKE(date_time_now);
+	FFF_RESET_HISTORY();
+
+	nrf_cloud_coap_post_fake.custom_fake = fake_nrf_cloud_coap_post__stores;
+	date_time_now_fake.custom_fake = fake_date_time_now__succeeds;
+	memset(&last_post, 0, sizeof(last_post));
+}
+
+ZTEST_SUITE(nrf_cloud_coap_batch, NULL, NULL, before, NULL, NULL);
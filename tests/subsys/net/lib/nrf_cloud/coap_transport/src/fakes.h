@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_codec.h>
+#include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_dns.h"
+#include "server.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(int, nrf_cloud_print_details);
+FAKE_VALUE_FUNC(int, nrf_cloud_codec_init, struct nrf_cloud_os_mem_hooks *);
+FAKE_VOID_FUNC(nrf_cloud_device_control_get, struct nrf_cloud_ctrl_data *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_shadow_control_response_encode,
+		struct nrf_cloud_ctrl_data const *const, bool, struct nrf_cloud_data *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_enabled_info_sections_json_encode, cJSON *const,
+		const char *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_init, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_free, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_cloud_encode, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_cloud_encoded_free, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_coap_shadow_state_update, const char *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_jwt_generate, uint32_t, char *const, size_t);
+FAKE_VALUE_FUNC(int, nrf_cloud_connect_host, const char *, uint16_t, struct zsock_addrinfo *,
+		nrf_cloud_connect_host_cb);
+FAKE_VALUE_FUNC(int, nrfc_dtls_setup, int);
+FAKE_VALUE_FUNC(bool, nrfc_dtls_cid_is_active, int);
+FAKE_VALUE_FUNC(int, nrfc_dtls_session_save, int);
+FAKE_VALUE_FUNC(int, nrfc_dtls_session_load, int);
+FAKE_VALUE_FUNC(bool, nrfc_keepopen_is_supported);
+
+void *nrf_cloud_malloc(size_t size)
+{
+	return k_malloc(size);
+}
+
+void nrf_cloud_free(void *memory)
+{
+	k_free(memory);
+}
+
+int fake_nrf_cloud_jwt_generate__succeeds(uint32_t time_valid_s, char *const jwt_buf,
+					  size_t jwt_buf_sz)
+{
+	ARG_UNUSED(time_valid_s);
+
+	strncpy(jwt_buf, "header.payload.signature", jwt_buf_sz);
+
+	return 0;
+}
+
+int fake_nrf_cloud_connect_host__server(const char *host_name, uint16_t port,
+					struct zsock_addrinfo *hints,
+					nrf_cloud_connect_host_cb connect_cb)
+{
+	ARG_UNUSED(host_name);
+	ARG_UNUSED(port);
+	ARG_UNUSED(hints);
+	ARG_UNUSED(connect_cb);
+
+	/* Plain UDP instead of DTLS */
+	return server_connect();
+}
+
+int fake_nrf_cloud_obj_init__fails(struct nrf_cloud_obj *const obj)
+{
+	ARG_UNUSED(obj);
+
+	/* No shadow info sections are sent on connect */
+	return -ENOTSUP;
+}
+
+int fake_nrf_cloud_shadow_control_response_encode__fails(
+	struct nrf_cloud_ctrl_data const *const data, bool accept,
+	struct nrf_cloud_data *const output)
+{
+	ARG_UNUSED(data);
+	ARG_UNUSED(accept);
+	ARG_UNUSED(output);
+
+	/* No control section is sent on connect */
+	return -ENOTSUP;
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+#include "fakes.h"
+#include "server.h"
+
+#define BURST_SIZE   20
+#define RTT_MS	     300
+#define RESOURCE     "msg/d2c"
+#define RESULT_UNSET INT_MIN
+
+static K_SEM_DEFINE(done_sem, 0, BURST_SIZE);
+static const uint8_t payload[] = "{\"appId\":\"TEMP\",\"messageType\":\"DATA\",\"data\":\"21.5\"}";
+static int results[BURST_SIZE];
+static size_t response_len;
+
+static void async_done(int result, void *user)
+{
+	int *res = user;
+
+	*res = result;
+	k_sem_give(&done_sem);
+}
+
+static void get_cb(int16_t result_code, size_t offset, const uint8_t *data, size_t len,
+		   bool last_block, void *user)
+{
+	ARG_UNUSED(result_code);
+	ARG_UNUSED(offset);
+	ARG_UNUSED(data);
+	ARG_UNUSED(last_block);
+
+	response_len = len;
+}
+
+/* Send the burst without waiting for responses, waiting for a completion only when all
+ * request slots are in use.
+ */
+static int64_t burst_async_ms(void)
+{
+	int64_t start = k_uptime_get();
+	size_t completed = 0;
+
+	for (size_t i = 0; i < BURST_SIZE; i++) {
+		int err;
+
+		results[i] = RESULT_UNSET;
+
+		while ((err = nrf_cloud_coap_async_request(COAP_METHOD_POST, RESOURCE, NULL,
+							   payload, sizeof(payload) - 1,
+							   COAP_CONTENT_FORMAT_APP_JSON,
+							   COAP_CONTENT_FORMAT_APP_JSON, NULL,
+							   async_done, &results[i])) == -EAGAIN ||
+		       err == -ENOBUFS) {
+			zassert_ok(k_sem_take(&done_sem, K_SECONDS(5)));
+			completed++;
+		}
+
+		zassert_ok(err, "Request %zu failed to start: %d", i, err);
+	}
+
+	for (; completed < BURST_SIZE; completed++) {
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(5)));
+	}
+
+	return k_uptime_get() - start;
+}
+
+static int64_t burst_sync_ms(void)
+{
+	int64_t start = k_uptime_get();
+
+	for (size_t i = 0; i < BURST_SIZE; i++) {
+		zassert_ok(nrf_cloud_coap_post(RESOURCE, NULL, payload, sizeof(payload) - 1,
+					       COAP_CONTENT_FORMAT_APP_JSON, true, NULL, NULL));
+	}
+
+	return k_uptime_get() - start;
+}
+
+ZTEST(nrf_cloud_coap_transport, test_burst)
+{
+	uint32_t requests = server_request_count();
+	int64_t sync_ms;
+	int64_t async_ms;
+
+	sync_ms = burst_sync_ms();
+	async_ms = burst_async_ms();
+
+	for (size_t i = 0; i < BURST_SIZE; i++) {
+		zassert_equal(results[i], 0, "Request %zu result %d", i, results[i]);
+	}
+
+	zassert_equal(server_request_count() - requests, 2 * BURST_SIZE);
+
+	TC_PRINT("%d requests with %d ms round trip: %lld ms one at a time, %lld ms with up to "
+		 "%d in flight\n", BURST_SIZE, RTT_MS, sync_ms, async_ms,
+		 CONFIG_COAP_CLIENT_MAX_REQUESTS);
+
+	zassert_true(sync_ms >= BURST_SIZE * RTT_MS);
+	zassert_true(async_ms <= DIV_ROUND_UP(BURST_SIZE, CONFIG_COAP_CLIENT_MAX_REQUESTS) *
+				 (RTT_MS + RTT_MS / 2),
+		     "Requests were not in flight concurrently");
+}
+
+ZTEST(nrf_cloud_coap_transport, test_async_get)
+{
+	response_len = 0;
+	results[0] = RESULT_UNSET;
+
+	zassert_ok(nrf_cloud_coap_async_request(COAP_METHOD_GET, "state", NULL, NULL, 0,
+						COAP_CONTENT_FORMAT_APP_JSON,
+						COAP_CONTENT_FORMAT_APP_JSON, get_cb, async_done,
+						&results[0]));
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(5)));
+	zassert_equal(results[0], 0);
+	zassert_equal(response_len, 2);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_async_einval)
+{
+	zassert_equal(nrf_cloud_coap_async_request(COAP_METHOD_POST, NULL, NULL, NULL, 0,
+						   COAP_CONTENT_FORMAT_APP_JSON,
+						   COAP_CONTENT_FORMAT_APP_JSON, NULL,
+						   async_done, NULL),
+		      -EINVAL);
+	zassert_equal(nrf_cloud_coap_async_request(COAP_METHOD_POST, RESOURCE, NULL, NULL, 0,
+						   COAP_CONTENT_FORMAT_APP_JSON,
+						   COAP_CONTENT_FORMAT_APP_JSON, NULL, NULL,
+						   NULL),
+		      -EINVAL);
+}
+
+ZTEST(nrf_cloud_coap_transport, test_async_disconnect)
+{
+	server_silent_set(true);
+
+	for (size_t i = 0; i < 2; i++) {
+		results[i] = RESULT_UNSET;
+		zassert_ok(nrf_cloud_coap_async_request(COAP_METHOD_POST, RESOURCE, NULL,
+							payload, sizeof(payload) - 1,
+							COAP_CONTENT_FORMAT_APP_JSON,
+							COAP_CONTENT_FORMAT_APP_JSON, NULL,
+							async_done, &results[i]));
+	}
+
+	zassert_ok(nrf_cloud_coap_disconnect());
+
+	/* Requests in progress are completed when the connection is closed. */
+	for (size_t i = 0; i < 2; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)));
+		zassert_true(results[i] < 0, "Request %zu result %d", i, results[i]);
+	}
+
+	zassert_equal(nrf_cloud_coap_async_request(COAP_METHOD_POST, RESOURCE, NULL, payload,
+						   sizeof(payload) - 1,
+						   COAP_CONTENT_FORMAT_APP_JSON,
+						   COAP_CONTENT_FORMAT_APP_JSON, NULL, async_done,
+						   &results[0]),
+		      -EACCES);
+}
+
+static void *suite_setup(void)
+{
+	nrf_cloud_jwt_generate_fake.custom_fake = fake_nrf_cloud_jwt_generate__succeeds;
+	nrf_cloud_connect_host_fake.custom_fake = fake_nrf_cloud_connect_host__server;
+	nrf_cloud_obj_init_fake.custom_fake = fake_nrf_cloud_obj_init__fails;
+	nrf_cloud_shadow_control_response_encode_fake.custom_fake =
+		fake_nrf_cloud_shadow_control_response_encode__fails;
+
+	zassert_ok(server_start());
+	zassert_ok(nrf_cloud_coap_init());
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	server_silent_set(false);
+	server_rtt_set(RTT_MS);
+	k_sem_reset(&done_sem);
+
+	if (!nrf_cloud_coap_is_connected()) {
+		zassert_ok(nrf_cloud_coap_connect(NULL));
+	}
+
+	zassert_true(nrf_cloud_coap_is_connected());
+}
+
+ZTEST_SUITE(nrf_cloud_coap_transport, NULL, suite_setup, before, NULL, NULL);
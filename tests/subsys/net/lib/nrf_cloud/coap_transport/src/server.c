@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Stand-in for the nRF Cloud CoAP server. It answers every confirmable request with a
+ * piggybacked response after a fixed delay, which emulates the round trip over a
+ * high-latency link. Requests received while other responses are pending are answered in
+ * order, each after its own delay, like a server that handles requests concurrently.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/net/socket.h>
+
+#include "server.h"
+
+#define MESSAGE_SIZE	 256
+#define PENDING_MAX	 16
+#define STACK_SIZE	 2048
+#define THREAD_PRIORITY	 K_PRIO_PREEMPT(5)
+#define AUTH_PATH	 "auth"
+
+struct pending {
+	int64_t due_ms;
+	struct sockaddr addr;
+	socklen_t addr_len;
+	uint16_t len;
+	uint8_t data[MESSAGE_SIZE];
+};
+
+K_MSGQ_DEFINE(pending_msgq, sizeof(struct pending), PENDING_MAX, 4);
+K_THREAD_STACK_DEFINE(rx_stack, STACK_SIZE);
+K_THREAD_STACK_DEFINE(tx_stack, STACK_SIZE);
+
+static struct k_thread rx_thread;
+static struct k_thread tx_thread;
+static int sock = -1;
+static uint32_t rtt_ms;
+static bool silent;
+static atomic_t request_count;
+
+static uint8_t response_code(const struct coap_packet *request)
+{
+	struct coap_option path;
+
+	switch (coap_header_get_code(request)) {
+	case COAP_METHOD_GET:
+	case COAP_METHOD_FETCH:
+		return COAP_RESPONSE_CODE_CONTENT;
+	case COAP_METHOD_POST:
+		if ((coap_find_options(request, COAP_OPTION_URI_PATH, &path, 1) == 1) &&
+		    (path.len == strlen(AUTH_PATH)) &&
+		    (memcmp(path.value, AUTH_PATH, path.len) == 0)) {
+			return COAP_RESPONSE_CODE_CREATED;
+		}
+		return COAP_RESPONSE_CODE_CHANGED;
+	default:
+		return COAP_RESPONSE_CODE_CHANGED;
+	}
+}
+
+static void rx_fn(void *p1, void *p2, void *p3)
+{
+	static struct pending item;
+	struct coap_packet request;
+
+	while (true) {
+		int len;
+
+		item.addr_len = sizeof(item.addr);
+		len = zsock_recvfrom(sock, item.data, sizeof(item.data), 0, &item.addr,
+				     &item.addr_len);
+		if (len < 0) {
+			continue;
+		}
+
+		if (coap_packet_parse(&request, item.data, len, NULL, 0) ||
+		    (coap_header_get_type(&request) != COAP_TYPE_CON)) {
+			continue;
+		}
+
+		atomic_inc(&request_count);
+
+		if (silent) {
+			continue;
+		}
+
+		item.len = len;
+		item.due_ms = k_uptime_get() + rtt_ms;
+		(void)k_msgq_put(&pending_msgq, &item, K_FOREVER);
+	}
+}
+
+static void tx_fn(void *p1, void *p2, void *p3)
+{
+	static struct pending item;
+	static uint8_t buf[MESSAGE_SIZE];
+	struct coap_packet request;
+	struct coap_packet response;
+
+	while (true) {
+		uint8_t code;
+
+		(void)k_msgq_get(&pending_msgq, &item, K_FOREVER);
+		k_sleep(K_TIMEOUT_ABS_MS(item.due_ms));
+
+		if (coap_packet_parse(&request, item.data, item.len, NULL, 0)) {
+			continue;
+		}
+
+		code = response_code(&request);
+		if (coap_ack_init(&response, &request, buf, sizeof(buf), code)) {
+			continue;
+		}
+
+		if (code == COAP_RESPONSE_CODE_CONTENT) {
+			(void)coap_packet_append_payload_marker(&response);
+			(void)coap_packet_append_payload(&response, "{}", 2);
+		}
+
+		(void)zsock_sendto(sock, response.data, response.offset, 0, &item.addr,
+				   item.addr_len);
+	}
+}
+
+int server_start(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+
+	if (sock >= 0) {
+		return 0;
+	}
+
+	sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	if (zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr))) {
+		zsock_close(sock);
+		sock = -1;
+		return -errno;
+	}
+
+	k_thread_create(&rx_thread, rx_stack, K_THREAD_STACK_SIZEOF(rx_stack), rx_fn, NULL,
+			NULL, NULL, THREAD_PRIORITY, 0, K_NO_WAIT);
+	k_thread_create(&tx_thread, tx_stack, K_THREAD_STACK_SIZEOF(tx_stack), tx_fn, NULL,
+			NULL, NULL, THREAD_PRIORITY, 0, K_NO_WAIT);
+
+	return 0;
+}
+
+void server_rtt_set(uint32_t rtt)
+{
+	rtt_ms = rtt;
+}
+
+void server_silent_set(bool enable)
+{
+	silent = enable;
+}
+
+uint32_t server_request_count(void)
+{
+	return atomic_get(&request_count);
+}
+
+int server_connect(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	int client = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+	if (client < 0) {
+		return -errno;
+	}
+
+	if (zsock_connect(client, (struct sockaddr *)&addr, sizeof(addr))) {
+		zsock_close(client);
+		return -errno;
+	}
+
+	return client;
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SERVER_H_
+#define SERVER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/net/socket.h>
+
+#define SERVER_PORT 5683
+
+/* Start the stand-in nRF Cloud CoAP server on the loopback interface. */
+int server_start(void);
+
+/* Set the delay between receiving a request and sending its response. */
+void server_rtt_set(uint32_t rtt_ms);
+
+/* Stop responding to requests, so that they stay in progress. */
+void server_silent_set(bool silent);
+
+/* Number of requests received, except retransmissions. */
+uint32_t server_request_count(void);
+
+/* Open a UDP socket connected to the server. */
+int server_connect(void);
+
+#endif /* SERVER_H_ */
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Generate a source and a target image like two builds of an application.
+
+The target image has a function added in the middle and a constant changed, so that the
+code after the new function moves and the addresses that point to it change.
+"""
+
+import argparse
+import random
+import struct
+import sys
+from pathlib import Path
+
+BASE_ADDRESS = 0x10000
+FUNCTIONS = 160
+
+
+def build(functions: list) -> bytes:
+    """Lay out the functions, each followed by a literal pool with addresses of others."""
+    addresses = []
+    address = BASE_ADDRESS
+    for code, calls in functions:
+        addresses.append(address)
+        address += len(code) + 4 * len(calls)
+
+    image = bytearray()
+    for code, calls in functions:
+        image += code
+        for callee in calls:
+            image += struct.pack('<I', addresses[callee % len(functions)] | 1)
+    return bytes(image)
+
+
+def generate() -> tuple:
+    rng = random.Random(1)
+    # A limited set of instructions, as compiled code has
+    opcodes = [rng.getrandbits(16) for _ in range(300)]
+
+    def function():
+        code = b''.join(struct.pack('<H', rng.choice(opcodes))
+                        for _ in range(rng.randint(20, 400)))
+        calls = [rng.randrange(FUNCTIONS) for _ in range(rng.randint(0, 6))]
+        return code, calls
+
+    functions = [function() for _ in range(FUNCTIONS)]
+    source = build(functions)
+
+    functions.insert(FUNCTIONS // 2, function())
+    code, calls = functions[FUNCTIONS // 4]
+    functions[FUNCTIONS // 4] = (code[:10] + b'\x2a\x20' + code[12:], calls)
+    target = build(functions)
+
+    return source, target
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, allow_abbrev=False)
+    parser.add_argument('--source', required=True, help='Source image to create.')
+    parser.add_argument('--target', required=True, help='Target image to create.')
+    args = parser.parse_args()
+
+    source, target = generate()
+    Path(args.source).write_bytes(source)
+    Path(args.target).write_bytes(target)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_compress/implementation.h>
+
+/* Image installed on the device */
+static const uint8_t source_image[] = {
+#include "delta_source.inc"
+};
+
+/* New image */
+static const uint8_t target_image[] = {
+#include "delta_target.inc"
+};
+
+/* Patch created with scripts/nrf_compress/delta.py */
+static const uint8_t patch[] = {
+#include "delta_patch.inc"
+};
+
+static uint8_t output_image[sizeof(target_image)];
+static uint8_t bad_patch[sizeof(patch)];
+static size_t read_cnt;
+static bool read_fail;
+
+static size_t read_source(size_t pos, uint8_t *data, size_t len)
+{
+	read_cnt++;
+
+	if (read_fail || pos + len > sizeof(source_image)) {
+		return 0;
+	}
+
+	memcpy(data, &source_image[pos], len);
+
+	return len;
+}
+
+static const delta_codec delta_inst = {
+	.read = read_source,
+	.source_size = sizeof(source_image),
+};
+
+static const delta_codec delta_inst_other_source = {
+	.read = read_source,
+	.source_size = sizeof(source_image) - 1,
+};
+
+/* Apply a patch, with at most step bytes more of it available at a time, as when streamed */
+static int apply(const delta_codec *inst, const uint8_t *input, size_t input_size, size_t step,
+		 size_t *output_image_size)
+{
+	struct nrf_compress_implementation *implementation;
+	size_t available = 0;
+	uint32_t pos = 0;
+	int rc;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+
+	*output_image_size = 0;
+
+	rc = implementation->init((void *)inst, sizeof(target_image));
+	zassert_ok(rc, "Expected init to be successful");
+
+	zassert_equal(implementation->decompress_bytes_needed((void *)inst), DELTA_HEADER_SIZE,
+		      "Expected to need header size bytes for the delta header");
+
+	while (pos < input_size) {
+		uint32_t offset;
+		uint8_t *output;
+		size_t output_size;
+		size_t len;
+
+		available = MIN(MAX(available, pos + step), input_size);
+		len = MIN(implementation->decompress_bytes_needed((void *)inst), available - pos);
+
+		rc = implementation->decompress((void *)inst, &input[pos], len,
+						pos + len == input_size, &offset, &output,
+						&output_size);
+		if (rc) {
+			break;
+		}
+
+		zassert_true(*output_image_size + output_size <= sizeof(output_image),
+			     "Expected output to fit the target image");
+		memcpy(&output_image[*output_image_size], output, output_size);
+		*output_image_size += output_size;
+
+		if (offset == 0 && output_size == 0) {
+			/* Needs more of the patch */
+			zassert_true(available < input_size, "Expected progress at %u", pos);
+			available += step;
+		}
+
+		pos += offset;
+	}
+
+	(void)implementation->deinit((void *)inst);
+
+	return rc;
+}
+
+ZTEST(nrf_compress_decompression_delta, test_valid_implementation)
+{
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+	zassert_equal(implementation->id, NRF_COMPRESS_TYPE_DELTA,
+		      "Expected id element to have correct value");
+	zassert_is_null(implementation->compress, "Expected compress element to be NULL");
+}
+
+ZTEST(nrf_compress_decompression_delta, test_patch_smaller_than_image)
+{
+	zassert_true(sizeof(patch) < sizeof(target_image) / 10,
+		     "Expected patch of %zu bytes to be much smaller than the image of %zu bytes",
+		     sizeof(patch), sizeof(target_image));
+}
+
+ZTEST(nrf_compress_decompression_delta, test_valid_patch)
+{
+	size_t output_size;
+
+	zassert_ok(apply(&delta_inst, patch, sizeof(patch), sizeof(patch), &output_size),
+		   "Expected patch to apply");
+	zassert_equal(output_size, sizeof(target_image), "Expected decompressed size to match");
+	zassert_mem_equal(output_image, target_image, sizeof(target_image),
+			  "Expected output to match the target image");
+}
+
+ZTEST(nrf_compress_decompression_delta, test_valid_patch_streamed)
+{
+	const size_t steps[] = { 1, 2, 5, 13, 64, 1000 };
+
+	for (size_t i = 0; i < ARRAY_SIZE(steps); i++) {
+		size_t output_size;
+
+		memset(output_image, 0, sizeof(output_image));
+
+		zassert_ok(apply(&delta_inst, patch, sizeof(patch), steps[i], &output_size),
+			   "Expected patch to apply in steps of %zu", steps[i]);
+		zassert_equal(output_size, sizeof(target_image),
+			      "Expected decompressed size to match");
+		zassert_mem_equal(output_image, target_image, sizeof(target_image),
+				  "Expected output to match the target image");
+	}
+}
+
+ZTEST(nrf_compress_decompression_delta, test_invalid_header)
+{
+	size_t output_size;
+
+	memcpy(bad_patch, patch, sizeof(patch));
+	bad_patch[0] ^= 0xff;
+
+	zassert_equal(apply(&delta_inst, bad_patch, sizeof(patch), sizeof(patch), &output_size),
+		      -EINVAL, "Expected invalid header to be rejected");
+	zassert_equal(output_size, 0, "Expected no output");
+}
+
+ZTEST(nrf_compress_decompression_delta, test_other_source_image)
+{
+	size_t output_size;
+
+	zassert_equal(apply(&delta_inst_other_source, patch, sizeof(patch), sizeof(patch),
+			    &output_size),
+		      -EINVAL, "Expected patch for another source image to be rejected");
+	zassert_equal(output_size, 0, "Expected no output");
+}
+
+ZTEST(nrf_compress_decompression_delta, test_truncated_patch)
+{
+	size_t output_size;
+
+	zassert_equal(apply(&delta_inst, patch, sizeof(patch) - 1, sizeof(patch), &output_size),
+		      -EINVAL, "Expected truncated patch to be rejected");
+}
+
+ZTEST(nrf_compress_decompression_delta, test_source_read_failure)
+{
+	size_t output_size;
+
+	read_fail = true;
+
+	zassert_equal(apply(&delta_inst, patch, sizeof(patch), sizeof(patch), &output_size),
+		      -EIO, "Expected source read failure to be reported");
+	zassert_true(read_cnt > 0, "Expected source to be read");
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	read_cnt = 0;
+	read_fail = false;
+}
+
+ZTEST_SUITE(nrf_compress_decompression_delta, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <nrf_rpc_errno.h>
+#include <nrf_rpc/nrf_rpc_uart.h>
+#include <nrf_rpc_uart_internal.h>
+
+#include <zephyr/drivers/serial/uart_emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+#define RPC_UART_NODE DT_NODELABEL(rpc_uart)
+
+#define PACKET_CNT	1000
+#define PACKET_SIZE_MIN sizeof(uint32_t)
+#define PACKET_SIZE_MAX 64
+
+/* The library only defines the transport for UARTE nodes */
+NRF_RPC_UART_TRANSPORT_DEFINE(RPC_UART_NODE);
+
+static const struct device *const uart_dev = DEVICE_DT_GET(RPC_UART_NODE);
+static const struct nrf_rpc_tr *const transport = &NRF_RPC_UART_TRANSPORT(RPC_UART_NODE);
+
+static K_SEM_DEFINE(rx_done, 0, 1);
+static uint32_t rx_cnt;
+static uint32_t rx_invalid;
+
+/* Packets of varying length, starting with their index */
+static size_t packet_fill(uint8_t *buf, uint32_t idx)
+{
+	size_t len = PACKET_SIZE_MIN + idx % (PACKET_SIZE_MAX - PACKET_SIZE_MIN + 1);
+
+	sys_put_le32(idx, buf);
+
+	for (size_t i = PACKET_SIZE_MIN; i < len; i++) {
+		buf[i] = (uint8_t)(idx + i);
+	}
+
+	return len;
+}
+
+static void receive_cb(const struct nrf_rpc_tr *tr, const uint8_t *packet, size_t len,
+		       void *context)
+{
+	uint8_t expected[PACKET_SIZE_MAX];
+
+	if (len != packet_fill(expected, rx_cnt) || memcmp(packet, expected, len) != 0) {
+		rx_invalid++;
+	}
+
+	if (++rx_cnt == PACKET_CNT) {
+		k_sem_give(&rx_done);
+	}
+}
+
+/* The loopback only feeds RX, so drain the TX data to keep the emulated UART going */
+static void tx_data_ready(const struct device *dev, size_t size, void *user_data)
+{
+	uint8_t buf[64];
+
+	while (uart_emul_get_tx_data(dev, buf, sizeof(buf)) > 0) {
+	}
+}
+
+static void *setup(void)
+{
+	zassert_true(device_is_ready(uart_dev));
+
+	uart_emul_callback_tx_data_ready_set(uart_dev, tx_data_ready, NULL);
+	zassert_ok(transport->api->init(transport, receive_cb, NULL));
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	rx_cnt = 0;
+	rx_invalid = 0;
+	k_sem_reset(&rx_done);
+	nrf_rpc_uart_stats_reset(transport);
+}
+
+ZTEST(nrf_rpc_uart_transport, test_loopback_throughput)
+{
+	struct nrf_rpc_uart_stats stats;
+	uint32_t start = k_cycle_get_32();
+	uint32_t elapsed_us;
+
+	for (uint32_t i = 0; i < PACKET_CNT; i++) {
+		size_t size = PACKET_SIZE_MAX;
+		uint8_t *buf = transport->api->tx_buf_alloc(transport, &size);
+
+		zassert_not_null(buf);
+		zassert_ok(transport->api->send(transport, buf, packet_fill(buf, i)));
+	}
+
+	zassert_ok(k_sem_take(&rx_done, K_SECONDS(10)), "Received %u packets", rx_cnt);
+	elapsed_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	zassert_equal(rx_invalid, 0, "%u packets received out of order or corrupted", rx_invalid);
+
+	nrf_rpc_uart_stats_get(transport, &stats);
+
+	TC_PRINT("%u packets in %u frames (%u.%02u packets per frame), %u us\n", stats.tx_packets,
+		 stats.tx_frames, stats.tx_packets / stats.tx_frames,
+		 (stats.tx_packets * 100 / stats.tx_frames) % 100, elapsed_us);
+	TC_PRINT("TX %u bytes, %u retransmissions, %u drops, RX %u bytes, %u errors\n",
+		 stats.tx_bytes, stats.tx_retransmissions, stats.tx_drops, stats.rx_bytes,
+		 stats.rx_errors);
+	TC_PRINT("Ack latency last %u us, max %u us, queue latency last %u us, max %u us\n",
+		 stats.ack_latency_last_us, stats.ack_latency_max_us, stats.queue_latency_last_us,
+		 stats.queue_latency_max_us);
+
+	zassert_equal(stats.tx_packets, PACKET_CNT);
+	zassert_equal(stats.rx_packets, PACKET_CNT);
+	zassert_equal(stats.tx_drops, 0);
+	zassert_equal(stats.rx_frames, stats.tx_frames - stats.tx_retransmissions);
+
+	if (IS_ENABLED(CONFIG_NRF_RPC_UART_BATCHING)) {
+		zassert_true(stats.tx_frames < stats.tx_packets, "Packets not aggregated");
+	} else {
+		zassert_equal(stats.tx_frames, stats.tx_packets);
+	}
+}
+
+ZTEST(nrf_rpc_uart_transport, test_packet_too_long)
+{
+	size_t size = CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE;
+	uint8_t *buf;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NRF_RPC_UART_BATCHING);
+
+	buf = transport->api->tx_buf_alloc(transport, &size);
+	zassert_not_null(buf);
+	memset(buf, 0, size);
+
+	zassert_equal(transport->api->send(transport, buf, size), -NRF_EINVAL);
+}
+
+ZTEST_SUITE(nrf_rpc_uart_transport, NULL, setup, before, NULL, NULL);